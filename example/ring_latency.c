@@ -0,0 +1,195 @@
+/**
+ * @file    ring_latency.c
+ * @brief   End-to-end latency benchmark for the sample ring.
+ *
+ * @details
+ * An acquisition thread commits one block every TICK_NS nanoseconds and stamps it; a
+ * conversion thread drains the blocks and records the time from commit to converted
+ * temperatures. The same measurement is repeated over a mutex/condition-variable queue
+ * for comparison. Pass two CPU numbers to pin the threads.
+ *
+ * Build: cc -O2 -std=c11 -pthread -I../lib ring_latency.c ../lib/thermocouple_ring.c
+ *        ../lib/thermocouple_sensor.c -lm
+ */
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "thermocouple_ring.h"
+
+#define SLOTS      64U
+#define BLOCK      256U
+#define BLOCKS     200000U
+#define TICK_NS    5000U
+
+typedef struct
+{
+    SampleRing ring;
+    pthread_mutex_t lock;
+    pthread_cond_t ready;
+    size_t queued;
+    int locked;
+} Channel;
+
+static double storage[SLOTS * BLOCK];
+static size_t counts[SLOTS];
+static uint64_t stamps[BLOCKS];
+static uint64_t latency[BLOCKS];
+static int cpus[2] = { -1, -1 };
+
+static uint64_t Now(void)
+{
+    struct timespec ts;
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)ts.tv_sec * 1000000000U) + (uint64_t)ts.tv_nsec;
+}
+
+static void Pin(int cpu)
+{
+    cpu_set_t set;
+    if (cpu >= 0)
+    {
+        CPU_ZERO(&set);
+        CPU_SET(cpu, &set);
+        (void)pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+    }
+}
+
+static void *Producer(void *pArg)
+{
+    Channel *pChannel = (Channel *)pArg;
+    uint64_t next = Now();
+    size_t b;
+    size_t i;
+
+    Pin(cpus[0]);
+    for (b = 0U; b < BLOCKS; ++b)
+    {
+        double *pSlot;
+
+        while (Now() < next)
+        {
+        }
+        next += TICK_NS;
+
+        do
+        {
+            if (pChannel->locked != 0)
+            {
+                (void)pthread_mutex_lock(&pChannel->lock);
+            }
+            pSlot = TC_Ring_AcquireWrite(&pChannel->ring);
+            if ((pSlot == NULL) && (pChannel->locked != 0))
+            {
+                (void)pthread_mutex_unlock(&pChannel->lock);
+            }
+        } while (pSlot == NULL);
+
+        for (i = 0U; i < BLOCK; ++i)
+        {
+            pSlot[i] = 0.001 * (double)((b + i) % 40000U);
+        }
+        stamps[b] = Now();
+        TC_Ring_CommitWrite(&pChannel->ring, BLOCK);
+
+        if (pChannel->locked != 0)
+        {
+            pChannel->queued++;
+            (void)pthread_cond_signal(&pChannel->ready);
+            (void)pthread_mutex_unlock(&pChannel->lock);
+        }
+    }
+
+    return NULL;
+}
+
+static void *Consumer(void *pArg)
+{
+    Channel *pChannel = (Channel *)pArg;
+    double temperature[BLOCK];
+    size_t b = 0U;
+
+    Pin(cpus[1]);
+    while (b < BLOCKS)
+    {
+        size_t converted;
+
+        if (pChannel->locked != 0)
+        {
+            (void)pthread_mutex_lock(&pChannel->lock);
+            while (pChannel->queued == 0U)
+            {
+                (void)pthread_cond_wait(&pChannel->ready, &pChannel->lock);
+            }
+            converted = TC_Ring_Drain(&pChannel->ring, TC_TYPE_K, TC_MODE_FAST, temperature, BLOCK, NULL);
+            pChannel->queued -= converted / BLOCK;
+            (void)pthread_mutex_unlock(&pChannel->lock);
+        }
+        else
+        {
+            converted = TC_Ring_Drain(&pChannel->ring, TC_TYPE_K, TC_MODE_FAST, temperature, BLOCK, NULL);
+        }
+
+        if (converted != 0U)
+        {
+            latency[b] = Now() - stamps[b];
+            ++b;
+        }
+    }
+
+    return NULL;
+}
+
+static int Compare(const void *pA, const void *pB)
+{
+    const uint64_t a = *(const uint64_t *)pA;
+    const uint64_t b = *(const uint64_t *)pB;
+    return (a > b) - (a < b);
+}
+
+static void Run(const char *pName, int locked)
+{
+    Channel channel;
+    pthread_t producer;
+    pthread_t consumer;
+
+    (void)memset(&channel, 0, sizeof(channel));
+    (void)TC_Ring_Init(&channel.ring, storage, counts, SLOTS, BLOCK);
+    (void)pthread_mutex_init(&channel.lock, NULL);
+    (void)pthread_cond_init(&channel.ready, NULL);
+    channel.locked = locked;
+
+    (void)pthread_create(&consumer, NULL, Consumer, &channel);
+    (void)pthread_create(&producer, NULL, Producer, &channel);
+    (void)pthread_join(producer, NULL);
+    (void)pthread_join(consumer, NULL);
+
+    qsort(latency, BLOCKS, sizeof(latency[0]), Compare);
+    printf("%-12s p50 %6llu ns  p99 %6llu ns  p99.9 %7llu ns  max %8llu ns\n", pName,
+           (unsigned long long)latency[BLOCKS / 2U], (unsigned long long)latency[(BLOCKS * 99U) / 100U],
+           (unsigned long long)latency[(BLOCKS * 999U) / 1000U], (unsigned long long)latency[BLOCKS - 1U]);
+
+    (void)pthread_cond_destroy(&channel.ready);
+    (void)pthread_mutex_destroy(&channel.lock);
+}
+
+int main(int argc, char **argv)
+{
+    if (argc > 2)
+    {
+        cpus[0] = atoi(argv[1]);
+        cpus[1] = atoi(argv[2]);
+    }
+
+    printf("%u blocks of %u samples, one every %u ns\n", BLOCKS, BLOCK, TICK_NS);
+    Run("lock-free", 0);
+    Run("mutex+cond", 1);
+
+    return 0;
+}
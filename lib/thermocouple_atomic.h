@@ -0,0 +1,45 @@
+/**
+ * @file    thermocouple_atomic.h
+ * @author  Amirhossein Askari
+ * @version v1.0.0
+ * @date    2026-10-16
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Atomic and cache-line alignment helpers shared by the threaded modules.
+ *
+ * @details
+ * Lets the structures of the ring, pipeline and scheduler modules declare C11 atomic,
+ * cache-line aligned members that are also usable from C++, where @c std::atomic of a
+ * lock-free integer has the same layout as the C11 @c _Atomic type.
+ */
+
+
+#ifndef _THERMOCOUPLE_ATOMIC_H
+#define _THERMOCOUPLE_ATOMIC_H
+
+/* ------------------------------------- Includes ------------------------------------- */
+
+#ifdef __cplusplus
+#include <atomic>         ///< std::atomic
+#else
+#include <stdatomic.h>    ///< C11 atomics
+#endif
+
+
+/* -------------------------------------- Defines ------------------------------------- */
+
+/** @brief Cache line size shared atomics are padded to */
+#ifndef TC_CACHE_LINE_SIZE
+#define  TC_CACHE_LINE_SIZE    64U    ///< Cache line size in bytes
+#endif
+
+#ifdef __cplusplus
+#define  TC_ATOMIC(T)          std::atomic<T>                   ///< Atomic member of type T
+#define  TC_CACHE_ALIGNED      alignas(TC_CACHE_LINE_SIZE)      ///< Starts a member on its own cache line
+#else
+#define  TC_ATOMIC(T)          _Atomic(T)                       ///< Atomic member of type T
+#define  TC_CACHE_ALIGNED      _Alignas(TC_CACHE_LINE_SIZE)     ///< Starts a member on its own cache line
+#endif
+
+
+#endif /* thermocouple_atomic.h */
@@ -0,0 +1,279 @@
+/**
+ * @file    thermocouple_channel.c
+ * @author  Amirhossein Askari
+ * @version v1.0.0
+ * @date    2026-10-16
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Source file for the convert-on-read channel store.
+ *
+ * @details
+ * Block @c b lives in ring slot @c b % @c ringBlocks. A cache entry covers a prefix of
+ * its block: a read converts the samples between that prefix and the block's current
+ * length, which is the whole block on a miss and only the newest samples of the open
+ * block otherwise.
+ */
+
+
+/* ------------------------------------- Includes -------------------------------------- */
+
+#include "thermocouple_channel.h"    ///< Header file for the channel store
+#include <stdlib.h>                  ///< malloc, free
+#include <string.h>                  ///< memcpy, memset
+
+
+
+/* ------------------------------------- Functions ------------------------------------- */
+
+/**
+ * @brief  Returns the index of the oldest retained block.
+ *
+ * @param[in] pStore  Store.
+ *
+ * @return Block index.
+ */
+static uint64_t Channel_OldestBlock(const ChannelStore *pStore)
+{
+    const uint64_t blocks = (pStore->samples + TC_CHANNEL_BLOCK_SIZE - 1U) / TC_CHANNEL_BLOCK_SIZE;
+
+    return (blocks > pStore->ringBlocks) ? (blocks - pStore->ringBlocks) : 0U;
+}
+
+/**
+ * @brief  Creates an empty store.
+ *
+ * @param[out] pStore    Store to initialize.
+ * @param[in]  type      Thermocouple type as defined in the @c ThermocoupleType enum.
+ * @param[in]  mode      @c TC_MODE_FAST or @c TC_MODE_EXACT.
+ * @param[in]  capacity  Samples retained, rounded up to whole blocks; at least two blocks are kept.
+ *
+ * @return 1 on success, or 0 on allocation failure.
+ */
+uint8_t TC_Channel_Init(ChannelStore *pStore, ThermocoupleType type, ConversionMode mode, size_t capacity)
+{
+    uint8_t result = 1U;
+    double *pCache = NULL;
+    size_t e;
+
+    (void)memset(pStore, 0, sizeof(*pStore));
+    pStore->type       = type;
+    pStore->mode       = mode;
+    pStore->ringBlocks = (capacity + TC_CHANNEL_BLOCK_SIZE - 1U) / TC_CHANNEL_BLOCK_SIZE;
+    pStore->ringBlocks = (pStore->ringBlocks < 2U) ? 2U : pStore->ringBlocks;
+
+    pStore->pVoltage = (double *)malloc(pStore->ringBlocks * TC_CHANNEL_BLOCK_SIZE * sizeof(double));
+    pCache           = (double *)malloc(TC_CHANNEL_CACHE_BLOCKS * TC_CHANNEL_BLOCK_SIZE * sizeof(double));
+
+    if ((pStore->pVoltage == NULL) || (pCache == NULL))
+    {
+        free(pStore->pVoltage);
+        free(pCache);
+        pStore->pVoltage = NULL;
+        result = 0U;
+    }
+    else
+    {
+        for (e = 0U; e < TC_CHANNEL_CACHE_BLOCKS; ++e)
+        {
+            pStore->cache[e].pTemperature = &pCache[e * TC_CHANNEL_BLOCK_SIZE];
+        }
+    }
+
+    return result;
+}
+
+/**
+ * @brief  Releases the memory of a store.
+ *
+ * @param[in] pStore  Store.
+ */
+void TC_Channel_Destroy(ChannelStore *pStore)
+{
+    if (pStore != NULL)
+    {
+        /* The cache entries share one allocation, owned by the first */
+        free(pStore->cache[0].pTemperature);
+        free(pStore->pVoltage);
+        (void)memset(pStore, 0, sizeof(*pStore));
+    }
+}
+
+/**
+ * @brief  Appends voltages, overwriting the oldest blocks when the ring is full.
+ *
+ * @param[in] pStore    Store.
+ * @param[in] pVoltage  @p count voltages in mV.
+ * @param[in] count     Number of samples.
+ */
+void TC_Channel_Write(ChannelStore *pStore, const double *pVoltage, size_t count)
+{
+    const size_t ringSize = pStore->ringBlocks * TC_CHANNEL_BLOCK_SIZE;
+    uint64_t oldest;
+    size_t done = 0U;
+    size_t e;
+
+    while (done < count)
+    {
+        const size_t slot = (size_t)(pStore->samples % ringSize);
+        const size_t run  = ((count - done) < (ringSize - slot)) ? (count - done) : (ringSize - slot);
+
+        (void)memcpy(&pStore->pVoltage[slot], &pVoltage[done], run * sizeof(double));
+        pStore->samples += run;
+        done += run;
+    }
+
+    /* Converted prefixes stay valid; only blocks that left the ring are dropped */
+    oldest = Channel_OldestBlock(pStore);
+    for (e = 0U; e < TC_CHANNEL_CACHE_BLOCKS; ++e)
+    {
+        if ((pStore->cache[e].rows != 0U) && (pStore->cache[e].block < oldest))
+        {
+            pStore->cache[e].rows   = 0U;
+            pStore->cache[e].failed = 0U;
+            pStore->cache[e].used   = 0U;
+        }
+    }
+}
+
+/**
+ * @brief  Returns the first sample still retained.
+ *
+ * @param[in] pStore  Store.
+ *
+ * @return Index of the oldest readable sample.
+ */
+uint64_t TC_Channel_Oldest(const ChannelStore *pStore)
+{
+    const uint64_t first = Channel_OldestBlock(pStore) * TC_CHANNEL_BLOCK_SIZE;
+
+    return (first < pStore->samples) ? first : pStore->samples;
+}
+
+/**
+ * @brief  Returns the temperatures of one block, converting what is not cached yet.
+ *
+ * @param[in]  pStore   Store.
+ * @param[in]  block    Block index.
+ * @param[out] pRows    Receives the samples in the block.
+ * @param[out] pFailed  Optional; receives the samples of the block set to @c TC_CONVERSION_FAILED.
+ *
+ * @return Temperatures in °C, or @c NULL if the block is not retained.
+ */
+const double *TC_Channel_ReadBlock(ChannelStore *pStore, uint64_t block, size_t *pRows, size_t *pFailed)
+{
+    const double *pResult      = NULL;
+    ChannelCacheEntry *pHit    = NULL;
+    ChannelCacheEntry *pVictim = &pStore->cache[0];
+    uint64_t first;
+    size_t rows = 0U;
+    size_t e;
+
+    first = block * TC_CHANNEL_BLOCK_SIZE;
+    if ((block >= Channel_OldestBlock(pStore)) && (first < pStore->samples))
+    {
+        const double *pSource = &pStore->pVoltage[(size_t)(block % pStore->ringBlocks) * TC_CHANNEL_BLOCK_SIZE];
+
+        rows = ((pStore->samples - first) < TC_CHANNEL_BLOCK_SIZE) ? (size_t)(pStore->samples - first)
+                                                                    : TC_CHANNEL_BLOCK_SIZE;
+
+        /* Free entries have a zero tick, so they are taken before the least recently used one */
+        for (e = 0U; (pHit == NULL) && (e < TC_CHANNEL_CACHE_BLOCKS); ++e)
+        {
+            ChannelCacheEntry *pEntry = &pStore->cache[e];
+
+            if ((pEntry->rows != 0U) && (pEntry->block == block))
+            {
+                pHit = pEntry;
+            }
+            else if (pEntry->used < pVictim->used)
+            {
+                pVictim = pEntry;
+            }
+            else
+            {
+                /* Used more recently than the current victim */
+            }
+        }
+
+        if (pHit == NULL)
+        {
+            pHit = pVictim;
+            pHit->block  = block;
+            pHit->rows   = 0U;
+            pHit->failed = 0U;
+        }
+
+        if (pHit->rows < rows)
+        {
+            pHit->failed += TC_CalculateTemperatureArray(pStore->type, &pSource[pHit->rows],
+                                                         &pHit->pTemperature[pHit->rows], rows - pHit->rows,
+                                                         pStore->mode);
+            pStore->converted += rows - pHit->rows;
+            pHit->rows = rows;
+        }
+
+        pHit->used = ++pStore->tick;
+        pResult    = pHit->pTemperature;
+        if (pFailed != NULL)
+        {
+            *pFailed = pHit->failed;
+        }
+    }
+
+    *pRows = rows;
+
+    return pResult;
+}
+
+/**
+ * @brief  Copies the temperatures of a range of samples.
+ *
+ * @param[in]  pStore        Store.
+ * @param[in]  first         First sample.
+ * @param[out] pTemperature  Receives up to @p count temperatures in °C.
+ * @param[in]  count         Samples wanted.
+ * @param[out] pFailed       Optional; receives the samples set to @c TC_CONVERSION_FAILED.
+ *
+ * @return Samples copied.
+ */
+size_t TC_Channel_Read(ChannelStore *pStore, uint64_t first, double *pTemperature, size_t count, size_t *pFailed)
+{
+    size_t copied = 0U;
+    size_t failed = 0U;
+    size_t rows   = 0U;
+    uint8_t more  = (first >= TC_Channel_Oldest(pStore)) ? 1U : 0U;
+    size_t i;
+
+    while ((more != 0U) && (copied < count))
+    {
+        const uint64_t sample = first + copied;
+        const size_t phase    = (size_t)(sample % TC_CHANNEL_BLOCK_SIZE);
+        const double *pBlock  = TC_Channel_ReadBlock(pStore, sample / TC_CHANNEL_BLOCK_SIZE, &rows, NULL);
+
+        if ((pBlock == NULL) || (phase >= rows))
+        {
+            more = 0U;
+        }
+        else
+        {
+            const size_t run = ((count - copied) < (rows - phase)) ? (count - copied) : (rows - phase);
+
+            for (i = 0U; i < run; ++i)
+            {
+                failed += (pBlock[phase + i] == TC_CONVERSION_FAILED) ? 1U : 0U;
+            }
+            (void)memcpy(&pTemperature[copied], &pBlock[phase], run * sizeof(double));
+            copied += run;
+        }
+    }
+
+    if (pFailed != NULL)
+    {
+        *pFailed = failed;
+    }
+
+    return copied;
+}
+
+
+/* thermocouple_channel.c */
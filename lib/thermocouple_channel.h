@@ -0,0 +1,150 @@
+/**
+ * @file    thermocouple_channel.h
+ * @author  Amirhossein Askari
+ * @version v1.0.0
+ * @date    2026-10-16
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Header file for the convert-on-read channel store.
+ *
+ * @details
+ * A channel store keeps the most recent raw voltages (mV) of one channel in a ring of
+ * blocks of @c TC_CHANNEL_BLOCK_SIZE samples. Writes only copy voltages; nothing is
+ * converted until a range is read. Each block read is converted once through
+ * @c TC_CalculateTemperatureArray into a small LRU cache of @c TC_CHANNEL_CACHE_BLOCKS
+ * blocks, so repeated reads of the same range cost a copy.
+ *
+ * Samples are only ever appended, so a write never changes a converted sample: it makes
+ * the cached copy of the block it extends stale from the first new sample on, and the
+ * next read of that block converts only the new tail. Cached blocks that the ring
+ * overwrites are dropped.
+ *
+ * @note A store is not thread-safe; the caller serializes writes and reads.
+ */
+
+
+#ifndef _THERMOCOUPLE_CHANNEL_H
+#define _THERMOCOUPLE_CHANNEL_H
+
+/* ------------------------------------- Includes ------------------------------------- */
+
+#include "thermocouple_sensor.h"    ///< Thermocouple types and batch conversions
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/* -------------------------------------- Defines ------------------------------------- */
+
+#ifndef TC_CHANNEL_BLOCK_SIZE
+#define  TC_CHANNEL_BLOCK_SIZE      1024U    ///< Samples per block
+#endif
+#ifndef TC_CHANNEL_CACHE_BLOCKS
+#define  TC_CHANNEL_CACHE_BLOCKS    16U      ///< Converted blocks kept
+#endif
+
+
+/* --------------------------------------- Types -------------------------------------- */
+
+/** @brief One converted block */
+typedef struct
+{
+    double *pTemperature;    /**< @c TC_CHANNEL_BLOCK_SIZE temperatures in °C */
+    uint64_t block;          /**< Index of the cached block */
+    uint64_t used;           /**< Read tick of the last use, for LRU replacement */
+    size_t rows;             /**< Leading samples of the block converted; 0 if the entry is free */
+    size_t failed;           /**< Of those, samples set to @c TC_CONVERSION_FAILED */
+} ChannelCacheEntry;
+
+/** @brief Raw voltages of one channel with a cache of converted blocks */
+typedef struct
+{
+    ThermocoupleType type;                                /**< Thermocouple type */
+    ConversionMode mode;                                  /**< Conversion mode of reads */
+    double *pVoltage;                                     /**< Ring of @c ringBlocks blocks of voltages in mV */
+    size_t ringBlocks;                                    /**< Blocks in the ring */
+    uint64_t samples;                                     /**< Samples written */
+    uint64_t tick;                                        /**< Read counter */
+    uint64_t converted;                                   /**< Samples converted so far */
+    ChannelCacheEntry cache[TC_CHANNEL_CACHE_BLOCKS];     /**< Converted blocks */
+} ChannelStore;
+
+
+/* ------------------------------------- Prototype ------------------------------------- */
+
+/**
+ * @brief  Creates an empty store.
+ *
+ * @param[out] pStore    Store to initialize.
+ * @param[in]  type      Thermocouple type as defined in the @c ThermocoupleType enum.
+ * @param[in]  mode      @c TC_MODE_FAST or @c TC_MODE_EXACT.
+ * @param[in]  capacity  Samples retained, rounded up to whole blocks; at least two blocks are kept.
+ *
+ * @return 1 on success, or 0 on allocation failure.
+ */
+uint8_t TC_Channel_Init(ChannelStore *pStore, ThermocoupleType type, ConversionMode mode, size_t capacity);
+
+/**
+ * @brief  Releases the memory of a store.
+ *
+ * @param[in] pStore  Store.
+ */
+void TC_Channel_Destroy(ChannelStore *pStore);
+
+/**
+ * @brief  Appends voltages, overwriting the oldest blocks when the ring is full.
+ *
+ * @param[in] pStore    Store.
+ * @param[in] pVoltage  @p count voltages in mV.
+ * @param[in] count     Number of samples.
+ */
+void TC_Channel_Write(ChannelStore *pStore, const double *pVoltage, size_t count);
+
+/**
+ * @brief  Returns the first sample still retained.
+ *
+ * @details
+ * Retention is by whole blocks: once the ring is full, starting a new block drops the
+ * oldest one.
+ *
+ * @param[in] pStore  Store.
+ *
+ * @return Index of the oldest readable sample; equals @c samples if the store is empty.
+ */
+uint64_t TC_Channel_Oldest(const ChannelStore *pStore);
+
+/**
+ * @brief  Returns the temperatures of one block, converting what is not cached yet.
+ *
+ * @param[in]  pStore   Store.
+ * @param[in]  block    Block index; sample @c s is in block @c s / @c TC_CHANNEL_BLOCK_SIZE.
+ * @param[out] pRows    Receives the samples in the block.
+ * @param[out] pFailed  Optional; receives the samples of the block set to @c TC_CONVERSION_FAILED.
+ *
+ * @return Temperatures in °C, valid until the next call on the store, or @c NULL if the
+ *         block is not retained.
+ */
+const double *TC_Channel_ReadBlock(ChannelStore *pStore, uint64_t block, size_t *pRows, size_t *pFailed);
+
+/**
+ * @brief  Copies the temperatures of a range of samples.
+ *
+ * @param[in]  pStore        Store.
+ * @param[in]  first         First sample (>= @ref TC_Channel_Oldest).
+ * @param[out] pTemperature  Receives up to @p count temperatures in °C.
+ * @param[in]  count         Samples wanted.
+ * @param[out] pFailed       Optional; receives the samples set to @c TC_CONVERSION_FAILED.
+ *
+ * @return Samples copied; fewer than @p count at the newest sample, and 0 if @p first
+ *         is no longer retained.
+ */
+size_t TC_Channel_Read(ChannelStore *pStore, uint64_t first, double *pTemperature, size_t count, size_t *pFailed);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* thermocouple_channel.h */
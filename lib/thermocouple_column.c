@@ -0,0 +1,525 @@
+/**
+ * @file    thermocouple_column.c
+ * @author  Amirhossein Askari
+ * @version v1.0.0
+ * @date    2026-10-16
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Source file for the columnar block recording format.
+ *
+ * @details
+ * The writer de-interleaves incoming frames into one column per channel. When a block is
+ * full it converts each column once with @c TC_CalculateTemperatureArray (@c TC_MODE_FAST)
+ * to obtain the °C statistics, and writes the block with the raw voltages.
+ */
+
+
+/* ------------------------------------- Includes -------------------------------------- */
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE                  ///< POSIX declarations (open, mmap) in ISO C modes
+#endif
+#include "thermocouple_column.h"    ///< Header file for the columnar format
+#include <fcntl.h>                  ///< open
+#include <stdlib.h>                 ///< malloc, free
+#include <string.h>                 ///< memset
+#include <sys/mman.h>               ///< mmap
+#include <sys/stat.h>               ///< fstat
+#include <unistd.h>                 ///< close
+
+
+
+/* ------------------------------------- Functions ------------------------------------- */
+
+/**
+ * @brief  Returns the size of a block in bytes.
+ *
+ * @param[in] channels  Number of channels.
+ * @param[in] rows      Rows in the block.
+ *
+ * @return Block size.
+ */
+static size_t Column_BlockBytes(size_t channels, size_t rows)
+{
+    return sizeof(ColumnBlockHeader) + (channels * (sizeof(ColumnStats) + (rows * sizeof(double))));
+}
+
+/**
+ * @brief  Checks that every block header agrees with the file header.
+ *
+ * @details
+ * The readers index columns by the stored row count, so a block claiming more rows than
+ * the file header allows would send them past the block and the conversion scratch.
+ *
+ * @param[in] pMap        Mapped file, at least as large as the blocks described.
+ * @param[in] blocks      Number of blocks.
+ * @param[in] blockBytes  Size of a full block.
+ * @param[in] tail        Rows in the last block.
+ *
+ * @return 1 if block @c k starts at row @c k * @c blockRows and holds @c blockRows rows,
+ *         or @p tail for the last block, otherwise 0.
+ */
+static uint8_t Column_CheckBlocks(const uint8_t *pMap, size_t blocks, size_t blockBytes, size_t tail)
+{
+    const size_t rows = ((const ColumnFileHeader *)pMap)->blockRows;
+    uint8_t ok = 1U;
+    size_t k;
+
+    for (k = 0U; (ok != 0U) && (k < blocks); ++k)
+    {
+        const ColumnBlockHeader *pBlock =
+            (const ColumnBlockHeader *)&pMap[sizeof(ColumnFileHeader) + (k * blockBytes)];
+
+        if ((pBlock->firstRow != ((uint64_t)k * rows)) || (pBlock->rows != (((k + 1U) < blocks) ? rows : tail)))
+        {
+            ok = 0U;
+        }
+    }
+
+    return ok;
+}
+
+/**
+ * @brief  Computes the statistics of one column.
+ *
+ * @param[out] pStats        Statistics.
+ * @param[in]  pVoltage      Voltages.
+ * @param[in]  pTemperature  Their conversions.
+ * @param[in]  rows          Number of rows.
+ */
+static void Column_Stats(ColumnStats *pStats, const double *pVoltage, const double *pTemperature, size_t rows)
+{
+    size_t i;
+
+    (void)memset(pStats, 0, sizeof(*pStats));
+    pStats->minVoltage     = pVoltage[0];
+    pStats->maxVoltage     = pVoltage[0];
+    pStats->minTemperature = TC_CONVERSION_FAILED;
+    pStats->maxTemperature = TC_CONVERSION_FAILED;
+
+    for (i = 0U; i < rows; ++i)
+    {
+        pStats->minVoltage = (pVoltage[i] < pStats->minVoltage) ? pVoltage[i] : pStats->minVoltage;
+        pStats->maxVoltage = (pVoltage[i] > pStats->maxVoltage) ? pVoltage[i] : pStats->maxVoltage;
+
+        if (pTemperature[i] != TC_CONVERSION_FAILED)
+        {
+            if (pStats->valid == 0U)
+            {
+                pStats->minTemperature = pTemperature[i];
+                pStats->maxTemperature = pTemperature[i];
+            }
+            pStats->minTemperature = (pTemperature[i] < pStats->minTemperature) ? pTemperature[i] : pStats->minTemperature;
+            pStats->maxTemperature = (pTemperature[i] > pStats->maxTemperature) ? pTemperature[i] : pStats->maxTemperature;
+            pStats->valid++;
+        }
+    }
+}
+
+/**
+ * @brief  Writes the current block and starts a new one.
+ *
+ * @param[in] pWriter  Writer with at least one row in the current block.
+ *
+ * @return 1 on success, or 0 on a write error.
+ */
+static uint8_t Column_Flush(ColumnWriter *pWriter)
+{
+    const size_t channels = pWriter->header.channelCount;
+    const size_t capacity = pWriter->header.blockRows;
+    ColumnStats stats[TC_COLUMN_MAX_CHANNELS];
+    ColumnBlockHeader block;
+    uint8_t ok;
+    size_t c;
+
+    block.firstRow = pWriter->header.rowCount;
+    block.rows     = (uint32_t)pWriter->rows;
+    block.reserved = 0U;
+
+    for (c = 0U; c < channels; ++c)
+    {
+        const double *pColumn = &pWriter->pVoltage[c * capacity];
+
+        (void)TC_CalculateTemperatureArray((ThermocoupleType)pWriter->header.types[c], pColumn, pWriter->pTemperature,
+                                           pWriter->rows, TC_MODE_FAST);
+        Column_Stats(&stats[c], pColumn, pWriter->pTemperature, pWriter->rows);
+    }
+
+    ok = ((fwrite(&block, sizeof(block), 1U, pWriter->pFile) == 1U) &&
+          (fwrite(stats, sizeof(ColumnStats), channels, pWriter->pFile) == channels)) ? 1U : 0U;
+    for (c = 0U; (ok != 0U) && (c < channels); ++c)
+    {
+        ok = (fwrite(&pWriter->pVoltage[c * capacity], sizeof(double), pWriter->rows, pWriter->pFile) == pWriter->rows)
+                 ? 1U : 0U;
+    }
+
+    pWriter->header.rowCount += pWriter->rows;
+    pWriter->rows = 0U;
+
+    return ok;
+}
+
+/**
+ * @brief  Creates a columnar file.
+ *
+ * @param[out] pWriter       Writer to initialize.
+ * @param[in]  pPath         Output path.
+ * @param[in]  channelCount  Number of channels (1 .. @c TC_COLUMN_MAX_CHANNELS).
+ * @param[in]  pTypes        Thermocouple type of each channel.
+ * @param[in]  blockRows     Rows per block, or 0 for @c TC_COLUMN_BLOCK_ROWS.
+ *
+ * @return 1 on success, otherwise 0.
+ */
+uint8_t TC_ColumnWriter_Open(ColumnWriter *pWriter, const char *pPath, size_t channelCount,
+                             const ThermocoupleType *pTypes, size_t blockRows)
+{
+    uint8_t result = 0U;
+    size_t c;
+
+    if (blockRows == 0U)
+    {
+        blockRows = TC_COLUMN_BLOCK_ROWS;
+    }
+
+    if ((pWriter != NULL) && (pPath != NULL) && (pTypes != NULL) && (channelCount != 0U) &&
+        (channelCount <= TC_COLUMN_MAX_CHANNELS) && (blockRows <= UINT32_MAX))
+    {
+        (void)memset(pWriter, 0, sizeof(*pWriter));
+        pWriter->header.magic        = TC_COLUMN_MAGIC;
+        pWriter->header.version      = (uint16_t)TC_COLUMN_VERSION;
+        pWriter->header.channelCount = (uint16_t)channelCount;
+        pWriter->header.blockRows    = (uint32_t)blockRows;
+        for (c = 0U; c < channelCount; ++c)
+        {
+            pWriter->header.types[c] = (uint8_t)pTypes[c];
+        }
+
+        pWriter->pVoltage     = (double *)malloc(channelCount * blockRows * sizeof(double));
+        pWriter->pTemperature = (double *)malloc(blockRows * sizeof(double));
+        pWriter->pFile        = fopen(pPath, "wb");
+
+        /* The header is written again with the final row count on close */
+        if ((pWriter->pVoltage != NULL) && (pWriter->pTemperature != NULL) && (pWriter->pFile != NULL) &&
+            (fwrite(&pWriter->header, sizeof(pWriter->header), 1U, pWriter->pFile) == 1U))
+        {
+            result = 1U;
+        }
+        else
+        {
+            if (pWriter->pFile != NULL)
+            {
+                (void)fclose(pWriter->pFile);
+            }
+            free(pWriter->pTemperature);
+            free(pWriter->pVoltage);
+        }
+    }
+
+    return result;
+}
+
+/**
+ * @brief  Appends frames of interleaved channel voltages.
+ *
+ * @param[in] pWriter     Writer.
+ * @param[in] pFrames     @p frameCount frames of @c channelCount voltages in mV.
+ * @param[in] frameCount  Number of frames.
+ *
+ * @return 1 on success, or 0 on a write error.
+ */
+uint8_t TC_ColumnWriter_Append(ColumnWriter *pWriter, const double *pFrames, size_t frameCount)
+{
+    const size_t channels = pWriter->header.channelCount;
+    const size_t capacity = pWriter->header.blockRows;
+    uint8_t ok = 1U;
+    size_t f   = 0U;
+    size_t c;
+
+    while ((ok != 0U) && (f < frameCount))
+    {
+        const size_t n = ((frameCount - f) < (capacity - pWriter->rows)) ? (frameCount - f) : (capacity - pWriter->rows);
+        size_t i;
+
+        /* Column by column, so each store stream is sequential */
+        for (c = 0U; c < channels; ++c)
+        {
+            double *pColumn       = &pWriter->pVoltage[(c * capacity) + pWriter->rows];
+            const double *pSource = &pFrames[(f * channels) + c];
+
+            for (i = 0U; i < n; ++i)
+            {
+                pColumn[i] = pSource[i * channels];
+            }
+        }
+
+        pWriter->rows += n;
+        f += n;
+        if (pWriter->rows == capacity)
+        {
+            ok = Column_Flush(pWriter);
+        }
+    }
+
+    return ok;
+}
+
+/**
+ * @brief  Writes the last block and the final header, then closes the file.
+ *
+ * @param[in] pWriter  Writer.
+ *
+ * @return 1 on success, or 0 on a write error.
+ */
+uint8_t TC_ColumnWriter_Close(ColumnWriter *pWriter)
+{
+    uint8_t ok = 1U;
+
+    if (pWriter->rows != 0U)
+    {
+        ok = Column_Flush(pWriter);
+    }
+
+    if ((ok != 0U) && ((fseek(pWriter->pFile, 0L, SEEK_SET) != 0) ||
+                       (fwrite(&pWriter->header, sizeof(pWriter->header), 1U, pWriter->pFile) != 1U)))
+    {
+        ok = 0U;
+    }
+    if (fclose(pWriter->pFile) != 0)
+    {
+        ok = 0U;
+    }
+
+    free(pWriter->pTemperature);
+    free(pWriter->pVoltage);
+    pWriter->pFile = NULL;
+
+    return ok;
+}
+
+/**
+ * @brief  Opens and maps a columnar file.
+ *
+ * @param[out] pReader  Reader to initialize.
+ * @param[in]  pPath    File path.
+ *
+ * @details
+ * Every block header is checked against the file header, so the accessors below can trust
+ * the stored row counts.
+ *
+ * @return 1 on success, or 0 if the file is missing, truncated or not a columnar file.
+ */
+uint8_t TC_ColumnReader_Open(ColumnReader *pReader, const char *pPath)
+{
+    struct stat info;
+    uint8_t result = 0U;
+    void *pMap     = MAP_FAILED;
+    const int fd   = open(pPath, O_RDONLY);
+
+    if ((fd >= 0) && (fstat(fd, &info) == 0) && ((size_t)info.st_size >= sizeof(ColumnFileHeader)))
+    {
+        pMap = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    }
+    if (fd >= 0)
+    {
+        (void)close(fd);
+    }
+
+    if (pMap != MAP_FAILED)
+    {
+        const ColumnFileHeader *pHeader = (const ColumnFileHeader *)pMap;
+        const size_t channels = pHeader->channelCount;
+        const size_t rows     = pHeader->blockRows;
+
+        if ((pHeader->magic == TC_COLUMN_MAGIC) && (pHeader->version == TC_COLUMN_VERSION) && (channels != 0U) &&
+            (channels <= TC_COLUMN_MAX_CHANNELS) && (rows != 0U))
+        {
+            /* Count the blocks the file has room for first, so a bogus row count cannot
+               overflow the size computation */
+            const size_t full     = Column_BlockBytes(channels, rows);
+            const size_t room     = (((size_t)info.st_size - sizeof(ColumnFileHeader)) / full) + 1U;
+            const uint64_t wanted = (pHeader->rowCount / rows) + (((pHeader->rowCount % rows) != 0U) ? 1U : 0U);
+            const size_t blocks   = (wanted <= (uint64_t)room) ? (size_t)wanted : 0U;
+            const size_t tail     = (size_t)(pHeader->rowCount - ((blocks != 0U) ? ((uint64_t)(blocks - 1U) * rows) : 0U));
+            const size_t size     = sizeof(ColumnFileHeader) +
+                                    ((blocks != 0U) ? (((blocks - 1U) * full) + Column_BlockBytes(channels, tail)) : 0U);
+
+            const size_t largest  = (blocks > 1U) ? rows : ((tail != 0U) ? tail : 1U);
+
+            /* The scratch is sized from the blocks the file really holds, so a bogus
+               blockRows cannot request more memory than the file spans */
+            pReader->pScratch = NULL;
+            if ((blocks == wanted) && (size <= (size_t)info.st_size) &&
+                (Column_CheckBlocks((const uint8_t *)pMap, blocks, full, tail) != 0U))
+            {
+                pReader->pScratch = (double *)malloc(largest * sizeof(double));
+            }
+            if (pReader->pScratch != NULL)
+            {
+                pReader->pMap       = (const uint8_t *)pMap;
+                pReader->mapSize    = (size_t)info.st_size;
+                pReader->pHeader    = pHeader;
+                pReader->blockCount = blocks;
+                pReader->blockBytes = full;
+                result = 1U;
+            }
+        }
+
+        if (result == 0U)
+        {
+            (void)munmap(pMap, (size_t)info.st_size);
+        }
+    }
+
+    return result;
+}
+
+/**
+ * @brief  Unmaps the file.
+ *
+ * @param[in] pReader  Reader.
+ */
+void TC_ColumnReader_Close(ColumnReader *pReader)
+{
+    if ((pReader != NULL) && (pReader->pMap != NULL))
+    {
+        (void)munmap((void *)pReader->pMap, pReader->mapSize);
+        free(pReader->pScratch);
+        pReader->pMap     = NULL;
+        pReader->pScratch = NULL;
+    }
+}
+
+/**
+ * @brief  Returns the statistics of one channel in one block, without reading the samples.
+ *
+ * @param[in]  pReader    Reader.
+ * @param[in]  block      Block index (< @c blockCount).
+ * @param[in]  channel    Channel index.
+ * @param[out] pFirstRow  Optional; receives the block's first row.
+ * @param[out] pRows      Optional; receives the number of rows in the block.
+ *
+ * @return Statistics.
+ */
+const ColumnStats *TC_ColumnReader_Stats(const ColumnReader *pReader, size_t block, size_t channel,
+                                         uint64_t *pFirstRow, size_t *pRows)
+{
+    const uint8_t *pBlock = &pReader->pMap[sizeof(ColumnFileHeader) + (block * pReader->blockBytes)];
+    const ColumnBlockHeader *pHeader = (const ColumnBlockHeader *)pBlock;
+
+    if (pFirstRow != NULL)
+    {
+        *pFirstRow = pHeader->firstRow;
+    }
+    if (pRows != NULL)
+    {
+        *pRows = pHeader->rows;
+    }
+
+    return &((const ColumnStats *)&pBlock[sizeof(ColumnBlockHeader)])[channel];
+}
+
+/**
+ * @brief  Returns the raw voltage column of one channel in one block.
+ *
+ * @param[in]  pReader  Reader.
+ * @param[in]  block    Block index.
+ * @param[in]  channel  Channel index.
+ * @param[out] pRows    Receives the number of rows.
+ *
+ * @return Voltages in mV, in place in the mapping.
+ */
+const double *TC_ColumnReader_Voltages(const ColumnReader *pReader, size_t block, size_t channel, size_t *pRows)
+{
+    const size_t channels = pReader->pHeader->channelCount;
+    const uint8_t *pBlock = &pReader->pMap[sizeof(ColumnFileHeader) + (block * pReader->blockBytes)];
+    const size_t rows     = ((const ColumnBlockHeader *)pBlock)->rows;
+
+    *pRows = rows;
+
+    return &((const double *)&pBlock[sizeof(ColumnBlockHeader) + (channels * sizeof(ColumnStats))])[channel * rows];
+}
+
+/**
+ * @brief  Converts the column of one channel in one block.
+ *
+ * @param[in]  pReader       Reader.
+ * @param[in]  block         Block index.
+ * @param[in]  channel       Channel index.
+ * @param[in]  mode          Conversion mode as defined in the @c ConversionMode enum.
+ * @param[out] pTemperature  Receives @c blockRows temperatures at most.
+ * @param[out] pRows         Receives the number of rows.
+ *
+ * @return Number of samples set to @c TC_CONVERSION_FAILED.
+ */
+size_t TC_ColumnReader_Temperatures(const ColumnReader *pReader, size_t block, size_t channel, ConversionMode mode,
+                                    double *pTemperature, size_t *pRows)
+{
+    const double *pVoltage = TC_ColumnReader_Voltages(pReader, block, channel, pRows);
+
+    return TC_CalculateTemperatureArray((ThermocoupleType)pReader->pHeader->types[channel], pVoltage, pTemperature,
+                                        *pRows, mode);
+}
+
+/**
+ * @brief  Finds the samples of a channel within a temperature range.
+ *
+ * @details
+ * Blocks whose °C statistics do not overlap the range are skipped; the others are
+ * converted in @c TC_MODE_FAST, the mode of the statistics, and scanned.
+ *
+ * @param[in]  pReader          Reader.
+ * @param[in]  channel          Channel index.
+ * @param[in]  minTemperature   Lower bound in °C (inclusive).
+ * @param[in]  maxTemperature   Upper bound in °C (inclusive).
+ * @param[in]  callback         Called for each matching sample, in row order; may be NULL.
+ * @param[in]  pContext         Passed to @p callback.
+ * @param[out] pBlocksConverted Optional; receives the number of blocks converted.
+ *
+ * @return Number of matching samples.
+ */
+size_t TC_ColumnReader_Query(ColumnReader *pReader, size_t channel, double minTemperature, double maxTemperature,
+                             ColumnMatchCallback callback, void *pContext, size_t *pBlocksConverted)
+{
+    size_t matches   = 0U;
+    size_t converted = 0U;
+    size_t b;
+    size_t i;
+
+    for (b = 0U; (channel < pReader->pHeader->channelCount) && (b < pReader->blockCount); ++b)
+    {
+        uint64_t firstRow;
+        size_t rows;
+        const ColumnStats *pStats = TC_ColumnReader_Stats(pReader, b, channel, &firstRow, &rows);
+
+        if ((pStats->valid != 0U) && (pStats->maxTemperature >= minTemperature) &&
+            (pStats->minTemperature <= maxTemperature))
+        {
+            (void)TC_ColumnReader_Temperatures(pReader, b, channel, TC_MODE_FAST, pReader->pScratch, &rows);
+            converted++;
+
+            for (i = 0U; i < rows; ++i)
+            {
+                const double t = pReader->pScratch[i];
+
+                if ((t != TC_CONVERSION_FAILED) && (t >= minTemperature) && (t <= maxTemperature))
+                {
+                    matches++;
+                    if (callback != NULL)
+                    {
+                        callback(pContext, firstRow + i, t);
+                    }
+                }
+            }
+        }
+    }
+
+    if (pBlocksConverted != NULL)
+    {
+        *pBlocksConverted = converted;
+    }
+
+    return matches;
+}
+
+
+/* thermocouple_column.c */
@@ -0,0 +1,233 @@
+/**
+ * @file    thermocouple_column.h
+ * @author  Amirhossein Askari
+ * @version v1.0.0
+ * @date    2026-10-16
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Header file for the columnar block recording format.
+ *
+ * @details
+ * A recording of several channels is stored as a sequence of blocks of @c blockRows
+ * rows. Each block holds one column of raw voltages (mV) per channel, preceded by
+ * per-channel statistics: minimum and maximum in mV and in °C. The mV-to-°C mapping of
+ * every thermocouple type is monotonic, so a temperature query can reject a whole block
+ * from its statistics without touching the samples. Only the columns of the blocks that
+ * may match are converted, through the batch path.
+ *
+ * File layout (native byte order):
+ *  - @c ColumnFileHeader
+ *  - blocks, each: @c ColumnBlockHeader, @c channelCount x @c ColumnStats, then
+ *    @c channelCount columns of @c rows doubles. All blocks but the last hold
+ *    @c blockRows rows, so block @c k starts at a fixed offset.
+ *
+ * @note The reader maps the file with POSIX @c mmap.
+ */
+
+
+#ifndef _THERMOCOUPLE_COLUMN_H
+#define _THERMOCOUPLE_COLUMN_H
+
+/* ------------------------------------- Includes ------------------------------------- */
+
+#include <stdio.h>                  ///< FILE
+#include "thermocouple_sensor.h"    ///< Thermocouple types and batch conversions
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/* -------------------------------------- Defines ------------------------------------- */
+
+#define  TC_COLUMN_MAGIC         0x31435443U    ///< "TCC1"
+#define  TC_COLUMN_VERSION       1U             ///< Layout version
+#define  TC_COLUMN_MAX_CHANNELS  64U            ///< Channels per file
+#define  TC_COLUMN_BLOCK_ROWS    4096U          ///< Default rows per block
+
+
+/* --------------------------------------- Types -------------------------------------- */
+
+/** @brief Header at the start of the file */
+typedef struct
+{
+    uint32_t magic;                             /**< @c TC_COLUMN_MAGIC */
+    uint16_t version;                           /**< @c TC_COLUMN_VERSION */
+    uint16_t channelCount;                      /**< Number of channels */
+    uint32_t blockRows;                         /**< Rows per full block */
+    uint32_t reserved;                          /**< Zero */
+    uint64_t rowCount;                          /**< Rows in the file */
+    uint8_t types[TC_COLUMN_MAX_CHANNELS];      /**< @c ThermocoupleType of each channel */
+} ColumnFileHeader;
+
+/** @brief Header of each block */
+typedef struct
+{
+    uint64_t firstRow;    /**< Index of the block's first row */
+    uint32_t rows;        /**< Rows in the block */
+    uint32_t reserved;    /**< Zero */
+} ColumnBlockHeader;
+
+/** @brief Statistics of one channel in one block */
+typedef struct
+{
+    double minVoltage;        /**< Smallest voltage in mV */
+    double maxVoltage;        /**< Largest voltage in mV */
+    double minTemperature;    /**< Smallest converted temperature in °C, or @c TC_CONVERSION_FAILED */
+    double maxTemperature;    /**< Largest converted temperature in °C, or @c TC_CONVERSION_FAILED */
+    uint32_t valid;           /**< Samples that convert successfully */
+    uint32_t reserved;        /**< Zero */
+} ColumnStats;
+
+/** @brief Writer of a columnar file */
+typedef struct
+{
+    FILE *pFile;                  /**< Output file */
+    ColumnFileHeader header;      /**< File header, rewritten on close */
+    double *pVoltage;             /**< Current block, one column of @c blockRows per channel */
+    double *pTemperature;         /**< Conversion scratch of @c blockRows samples */
+    size_t rows;                  /**< Rows in the current block */
+} ColumnWriter;
+
+/** @brief Reader of a columnar file */
+typedef struct
+{
+    const uint8_t *pMap;                /**< Mapped file */
+    size_t mapSize;                     /**< Size of the mapping */
+    const ColumnFileHeader *pHeader;    /**< File header */
+    size_t blockCount;                  /**< Number of blocks */
+    size_t blockBytes;                  /**< Size of a full block */
+    double *pScratch;                   /**< Conversion scratch, as long as the largest block */
+} ColumnReader;
+
+/**
+ * @brief  Called by @ref TC_ColumnReader_Query for each matching sample.
+ *
+ * @param[in] pContext     Caller context.
+ * @param[in] row          Row index in the file.
+ * @param[in] temperature  Temperature in degrees Celsius.
+ */
+typedef void (*ColumnMatchCallback)(void *pContext, uint64_t row, double temperature);
+
+
+/* ------------------------------------- Prototype ------------------------------------- */
+
+/**
+ * @brief  Creates a columnar file.
+ *
+ * @param[out] pWriter       Writer to initialize.
+ * @param[in]  pPath         Output path.
+ * @param[in]  channelCount  Number of channels (1 .. @c TC_COLUMN_MAX_CHANNELS).
+ * @param[in]  pTypes        Thermocouple type of each channel.
+ * @param[in]  blockRows     Rows per block, or 0 for @c TC_COLUMN_BLOCK_ROWS.
+ *
+ * @return 1 on success, otherwise 0.
+ */
+uint8_t TC_ColumnWriter_Open(ColumnWriter *pWriter, const char *pPath, size_t channelCount,
+                             const ThermocoupleType *pTypes, size_t blockRows);
+
+/**
+ * @brief  Appends frames of interleaved channel voltages.
+ *
+ * @param[in] pWriter     Writer.
+ * @param[in] pFrames     @p frameCount frames of @c channelCount voltages in mV.
+ * @param[in] frameCount  Number of frames.
+ *
+ * @return 1 on success, or 0 on a write error.
+ */
+uint8_t TC_ColumnWriter_Append(ColumnWriter *pWriter, const double *pFrames, size_t frameCount);
+
+/**
+ * @brief  Writes the last block and the final header, then closes the file.
+ *
+ * @param[in] pWriter  Writer.
+ *
+ * @return 1 on success, or 0 on a write error.
+ */
+uint8_t TC_ColumnWriter_Close(ColumnWriter *pWriter);
+
+/**
+ * @brief  Opens and maps a columnar file.
+ *
+ * @param[out] pReader  Reader to initialize.
+ * @param[in]  pPath    File path.
+ *
+ * @return 1 on success, or 0 if the file is missing, truncated or not a columnar file.
+ */
+uint8_t TC_ColumnReader_Open(ColumnReader *pReader, const char *pPath);
+
+/**
+ * @brief  Unmaps the file.
+ *
+ * @param[in] pReader  Reader.
+ */
+void TC_ColumnReader_Close(ColumnReader *pReader);
+
+/**
+ * @brief  Returns the statistics of one channel in one block, without reading the samples.
+ *
+ * @param[in]  pReader    Reader.
+ * @param[in]  block      Block index (< @c blockCount).
+ * @param[in]  channel    Channel index.
+ * @param[out] pFirstRow  Optional; receives the block's first row.
+ * @param[out] pRows      Optional; receives the number of rows in the block.
+ *
+ * @return Statistics.
+ */
+const ColumnStats *TC_ColumnReader_Stats(const ColumnReader *pReader, size_t block, size_t channel,
+                                         uint64_t *pFirstRow, size_t *pRows);
+
+/**
+ * @brief  Returns the raw voltage column of one channel in one block.
+ *
+ * @param[in]  pReader  Reader.
+ * @param[in]  block    Block index.
+ * @param[in]  channel  Channel index.
+ * @param[out] pRows    Receives the number of rows.
+ *
+ * @return Voltages in mV, in place in the mapping.
+ */
+const double *TC_ColumnReader_Voltages(const ColumnReader *pReader, size_t block, size_t channel, size_t *pRows);
+
+/**
+ * @brief  Converts the column of one channel in one block.
+ *
+ * @param[in]  pReader       Reader.
+ * @param[in]  block         Block index.
+ * @param[in]  channel       Channel index.
+ * @param[in]  mode          Conversion mode as defined in the @c ConversionMode enum.
+ * @param[out] pTemperature  Receives @c blockRows temperatures at most.
+ * @param[out] pRows         Receives the number of rows.
+ *
+ * @return Number of samples set to @c TC_CONVERSION_FAILED.
+ */
+size_t TC_ColumnReader_Temperatures(const ColumnReader *pReader, size_t block, size_t channel, ConversionMode mode,
+                                    double *pTemperature, size_t *pRows);
+
+/**
+ * @brief  Finds the samples of a channel within a temperature range.
+ *
+ * @details
+ * Blocks whose °C statistics do not overlap the range are skipped; the others are
+ * converted in @c TC_MODE_FAST, the mode of the statistics, and scanned.
+ *
+ * @param[in]  pReader          Reader.
+ * @param[in]  channel          Channel index.
+ * @param[in]  minTemperature   Lower bound in °C (inclusive).
+ * @param[in]  maxTemperature   Upper bound in °C (inclusive).
+ * @param[in]  callback         Called for each matching sample, in row order; may be NULL.
+ * @param[in]  pContext         Passed to @p callback.
+ * @param[out] pBlocksConverted Optional; receives the number of blocks converted.
+ *
+ * @return Number of matching samples.
+ */
+size_t TC_ColumnReader_Query(ColumnReader *pReader, size_t channel, double minTemperature, double maxTemperature,
+                             ColumnMatchCallback callback, void *pContext, size_t *pBlocksConverted);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* thermocouple_column.h */
@@ -0,0 +1,221 @@
+/**
+ * @file    thermocouple_frame.c
+ * @author  Amirhossein Askari
+ * @version v1.0.0
+ * @date    2026-10-16
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Source file for multi-channel frame conversions.
+ * 
+ * @details
+ * Implements the conversion of interleaved multi-channel frames on top of the
+ * strided batch conversion of @c thermocouple_sensor.c.
+ */
+
+
+/* ------------------------------------- Includes -------------------------------------- */
+
+#include "thermocouple_frame.h"    ///< Header file for frame conversions
+#include <string.h>                ///< memcpy for strided access
+
+
+
+/* ------------------------------------- Functions ------------------------------------- */
+
+/**
+ * @brief  Calculates temperatures for frames of interleaved channels.
+ *
+ * @details
+ * Converts one channel (column) at a time with @ref TC_CalculateTemperatureStrided.
+ *
+ * @param[in]  pTypes             Thermocouple type of each channel.
+ * @param[in]  channels           Number of channels per frame.
+ * @param[in]  pVoltage           First channel of the first frame, in millivolts (mV).
+ * @param[in]  voltageStride      Distance between consecutive input frames in bytes.
+ * @param[out] pTemperature       First channel of the first output frame, in degrees Celsius.
+ * @param[in]  temperatureStride  Distance between consecutive output frames in bytes.
+ * @param[in]  frames             Number of frames.
+ * @param[in]  mode               Conversion mode as defined in the @c ConversionMode enum.
+ *
+ * @return Number of samples set to @c TC_CONVERSION_FAILED.
+ */
+size_t TC_CalculateTemperatureFrames(const ThermocoupleType *pTypes, size_t channels,
+                                     const double *pVoltage, size_t voltageStride,
+                                     double *pTemperature, size_t temperatureStride,
+                                     size_t frames, ConversionMode mode)
+{
+    size_t failed = 0U;
+    size_t c;
+
+    if ((pTypes == NULL) || (pVoltage == NULL) || (pTemperature == NULL))
+    {
+        failed = channels * frames;
+    }
+    else
+    {
+        for (c = 0U; c < channels; ++c)
+        {
+            failed += TC_CalculateTemperatureStrided(pTypes[c], &pVoltage[c], voltageStride,
+                                                     &pTemperature[c], temperatureStride, frames, mode);
+        }
+    }
+
+    return failed;
+}
+
+/**
+ * @brief  Configures a frame converter for a fixed channel-to-type map.
+ *
+ * @details
+ * Builds the channel permutation with a counting sort on the type, which keeps
+ * the channels of each type in scan order.
+ *
+ * @param[out] pConverter  Converter to configure.
+ * @param[in]  pTypes      Thermocouple type of each channel.
+ * @param[in]  channels    Number of channels per frame; at most @c TC_FRAME_MAX_CHANNELS.
+ * @param[in]  mode        Conversion mode as defined in the @c ConversionMode enum.
+ *
+ * @return 1 on success, or 0 if an argument or a channel type is invalid.
+ */
+uint8_t TC_FrameConverter_Init(FrameConverter *pConverter, const ThermocoupleType *pTypes, size_t channels,
+                               ConversionMode mode)
+{
+    uint16_t next[TC_FRAME_TYPE_COUNT];
+    uint8_t result = 1U;
+    size_t t;
+    size_t c;
+
+    if ((pConverter == NULL) || (pTypes == NULL) || (channels > TC_FRAME_MAX_CHANNELS))
+    {
+        result = 0U;
+    }
+    else
+    {
+        for (c = 0U; c < channels; ++c)
+        {
+            if ((size_t)pTypes[c] >= TC_FRAME_TYPE_COUNT)
+            {
+                result = 0U;
+            }
+        }
+    }
+
+    if (result != 0U)
+    {
+        for (t = 0U; t <= TC_FRAME_TYPE_COUNT; ++t)
+        {
+            pConverter->groupStart[t] = 0U;
+        }
+        for (c = 0U; c < channels; ++c)
+        {
+            pConverter->groupStart[(size_t)pTypes[c] + 1U]++;
+        }
+        for (t = 0U; t < TC_FRAME_TYPE_COUNT; ++t)
+        {
+            pConverter->groupStart[t + 1U] += pConverter->groupStart[t];
+            next[t] = pConverter->groupStart[t];
+        }
+        for (c = 0U; c < channels; ++c)
+        {
+            pConverter->order[next[pTypes[c]]] = (uint16_t)c;
+            next[pTypes[c]]++;
+        }
+
+        pConverter->channels = channels;
+        pConverter->mode     = mode;
+    }
+
+    return result;
+}
+
+/**
+ * @brief  Calculates temperatures for frames using a configured frame converter.
+ *
+ * @details
+ * Walks the frames in chunks of @c TC_FRAME_GATHER_SIZE / channels frames, so every type
+ * group of a chunk fits in the gather buffer. Within a chunk, each group is gathered,
+ * converted in one batch and scattered back while the chunk's frames are still in cache,
+ * so the acquisition buffer is streamed once whatever the number of types.
+ *
+ * @param[in]  pConverter         Converter configured by @ref TC_FrameConverter_Init.
+ * @param[in]  pVoltage           First channel of the first frame, in millivolts (mV).
+ * @param[in]  voltageStride      Distance between consecutive input frames in bytes.
+ * @param[out] pTemperature       First channel of the first output frame, in degrees Celsius.
+ * @param[in]  temperatureStride  Distance between consecutive output frames in bytes.
+ * @param[in]  frames             Number of frames.
+ *
+ * @return Number of samples set to @c TC_CONVERSION_FAILED.
+ */
+size_t TC_FrameConverter_Convert(const FrameConverter *pConverter, const double *pVoltage, size_t voltageStride,
+                                 double *pTemperature, size_t temperatureStride, size_t frames)
+{
+    double buffer[TC_FRAME_GATHER_SIZE];
+    const uint8_t *pIn = (const uint8_t *)pVoltage;
+    uint8_t *pOut      = (uint8_t *)pTemperature;
+    size_t failed      = 0U;
+    size_t chunk;
+    size_t frame;
+    size_t t;
+
+    if ((pConverter == NULL) || (pVoltage == NULL) || (pTemperature == NULL))
+    {
+        failed = (pConverter != NULL) ? (pConverter->channels * frames) : 0U;
+    }
+    else if (pConverter->channels > 0U)
+    {
+        /* At least one frame, since TC_FRAME_GATHER_SIZE holds a full frame */
+        chunk = TC_FRAME_GATHER_SIZE / pConverter->channels;
+
+        for (frame = 0U; frame < frames; frame += chunk)
+        {
+            const size_t last = ((frames - frame) < chunk) ? frames : (frame + chunk);
+
+            for (t = 0U; t < TC_FRAME_TYPE_COUNT; ++t)
+            {
+                const uint16_t *pGroup = &pConverter->order[pConverter->groupStart[t]];
+                const size_t groupSize = (size_t)pConverter->groupStart[t + 1U] - (size_t)pConverter->groupStart[t];
+                size_t n = 0U;
+                size_t f;
+                size_t j;
+
+                if (groupSize > 0U)
+                {
+                    /* Gather the channels of this type from the chunk */
+                    for (f = frame; f < last; ++f)
+                    {
+                        const uint8_t *pRow = &pIn[f * voltageStride];
+                        for (j = 0U; j < groupSize; ++j)
+                        {
+                            (void)memcpy(&buffer[n], &pRow[(size_t)pGroup[j] * sizeof(double)], sizeof(double));
+                            ++n;
+                        }
+                    }
+
+                    failed += TC_CalculateTemperatureArray((ThermocoupleType)t, buffer, buffer, n,
+                                                           pConverter->mode);
+
+                    /* Scatter them back */
+                    n = 0U;
+                    for (f = frame; f < last; ++f)
+                    {
+                        uint8_t *pRow = &pOut[f * temperatureStride];
+                        for (j = 0U; j < groupSize; ++j)
+                        {
+                            (void)memcpy(&pRow[(size_t)pGroup[j] * sizeof(double)], &buffer[n], sizeof(double));
+                            ++n;
+                        }
+                    }
+                }
+            }
+        }
+    }
+    else
+    {
+        /* No channels, nothing to convert */
+    }
+
+    return failed;
+}
+
+
+/* thermocouple_frame.c */
@@ -0,0 +1,143 @@
+/**
+ * @file    thermocouple_frame.h
+ * @author  Amirhossein Askari
+ * @version v1.0.0
+ * @date    2026-10-16
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Header file for multi-channel frame conversions.
+ * 
+ * @details
+ * Converts frames of interleaved thermocouple channels, as delivered by a DAQ scan
+ * list, from voltage to temperature. Each channel has its own thermocouple type and
+ * is converted in place in the acquisition buffer through the batch functions of
+ * @c thermocouple_sensor.h.
+ * 
+ * @note
+ * A frame is a run of consecutive @c double channels; frames follow each other at a
+ * fixed byte stride, so arrays of timestamped records are supported as well.
+ */
+
+
+#ifndef _THERMOCOUPLE_FRAME_H
+#define _THERMOCOUPLE_FRAME_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ------------------------------------- Includes ------------------------------------- */
+
+#include "thermocouple_sensor.h"    ///< Thermocouple types and batch conversions
+
+
+/* -------------------------------------- Defines ------------------------------------- */
+
+/** @brief Largest number of channels a @c FrameConverter can be configured with */
+#ifndef TC_FRAME_MAX_CHANNELS
+#define  TC_FRAME_MAX_CHANNELS   256U    ///< Channel capacity of a frame converter
+#endif
+
+/** @brief Number of samples a @c FrameConverter gathers per batch conversion */
+#ifndef TC_FRAME_GATHER_SIZE
+#define  TC_FRAME_GATHER_SIZE    512U    ///< Gather buffer length (stack usage is 8 bytes per sample)
+#endif
+
+/** @brief Number of thermocouple types in the @c ThermocoupleType enum */
+#define  TC_FRAME_TYPE_COUNT     8U      ///< Number of thermocouple types
+
+#if (TC_FRAME_GATHER_SIZE < TC_FRAME_MAX_CHANNELS)
+#error "TC_FRAME_GATHER_SIZE must hold at least one full frame"
+#endif
+
+
+/* --------------------------------------- Types -------------------------------------- */
+
+/** @brief Frame converter grouping the channels of a mixed-type scan list by thermocouple type */
+typedef struct
+{
+    uint16_t order[TC_FRAME_MAX_CHANNELS];              /**< Channel indices sorted by thermocouple type */
+    uint16_t groupStart[TC_FRAME_TYPE_COUNT + 1U];      /**< Start of each type's channels in @c order */
+    size_t channels;                                    /**< Number of channels per frame */
+    ConversionMode mode;                                /**< Conversion mode */
+} FrameConverter;
+
+
+/* ------------------------------------- Prototype ------------------------------------- */
+
+/**
+ * @brief  Calculates temperatures for frames of interleaved channels.
+ *
+ * @details
+ * Channel @c c of frame @c f is read from @p pVoltage at byte offset
+ * @c f * @p voltageStride + @c c * sizeof(double) and converted with thermocouple type
+ * @p pTypes[c]. Every channel is converted as one strided batch, so the type is
+ * resolved once per channel rather than once per sample.
+ *
+ * @param[in]  pTypes             Thermocouple type of each channel.
+ * @param[in]  channels           Number of channels per frame.
+ * @param[in]  pVoltage           First channel of the first frame, in millivolts (mV).
+ * @param[in]  voltageStride      Distance between consecutive input frames in bytes.
+ * @param[out] pTemperature       First channel of the first output frame, in degrees Celsius.
+ * @param[in]  temperatureStride  Distance between consecutive output frames in bytes.
+ * @param[in]  frames             Number of frames.
+ * @param[in]  mode               @c TC_MODE_FAST or @c TC_MODE_EXACT.
+ *
+ * @return Number of samples set to @c TC_CONVERSION_FAILED.
+ *
+ * @note The output may alias the input when both use the same stride.
+ */
+size_t TC_CalculateTemperatureFrames(const ThermocoupleType *pTypes, size_t channels,
+                                     const double *pVoltage, size_t voltageStride,
+                                     double *pTemperature, size_t temperatureStride,
+                                     size_t frames, ConversionMode mode);
+
+/**
+ * @brief  Configures a frame converter for a fixed channel-to-type map.
+ *
+ * @details
+ * Computes once the permutation that groups the channels by thermocouple type, so that
+ * @ref TC_FrameConverter_Convert can run one batch conversion per type instead of
+ * switching type on every sample.
+ *
+ * @param[out] pConverter  Converter to configure.
+ * @param[in]  pTypes      Thermocouple type of each channel.
+ * @param[in]  channels    Number of channels per frame; at most @c TC_FRAME_MAX_CHANNELS.
+ * @param[in]  mode        @c TC_MODE_FAST or @c TC_MODE_EXACT.
+ *
+ * @return 1 on success, or 0 if an argument or a channel type is invalid.
+ */
+uint8_t TC_FrameConverter_Init(FrameConverter *pConverter, const ThermocoupleType *pTypes, size_t channels,
+                               ConversionMode mode);
+
+/**
+ * @brief  Calculates temperatures for frames using a configured frame converter.
+ *
+ * @details
+ * The frames are processed in chunks of @c TC_FRAME_GATHER_SIZE / channels frames. For
+ * every thermocouple type, the samples of its channels in the chunk are gathered into
+ * one contiguous block, converted with @ref TC_CalculateTemperatureArray and scattered
+ * back while the chunk is still in cache, so the buffer is read once. Results are
+ * identical to @ref TC_CalculateTemperatureFrames.
+ *
+ * @param[in]  pConverter         Converter configured by @ref TC_FrameConverter_Init.
+ * @param[in]  pVoltage           First channel of the first frame, in millivolts (mV).
+ * @param[in]  voltageStride      Distance between consecutive input frames in bytes.
+ * @param[out] pTemperature       First channel of the first output frame, in degrees Celsius.
+ * @param[in]  temperatureStride  Distance between consecutive output frames in bytes.
+ * @param[in]  frames             Number of frames.
+ *
+ * @return Number of samples set to @c TC_CONVERSION_FAILED.
+ *
+ * @note The output may alias the input when both use the same stride.
+ */
+size_t TC_FrameConverter_Convert(const FrameConverter *pConverter, const double *pVoltage, size_t voltageStride,
+                                 double *pTemperature, size_t temperatureStride, size_t frames);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* thermocouple_frame.h */
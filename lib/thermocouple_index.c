@@ -0,0 +1,398 @@
+/**
+ * @file    thermocouple_index.c
+ * @author  Amirhossein Askari
+ * @version v1.0.0
+ * @date    2026-10-16
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Source file for the voltage-domain index of raw recordings.
+ *
+ * @details
+ * A double maps to an unsigned 64-bit key that sorts in the same order: the sign bit is
+ * set for positive values and all bits are inverted for negative ones. The keys are
+ * sorted byte by byte, least significant first, carrying the rows along; passes whose
+ * byte is the same in every key are skipped, which is most of the exponent bytes of a
+ * recording. The sorted keys are mapped back to doubles in place.
+ */
+
+
+/* ------------------------------------- Includes -------------------------------------- */
+
+#include "thermocouple_index.h"    ///< Header file for the voltage-domain index
+#include <stdlib.h>                ///< malloc, free
+#include <string.h>                ///< memcpy, memset
+
+
+
+/* -------------------------------------- Defines -------------------------------------- */
+
+#define  INDEX_SIGN_BIT    0x8000000000000000ULL    ///< Sign bit of a double
+#define  INDEX_PASSES      8U                       ///< Bytes in a key
+#define  INDEX_RADIX       256U                     ///< Buckets per pass
+
+
+
+/* ------------------------------------- Functions ------------------------------------- */
+
+/**
+ * @brief  Maps a voltage to its sort key.
+ *
+ * @param[in] voltage  Voltage.
+ *
+ * @return Key whose unsigned order is the order of the voltages.
+ */
+static uint64_t Index_Key(double voltage)
+{
+    uint64_t bits;
+
+    (void)memcpy(&bits, &voltage, sizeof(bits));
+
+    return ((bits & INDEX_SIGN_BIT) != 0U) ? ~bits : (bits | INDEX_SIGN_BIT);
+}
+
+/**
+ * @brief  Maps a sort key back to its voltage.
+ *
+ * @param[in] key  Key from @ref Index_Key.
+ *
+ * @return Voltage.
+ */
+static double Index_Voltage(uint64_t key)
+{
+    const uint64_t bits = ((key & INDEX_SIGN_BIT) != 0U) ? (key & ~INDEX_SIGN_BIT) : ~key;
+    double voltage;
+
+    (void)memcpy(&voltage, &bits, sizeof(voltage));
+
+    return voltage;
+}
+
+/**
+ * @brief  Sorts keys with their rows.
+ *
+ * @param[in,out] pKeys    Keys; holds the sorted keys on return.
+ * @param[in,out] pRows    Rows; permuted with the keys.
+ * @param[in]     pKeyTmp  Scratch of @p count keys.
+ * @param[in]     pRowTmp  Scratch of @p count rows.
+ * @param[in]     count    Number of keys.
+ */
+static void Index_RadixSort(uint64_t *pKeys, uint32_t *pRows, uint64_t *pKeyTmp, uint32_t *pRowTmp, size_t count)
+{
+    size_t histogram[INDEX_PASSES][INDEX_RADIX];
+    uint64_t *pSrcKey = pKeys;
+    uint32_t *pSrcRow = pRows;
+    uint64_t *pDstKey = pKeyTmp;
+    uint32_t *pDstRow = pRowTmp;
+    size_t pass;
+    size_t i;
+
+    (void)memset(histogram, 0, sizeof(histogram));
+    for (i = 0U; i < count; ++i)
+    {
+        for (pass = 0U; pass < INDEX_PASSES; ++pass)
+        {
+            histogram[pass][(pKeys[i] >> (pass * 8U)) & 0xFFU]++;
+        }
+    }
+
+    for (pass = 0U; pass < INDEX_PASSES; ++pass)
+    {
+        const uint32_t shift = (uint32_t)(pass * 8U);
+        size_t *pBucket      = histogram[pass];
+        size_t total         = 0U;
+        size_t b;
+
+        /* Every key has the same byte here: the order is already right */
+        if (pBucket[(pSrcKey[0] >> shift) & 0xFFU] != count)
+        {
+            for (b = 0U; b < INDEX_RADIX; ++b)
+            {
+                const size_t n = pBucket[b];
+                pBucket[b] = total;
+                total += n;
+            }
+
+            for (i = 0U; i < count; ++i)
+            {
+                const size_t slot = pBucket[(pSrcKey[i] >> shift) & 0xFFU]++;
+                pDstKey[slot] = pSrcKey[i];
+                pDstRow[slot] = pSrcRow[i];
+            }
+
+            {
+                uint64_t *pKeySwap = pSrcKey;
+                uint32_t *pRowSwap = pSrcRow;
+                pSrcKey = pDstKey;
+                pSrcRow = pDstRow;
+                pDstKey = pKeySwap;
+                pDstRow = pRowSwap;
+            }
+        }
+    }
+
+    if (pSrcKey != pKeys)
+    {
+        (void)memcpy(pKeys, pSrcKey, count * sizeof(uint64_t));
+        (void)memcpy(pRows, pSrcRow, count * sizeof(uint32_t));
+    }
+}
+
+/**
+ * @brief  Returns the first position in [begin, end) whose voltage is not below @p voltage.
+ *
+ * @param[in] pVoltage  Sorted voltages.
+ * @param[in] begin     First position.
+ * @param[in] end       One past the last position.
+ * @param[in] voltage   Voltage to search.
+ * @param[in] inclusive 1 to return the first position above @p voltage instead.
+ *
+ * @return Position.
+ */
+static size_t Index_Search(const double *pVoltage, size_t begin, size_t end, double voltage, uint8_t inclusive)
+{
+    while (begin < end)
+    {
+        const size_t middle = begin + ((end - begin) / 2U);
+
+        if ((pVoltage[middle] < voltage) || ((inclusive != 0U) && (pVoltage[middle] == voltage)))
+        {
+            begin = middle + 1U;
+        }
+        else
+        {
+            end = middle;
+        }
+    }
+
+    return begin;
+}
+
+/**
+ * @brief  Builds the index of a recording.
+ *
+ * @param[out] pIndex    Index to initialize.
+ * @param[in]  type      Thermocouple type as defined in the @c ThermocoupleType enum.
+ * @param[in]  pVoltage  @p count voltages in mV, in row order.
+ * @param[in]  count     Number of samples (at most @c TC_INDEX_MAX_COUNT).
+ * @param[in]  firstRow  Row of @p pVoltage[0], added to every reported row.
+ *
+ * @return 1 on success, or 0 on invalid arguments or allocation failure.
+ */
+uint8_t TC_Index_Build(VoltageIndex *pIndex, ThermocoupleType type, const double *pVoltage, size_t count,
+                       uint64_t firstRow)
+{
+    uint8_t result    = 0U;
+    uint64_t *pKeys   = NULL;
+    uint64_t *pKeyTmp = NULL;
+    uint32_t *pRowTmp = NULL;
+    size_t i;
+
+    /* 0 °C lies within the range of every type, so this rejects invalid types only */
+    if ((pIndex != NULL) && (pVoltage != NULL) && (count != 0U) && (count <= TC_INDEX_MAX_COUNT) &&
+        (TC_CalculateVoltage(type, 0.0) != TC_CONVERSION_FAILED))
+    {
+        (void)memset(pIndex, 0, sizeof(*pIndex));
+        pKeys        = (uint64_t *)malloc(count * sizeof(uint64_t));
+        pKeyTmp      = (uint64_t *)malloc(count * sizeof(uint64_t));
+        pRowTmp      = (uint32_t *)malloc(count * sizeof(uint32_t));
+        pIndex->pRow = (uint32_t *)malloc(count * sizeof(uint32_t));
+
+        if ((pKeys != NULL) && (pKeyTmp != NULL) && (pRowTmp != NULL) && (pIndex->pRow != NULL))
+        {
+            for (i = 0U; i < count; ++i)
+            {
+                pKeys[i]        = Index_Key(pVoltage[i]);
+                pIndex->pRow[i] = (uint32_t)i;
+            }
+
+            Index_RadixSort(pKeys, pIndex->pRow, pKeyTmp, pRowTmp, count);
+
+            /* Same storage, now read as doubles */
+            for (i = 0U; i < count; ++i)
+            {
+                const double voltage = Index_Voltage(pKeys[i]);
+                (void)memcpy(&pKeys[i], &voltage, sizeof(voltage));
+            }
+
+            pIndex->type     = type;
+            pIndex->pVoltage = (double *)(void *)pKeys;
+            pIndex->firstRow = firstRow;
+            pIndex->count    = count;
+
+            /* Out-of-range samples (and NaNs) sort to the two ends */
+            pIndex->minTemperature = TC_CONVERSION_FAILED;
+            pIndex->maxTemperature = TC_CONVERSION_FAILED;
+            pIndex->validBegin     = 0U;
+            pIndex->validEnd       = count;
+            while ((pIndex->validBegin < count) &&
+                   ((pIndex->minTemperature = TC_CalculateTemperature(type, pIndex->pVoltage[pIndex->validBegin])) ==
+                    TC_CONVERSION_FAILED))
+            {
+                pIndex->validBegin++;
+            }
+            while ((pIndex->validEnd > pIndex->validBegin) &&
+                   ((pIndex->maxTemperature = TC_CalculateTemperature(type, pIndex->pVoltage[pIndex->validEnd - 1U])) ==
+                    TC_CONVERSION_FAILED))
+            {
+                pIndex->validEnd--;
+            }
+
+            result = 1U;
+        }
+        else
+        {
+            free(pKeys);
+            free(pIndex->pRow);
+            pIndex->pRow = NULL;
+        }
+
+        free(pKeyTmp);
+        free(pRowTmp);
+    }
+
+    return result;
+}
+
+/**
+ * @brief  Releases the memory of an index.
+ *
+ * @param[in] pIndex  Index.
+ */
+void TC_Index_Destroy(VoltageIndex *pIndex)
+{
+    if (pIndex != NULL)
+    {
+        free(pIndex->pVoltage);
+        free(pIndex->pRow);
+        pIndex->pVoltage = NULL;
+        pIndex->pRow     = NULL;
+        pIndex->count    = 0U;
+    }
+}
+
+/**
+ * @brief  Finds the sorted positions that may lie within a temperature range.
+ *
+ * @details
+ * The bounds are widened by @c TC_INDEX_MARGIN before conversion. A widened bound
+ * outside the type's range fails to convert; it then lies either beyond every valid
+ * sample (the run stays open on that side) or on the far side of the range (the run is
+ * empty), which the temperatures at the ends of the valid run tell apart.
+ *
+ * @param[in]  pIndex          Index.
+ * @param[in]  minTemperature  Lower bound in °C (inclusive).
+ * @param[in]  maxTemperature  Upper bound in °C (inclusive).
+ * @param[out] pBegin          Receives the first candidate position.
+ * @param[out] pEnd            Receives one past the last candidate position.
+ */
+void TC_Index_Window(const VoltageIndex *pIndex, double minTemperature, double maxTemperature,
+                     size_t *pBegin, size_t *pEnd)
+{
+    const double lowest  = minTemperature - TC_INDEX_MARGIN;
+    const double highest = maxTemperature + TC_INDEX_MARGIN;
+    size_t begin = pIndex->validBegin;
+    size_t end   = pIndex->validEnd;
+    double voltage;
+
+    if ((begin == end) || (minTemperature > maxTemperature) || (lowest > (pIndex->maxTemperature + TC_INDEX_MARGIN)) ||
+        (highest < (pIndex->minTemperature - TC_INDEX_MARGIN)))
+    {
+        end = begin;
+    }
+    else
+    {
+        voltage = TC_CalculateVoltage(pIndex->type, lowest);
+        if (voltage != TC_CONVERSION_FAILED)
+        {
+            begin = Index_Search(pIndex->pVoltage, begin, end, voltage, 0U);
+        }
+        else if (lowest > pIndex->minTemperature)
+        {
+            end = begin;
+        }
+        else
+        {
+            /* Below the range: every valid sample is above the bound */
+        }
+
+        voltage = TC_CalculateVoltage(pIndex->type, highest);
+        if (voltage != TC_CONVERSION_FAILED)
+        {
+            end = Index_Search(pIndex->pVoltage, begin, end, voltage, 1U);
+        }
+        else if (highest < pIndex->maxTemperature)
+        {
+            end = begin;
+        }
+        else
+        {
+            /* Above the range: every valid sample is below the bound */
+        }
+
+        end = (end < begin) ? begin : end;
+    }
+
+    *pBegin = begin;
+    *pEnd   = end;
+}
+
+/**
+ * @brief  Finds the samples within a temperature range.
+ *
+ * @details
+ * The candidates are contiguous, so they are converted straight from the sorted
+ * voltages by @c TC_CalculateTemperatureArray in @c TC_MODE_FAST, bit-identical to
+ * @c TC_CalculateTemperature.
+ *
+ * @param[in]  pIndex          Index.
+ * @param[in]  minTemperature  Lower bound in °C (inclusive).
+ * @param[in]  maxTemperature  Upper bound in °C (inclusive).
+ * @param[in]  callback        Called for each matching sample, in ascending voltage order; may be NULL.
+ * @param[in]  pContext        Passed to @p callback.
+ * @param[out] pConverted      Optional; receives the number of samples converted.
+ *
+ * @return Number of matching samples.
+ */
+size_t TC_Index_Query(const VoltageIndex *pIndex, double minTemperature, double maxTemperature,
+                      IndexMatchCallback callback, void *pContext, size_t *pConverted)
+{
+    double temperature[TC_BATCH_BLOCK_SIZE];
+    size_t matches = 0U;
+    size_t begin;
+    size_t end;
+    size_t offset;
+    size_t block;
+    size_t i;
+
+    TC_Index_Window(pIndex, minTemperature, maxTemperature, &begin, &end);
+
+    for (offset = begin; offset < end; offset += block)
+    {
+        block = ((end - offset) < TC_BATCH_BLOCK_SIZE) ? (end - offset) : TC_BATCH_BLOCK_SIZE;
+        (void)TC_CalculateTemperatureArray(pIndex->type, &pIndex->pVoltage[offset], temperature, block, TC_MODE_FAST);
+
+        for (i = 0U; i < block; ++i)
+        {
+            if ((temperature[i] != TC_CONVERSION_FAILED) && (temperature[i] >= minTemperature) &&
+                (temperature[i] <= maxTemperature))
+            {
+                if (callback != NULL)
+                {
+                    callback(pContext, pIndex->firstRow + pIndex->pRow[offset + i], pIndex->pVoltage[offset + i],
+                             temperature[i]);
+                }
+                matches++;
+            }
+        }
+    }
+
+    if (pConverted != NULL)
+    {
+        *pConverted = end - begin;
+    }
+
+    return matches;
+}
+
+
+/* thermocouple_index.c */
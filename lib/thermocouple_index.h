@@ -0,0 +1,137 @@
+/**
+ * @file    thermocouple_index.h
+ * @author  Amirhossein Askari
+ * @version v1.0.0
+ * @date    2026-10-16
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Header file for the voltage-domain index of raw recordings.
+ *
+ * @details
+ * The index holds the raw voltages (mV) of one channel sorted in ascending order, each
+ * with the row it was recorded at. The mV-to-°C mapping of every thermocouple type is
+ * monotonic, so the samples within [T1, T2] °C form one contiguous run of the sorted
+ * voltages. A query converts T1 and T2 once with @c TC_CalculateVoltage, locates the run
+ * by binary search and converts only the samples in it.
+ *
+ * The inverse (mV-to-°C) polynomial of @c TC_CalculateTemperature and the reference
+ * (°C-to-mV) function of @c TC_CalculateVoltage differ by up to about 0.05 °C, so the
+ * voltage window is widened by @c TC_INDEX_MARGIN °C on each side and the candidates are
+ * filtered by their converted temperature. A query therefore returns exactly the samples
+ * a full scan with @c TC_CalculateTemperature would.
+ */
+
+
+#ifndef _THERMOCOUPLE_INDEX_H
+#define _THERMOCOUPLE_INDEX_H
+
+/* ------------------------------------- Includes ------------------------------------- */
+
+#include "thermocouple_sensor.h"    ///< Thermocouple types and conversions
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/* -------------------------------------- Defines ------------------------------------- */
+
+#ifndef TC_INDEX_MARGIN
+#define  TC_INDEX_MARGIN       0.5           ///< Widening of the voltage window in °C
+#endif
+#define  TC_INDEX_MAX_COUNT    UINT32_MAX    ///< Samples per index
+
+
+/* --------------------------------------- Types -------------------------------------- */
+
+/** @brief Sorted voltages of one channel */
+typedef struct
+{
+    ThermocoupleType type;    /**< Thermocouple type of the channel */
+    double *pVoltage;         /**< Voltages in mV, ascending */
+    uint32_t *pRow;           /**< Row of each voltage, relative to @c firstRow */
+    uint64_t firstRow;        /**< Row of the first indexed sample */
+    size_t count;             /**< Number of samples */
+    size_t validBegin;        /**< First sorted position that converts successfully */
+    size_t validEnd;          /**< One past the last sorted position that converts successfully */
+    double minTemperature;    /**< Temperature at @c validBegin, or @c TC_CONVERSION_FAILED */
+    double maxTemperature;    /**< Temperature at @c validEnd - 1, or @c TC_CONVERSION_FAILED */
+} VoltageIndex;
+
+/**
+ * @brief  Called by @ref TC_Index_Query for each matching sample.
+ *
+ * @param[in] pContext     Caller context.
+ * @param[in] row          Row of the sample.
+ * @param[in] voltage      Voltage in mV.
+ * @param[in] temperature  Temperature in degrees Celsius.
+ */
+typedef void (*IndexMatchCallback)(void *pContext, uint64_t row, double voltage, double temperature);
+
+
+/* ------------------------------------- Prototype ------------------------------------- */
+
+/**
+ * @brief  Builds the index of a recording.
+ *
+ * @details
+ * Sorts the voltages with an LSD radix sort on their IEEE-754 bit patterns, then
+ * converts the samples at both ends of the sorted order until the first successful
+ * conversion, to find the run of valid samples.
+ *
+ * @param[out] pIndex    Index to initialize.
+ * @param[in]  type      Thermocouple type as defined in the @c ThermocoupleType enum.
+ * @param[in]  pVoltage  @p count voltages in mV, in row order.
+ * @param[in]  count     Number of samples (at most @c TC_INDEX_MAX_COUNT).
+ * @param[in]  firstRow  Row of @p pVoltage[0], added to every reported row.
+ *
+ * @return 1 on success, or 0 on invalid arguments or allocation failure.
+ */
+uint8_t TC_Index_Build(VoltageIndex *pIndex, ThermocoupleType type, const double *pVoltage, size_t count,
+                       uint64_t firstRow);
+
+/**
+ * @brief  Releases the memory of an index.
+ *
+ * @param[in] pIndex  Index.
+ */
+void TC_Index_Destroy(VoltageIndex *pIndex);
+
+/**
+ * @brief  Finds the sorted positions that may lie within a temperature range.
+ *
+ * @details
+ * The run [@p *pBegin, @p *pEnd) holds every sample within the range, plus the samples
+ * of the @c TC_INDEX_MARGIN widening; it is empty if nothing can match.
+ *
+ * @param[in]  pIndex          Index.
+ * @param[in]  minTemperature  Lower bound in °C (inclusive).
+ * @param[in]  maxTemperature  Upper bound in °C (inclusive).
+ * @param[out] pBegin          Receives the first candidate position.
+ * @param[out] pEnd            Receives one past the last candidate position.
+ */
+void TC_Index_Window(const VoltageIndex *pIndex, double minTemperature, double maxTemperature,
+                     size_t *pBegin, size_t *pEnd);
+
+/**
+ * @brief  Finds the samples within a temperature range.
+ *
+ * @param[in]  pIndex          Index.
+ * @param[in]  minTemperature  Lower bound in °C (inclusive).
+ * @param[in]  maxTemperature  Upper bound in °C (inclusive).
+ * @param[in]  callback        Called for each matching sample, in ascending voltage order; may be NULL.
+ * @param[in]  pContext        Passed to @p callback.
+ * @param[out] pConverted      Optional; receives the number of samples converted.
+ *
+ * @return Number of matching samples.
+ */
+size_t TC_Index_Query(const VoltageIndex *pIndex, double minTemperature, double maxTemperature,
+                      IndexMatchCallback callback, void *pContext, size_t *pConverted);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* thermocouple_index.h */
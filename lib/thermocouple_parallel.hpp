@@ -0,0 +1,172 @@
+/**
+ * @file    thermocouple_parallel.hpp
+ * @author  Amirhossein Askari
+ * @version v1.0.0
+ * @date    2026-10-16
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   C++20 parallel-algorithm overloads for container-wide conversions.
+ *
+ * @details
+ * Provides @c tc::to_celsius overloads taking a standard execution policy and spans of
+ * @c double or @c float. The input is split into chunks that are converted through
+ * @c TC_CalculateTemperatureArray by @c std::transform_reduce, so the toolchain's
+ * parallel backend (TBB, OpenMP, ...) spreads them across cores while the batch kernel
+ * uses the vector lanes within each chunk.
+ *
+ * @note
+ * Requires C++20 and linking @c thermocouple_sensor.c; with libstdc++, parallel policies
+ * also require linking the TBB backend (@c -ltbb).
+ */
+
+
+#ifndef _THERMOCOUPLE_PARALLEL_HPP
+#define _THERMOCOUPLE_PARALLEL_HPP
+
+/* ------------------------------------- Includes ------------------------------------- */
+
+#include <algorithm>                  ///< std::min
+#include <cstddef>                    ///< std::size_t
+#include <execution>                  ///< Execution policies
+#include <functional>                 ///< std::plus
+#include <numeric>                    ///< std::transform_reduce
+#include <span>                       ///< std::span
+#include <type_traits>                ///< std::is_execution_policy_v
+#include <vector>                     ///< Chunk index list
+#include "thermocouple_sensor.hpp"    ///< tc::Type
+
+
+namespace tc
+{
+
+/* -------------------------------------- Defines ------------------------------------- */
+
+/** @brief Number of samples converted by one task of the parallel overloads */
+inline constexpr std::size_t parallel_chunk_size = 16384U;
+
+
+namespace detail
+{
+
+/** @brief True for standard execution policy types */
+template <class ExecutionPolicy>
+inline constexpr bool is_policy_v = std::is_execution_policy_v<std::remove_cvref_t<ExecutionPolicy>>;
+
+/**
+ * @brief Converts one contiguous chunk of @c double samples.
+ *
+ * @return Number of samples set to @c tc::conversion_failed.
+ */
+inline std::size_t convert_chunk(Type type, const double *pIn, double *pOut, std::size_t count, ConversionMode mode) noexcept
+{
+    return TC_CalculateTemperatureArray(static_cast<ThermocoupleType>(type), pIn, pOut, count, mode);
+}
+
+/**
+ * @brief Converts one contiguous chunk of @c float samples.
+ *
+ * @details
+ * Widens @c TC_BATCH_BLOCK_SIZE samples at a time into a stack buffer, converts them
+ * in double precision and narrows the results.
+ *
+ * @return Number of samples set to @c tc::conversion_failed.
+ */
+inline std::size_t convert_chunk(Type type, const float *pIn, float *pOut, std::size_t count, ConversionMode mode) noexcept
+{
+    double buffer[TC_BATCH_BLOCK_SIZE];
+    std::size_t failed = 0U;
+
+    for (std::size_t offset = 0U; offset < count; offset += TC_BATCH_BLOCK_SIZE)
+    {
+        const std::size_t block = std::min<std::size_t>(count - offset, TC_BATCH_BLOCK_SIZE);
+        for (std::size_t i = 0U; i < block; ++i)
+        {
+            buffer[i] = static_cast<double>(pIn[offset + i]);
+        }
+        failed += TC_CalculateTemperatureArray(static_cast<ThermocoupleType>(type), buffer, buffer, block, mode);
+        for (std::size_t i = 0U; i < block; ++i)
+        {
+            pOut[offset + i] = static_cast<float>(buffer[i]);
+        }
+    }
+    return failed;
+}
+
+/**
+ * @brief Splits a conversion into chunks and runs them under an execution policy.
+ *
+ * @return Number of samples set to @c tc::conversion_failed.
+ */
+template <class ExecutionPolicy, class Sample>
+std::size_t parallel_to_celsius(ExecutionPolicy &&policy, Type type, std::span<const Sample> in, std::span<Sample> out,
+                                ConversionMode mode)
+{
+    const std::size_t count  = std::min(in.size(), out.size());
+    const std::size_t chunks = (count + parallel_chunk_size - 1U) / parallel_chunk_size;
+    std::vector<std::size_t> offsets(chunks);
+
+    for (std::size_t i = 0U; i < chunks; ++i)
+    {
+        offsets[i] = i * parallel_chunk_size;
+    }
+
+    return std::transform_reduce(std::forward<ExecutionPolicy>(policy), offsets.begin(), offsets.end(),
+                                 std::size_t{0}, std::plus<>{},
+                                 [=](std::size_t offset) noexcept {
+                                     const std::size_t block = std::min(count - offset, parallel_chunk_size);
+                                     return convert_chunk(type, in.data() + offset, out.data() + offset, block, mode);
+                                 });
+}
+
+} // namespace detail
+
+
+/* ------------------------------------- Interface ------------------------------------- */
+
+/**
+ * @brief  Calculates temperatures for a span of voltages under an execution policy.
+ *
+ * @param[in]  policy  Standard execution policy, e.g. @c std::execution::par_unseq.
+ * @param[in]  type    Thermocouple type.
+ * @param[in]  in      Voltages in millivolts (mV).
+ * @param[out] out     Receives the temperatures in degrees Celsius; may be the same span as @p in.
+ * @param[in]  mode    @c TC_MODE_FAST or @c TC_MODE_EXACT.
+ *
+ * @return Number of samples set to @c tc::conversion_failed. Only the first
+ *         min(in.size(), out.size()) samples are converted.
+ *
+ * @note Results are bit-identical to @c TC_CalculateTemperature (or
+ *       @c TC_CalculateTemperatureExact) on each sample.
+ */
+template <class ExecutionPolicy, std::enable_if_t<detail::is_policy_v<ExecutionPolicy>, int> = 0>
+std::size_t to_celsius(ExecutionPolicy &&policy, Type type, std::span<const double> in, std::span<double> out,
+                       ConversionMode mode = TC_MODE_FAST)
+{
+    return detail::parallel_to_celsius(std::forward<ExecutionPolicy>(policy), type, in, out, mode);
+}
+
+/**
+ * @brief  Calculates temperatures for a span of single-precision voltages under an execution policy.
+ *
+ * @details
+ * Samples are widened to @c double for the conversion and the results narrowed back.
+ *
+ * @param[in]  policy  Standard execution policy, e.g. @c std::execution::par_unseq.
+ * @param[in]  type    Thermocouple type.
+ * @param[in]  in      Voltages in millivolts (mV).
+ * @param[out] out     Receives the temperatures in degrees Celsius; may be the same span as @p in.
+ * @param[in]  mode    @c TC_MODE_FAST or @c TC_MODE_EXACT.
+ *
+ * @return Number of samples set to @c tc::conversion_failed.
+ */
+template <class ExecutionPolicy, std::enable_if_t<detail::is_policy_v<ExecutionPolicy>, int> = 0>
+std::size_t to_celsius(ExecutionPolicy &&policy, Type type, std::span<const float> in, std::span<float> out,
+                       ConversionMode mode = TC_MODE_FAST)
+{
+    return detail::parallel_to_celsius(std::forward<ExecutionPolicy>(policy), type, in, out, mode);
+}
+
+} // namespace tc
+
+
+#endif /* thermocouple_parallel.hpp */
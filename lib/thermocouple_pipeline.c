@@ -0,0 +1,205 @@
+/**
+ * @file    thermocouple_pipeline.c
+ * @author  Amirhossein Askari
+ * @version v1.0.0
+ * @date    2026-10-16
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Source file for the double-buffered conversion pipeline.
+ *
+ * @details
+ * Each buffer has its own ownership flag. The producer publishes a buffer with a release
+ * store of 1 and posts the semaphore; the worker converts it and returns it with a release
+ * store of 0. A post with no busy buffer behind it tells the worker to exit.
+ */
+
+
+/* ------------------------------------- Includes -------------------------------------- */
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE                    ///< pthread_attr_setaffinity_np
+#endif
+#include "thermocouple_pipeline.h"    ///< Header file for the pipeline
+#include <sched.h>                    ///< cpu_set_t
+
+
+
+/* ------------------------------------- Functions ------------------------------------- */
+
+/**
+ * @brief  Worker thread: converts submitted buffers in order until stopped.
+ *
+ * @param[in] pArg  Pipeline.
+ *
+ * @return NULL.
+ */
+static void *Pipeline_Worker(void *pArg)
+{
+    Pipeline *pPipeline = (Pipeline *)pArg;
+    uint8_t running = 1U;
+
+    while (running != 0U)
+    {
+        const uint32_t index = pPipeline->convert;
+
+        while (sem_wait(&pPipeline->ready) != 0)
+        {
+            /* Retry when interrupted by a signal */
+        }
+
+        if (atomic_load_explicit(&pPipeline->busy[index], memory_order_acquire) == 0U)
+        {
+            running = 0U;
+        }
+        else
+        {
+            const PipelineConfig *pConfig = &pPipeline->config;
+            double *pBuffer     = pPipeline->pBuffer[index];
+            const size_t count  = pPipeline->count[index];
+            const size_t failed = TC_CalculateTemperatureArray(pConfig->type, pBuffer, pBuffer, count, pConfig->mode);
+
+            if (pConfig->callback != NULL)
+            {
+                pConfig->callback(pBuffer, count, failed, pConfig->pContext);
+            }
+
+            pPipeline->convert = index ^ 1U;
+            atomic_store_explicit(&pPipeline->busy[index], 0U, memory_order_release);
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief  Starts a pipeline over two caller-provided buffers.
+ *
+ * @param[out] pPipeline  Pipeline to start.
+ * @param[in]  pBufferA   First buffer of @p capacity samples.
+ * @param[in]  pBufferB   Second buffer of @p capacity samples.
+ * @param[in]  capacity   Length of each buffer in samples.
+ * @param[in]  pConfig    Worker configuration; copied.
+ *
+ * @return 1 on success, or 0 if an argument is invalid or the worker could not be started.
+ */
+uint8_t TC_Pipeline_Start(Pipeline *pPipeline, double *pBufferA, double *pBufferB, size_t capacity,
+                          const PipelineConfig *pConfig)
+{
+    pthread_attr_t attr;
+    uint8_t result = 1U;
+
+    if ((pPipeline == NULL) || (pBufferA == NULL) || (pBufferB == NULL) || (pConfig == NULL) || (capacity == 0U))
+    {
+        result = 0U;
+    }
+    else if (sem_init(&pPipeline->ready, 0, 0U) != 0)
+    {
+        result = 0U;
+    }
+    else
+    {
+        atomic_init(&pPipeline->busy[0], 0U);
+        atomic_init(&pPipeline->busy[1], 0U);
+        pPipeline->pBuffer[0] = pBufferA;
+        pPipeline->pBuffer[1] = pBufferB;
+        pPipeline->count[0]   = 0U;
+        pPipeline->count[1]   = 0U;
+        pPipeline->capacity   = capacity;
+        pPipeline->fill       = 0U;
+        pPipeline->convert    = 0U;
+        pPipeline->config     = *pConfig;
+
+        if (pthread_attr_init(&attr) != 0)
+        {
+            result = 0U;
+        }
+        else
+        {
+#ifdef __linux__
+            if (pConfig->cpu != TC_PIPELINE_ANY_CPU)
+            {
+                cpu_set_t cpus;
+                CPU_ZERO(&cpus);
+                CPU_SET(pConfig->cpu, &cpus);
+                if (pthread_attr_setaffinity_np(&attr, sizeof(cpus), &cpus) != 0)
+                {
+                    result = 0U;
+                }
+            }
+#endif
+            if ((result != 0U) && (pthread_create(&pPipeline->worker, &attr, Pipeline_Worker, pPipeline) != 0))
+            {
+                result = 0U;
+            }
+            (void)pthread_attr_destroy(&attr);
+        }
+
+        if (result == 0U)
+        {
+            (void)sem_destroy(&pPipeline->ready);
+        }
+    }
+
+    return result;
+}
+
+/**
+ * @brief  Returns the buffer the producer should fill next.
+ *
+ * @param[in] pPipeline  Pipeline.
+ *
+ * @return Buffer of @c capacity samples, or NULL while the worker is still converting it.
+ */
+double *TC_Pipeline_Fill(Pipeline *pPipeline)
+{
+    const uint32_t index = pPipeline->fill;
+
+    return (atomic_load_explicit(&pPipeline->busy[index], memory_order_acquire) == 0U) ? pPipeline->pBuffer[index] : NULL;
+}
+
+/**
+ * @brief  Hands the buffer returned by @ref TC_Pipeline_Fill to the worker.
+ *
+ * @param[in] pPipeline  Pipeline.
+ * @param[in] count      Number of samples written to the buffer; clamped to @c capacity.
+ *
+ * @return 1 on success, or 0 if the worker still owns the buffer.
+ */
+uint8_t TC_Pipeline_Submit(Pipeline *pPipeline, size_t count)
+{
+    const uint32_t index = pPipeline->fill;
+    uint8_t result = 0U;
+
+    if (atomic_load_explicit(&pPipeline->busy[index], memory_order_acquire) == 0U)
+    {
+        pPipeline->count[index] = (count < pPipeline->capacity) ? count : pPipeline->capacity;
+        atomic_store_explicit(&pPipeline->busy[index], 1U, memory_order_release);
+        (void)sem_post(&pPipeline->ready);
+        pPipeline->fill = index ^ 1U;
+        result = 1U;
+    }
+
+    return result;
+}
+
+/**
+ * @brief  Waits until all submitted buffers are converted and stops the worker.
+ *
+ * @details
+ * The stop request is queued behind the submitted buffers, so they are converted and
+ * reported first.
+ *
+ * @param[in] pPipeline  Pipeline started by @ref TC_Pipeline_Start.
+ */
+void TC_Pipeline_Stop(Pipeline *pPipeline)
+{
+    if (pPipeline != NULL)
+    {
+        (void)sem_post(&pPipeline->ready);
+        (void)pthread_join(pPipeline->worker, NULL);
+        (void)sem_destroy(&pPipeline->ready);
+    }
+}
+
+
+/* thermocouple_pipeline.c */
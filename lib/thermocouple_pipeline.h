@@ -0,0 +1,134 @@
+/**
+ * @file    thermocouple_pipeline.h
+ * @author  Amirhossein Askari
+ * @version v1.0.0
+ * @date    2026-10-16
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Header file for the double-buffered conversion pipeline.
+ *
+ * @details
+ * A ping-pong pipeline: while the producer fills one buffer, a worker thread converts the
+ * other one in place with @c TC_CalculateTemperatureArray and passes the temperatures to
+ * a completion callback. Each buffer is handed over by flipping an atomic flag, and a
+ * semaphore wakes the worker, so acquisition never waits for a conversion unless the
+ * conversion of a buffer takes longer than filling the next one.
+ *
+ * @note
+ * Requires POSIX threads and semaphores. CPU affinity uses @c pthread_attr_setaffinity_np
+ * and is ignored on platforms that do not provide it.
+ *
+ * @warning
+ * Only one producer thread may call @ref TC_Pipeline_Fill and @ref TC_Pipeline_Submit.
+ */
+
+
+#ifndef _THERMOCOUPLE_PIPELINE_H
+#define _THERMOCOUPLE_PIPELINE_H
+
+/* ------------------------------------- Includes ------------------------------------- */
+
+#include <pthread.h>                 ///< Worker thread
+#include <semaphore.h>               ///< Worker wake-up
+#include "thermocouple_atomic.h"    ///< Atomic members and cache-line alignment
+#include "thermocouple_sensor.h"    ///< Thermocouple types and batch conversions
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/* -------------------------------------- Defines ------------------------------------- */
+
+/** @brief @c PipelineConfig::cpu value leaving the worker unpinned */
+#define  TC_PIPELINE_ANY_CPU    (-1)    ///< No CPU affinity
+
+
+/* --------------------------------------- Types -------------------------------------- */
+
+/**
+ * @brief Completion callback, called on the worker thread for every converted buffer.
+ *
+ * @param[in] pTemperature  Converted buffer, in degrees Celsius; valid until the callback returns.
+ * @param[in] count         Number of samples in the buffer.
+ * @param[in] failed        Number of samples set to @c TC_CONVERSION_FAILED.
+ * @param[in] pContext      @c PipelineConfig::pContext.
+ */
+typedef void (*PipelineCallback)(const double *pTemperature, size_t count, size_t failed, void *pContext);
+
+/** @brief Worker configuration */
+typedef struct
+{
+    ThermocoupleType type;          /**< Thermocouple type */
+    ConversionMode mode;            /**< Conversion mode */
+    PipelineCallback callback;      /**< Completion callback; may be NULL */
+    void *pContext;                 /**< Passed to @c callback */
+    int cpu;                        /**< CPU the worker is pinned to, or @c TC_PIPELINE_ANY_CPU */
+} PipelineConfig;
+
+/** @brief Double-buffered conversion pipeline */
+typedef struct
+{
+    TC_CACHE_ALIGNED TC_ATOMIC(uint32_t) busy[2];   /**< 1 while the worker owns the buffer */
+
+    TC_CACHE_ALIGNED double *pBuffer[2];            /**< The two buffers */
+    size_t count[2];                                /**< Samples submitted in each buffer */
+    size_t capacity;                                /**< Length of each buffer in samples */
+    uint32_t fill;                                  /**< Buffer the producer fills next */
+    uint32_t convert;                               /**< Buffer the worker converts next */
+    PipelineConfig config;                          /**< Worker configuration */
+    sem_t ready;                                    /**< Posted once per submitted buffer and on stop */
+    pthread_t worker;                               /**< Worker thread */
+} Pipeline;
+
+
+/* ------------------------------------- Prototype ------------------------------------- */
+
+/**
+ * @brief  Starts a pipeline over two caller-provided buffers.
+ *
+ * @param[out] pPipeline  Pipeline to start.
+ * @param[in]  pBufferA   First buffer of @p capacity samples.
+ * @param[in]  pBufferB   Second buffer of @p capacity samples.
+ * @param[in]  capacity   Length of each buffer in samples.
+ * @param[in]  pConfig    Worker configuration; copied.
+ *
+ * @return 1 on success, or 0 if an argument is invalid or the worker could not be started
+ *         (including an invalid CPU in @c pConfig->cpu).
+ */
+uint8_t TC_Pipeline_Start(Pipeline *pPipeline, double *pBufferA, double *pBufferB, size_t capacity,
+                          const PipelineConfig *pConfig);
+
+/**
+ * @brief  Returns the buffer the producer should fill next.
+ *
+ * @param[in] pPipeline  Pipeline.
+ *
+ * @return Buffer of @c capacity samples, or NULL while the worker is still converting it.
+ */
+double *TC_Pipeline_Fill(Pipeline *pPipeline);
+
+/**
+ * @brief  Hands the buffer returned by @ref TC_Pipeline_Fill to the worker.
+ *
+ * @param[in] pPipeline  Pipeline.
+ * @param[in] count      Number of samples written to the buffer; clamped to @c capacity.
+ *
+ * @return 1 on success, or 0 if the worker still owns the buffer.
+ */
+uint8_t TC_Pipeline_Submit(Pipeline *pPipeline, size_t count);
+
+/**
+ * @brief  Waits until all submitted buffers are converted and stops the worker.
+ *
+ * @param[in] pPipeline  Pipeline started by @ref TC_Pipeline_Start.
+ */
+void TC_Pipeline_Stop(Pipeline *pPipeline);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* thermocouple_pipeline.h */
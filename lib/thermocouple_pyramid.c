@@ -0,0 +1,330 @@
+/**
+ * @file    thermocouple_pyramid.c
+ * @author  Amirhossein Askari
+ * @version v1.0.0
+ * @date    2026-10-16
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Source file for the min/max decimation pyramid of raw voltages.
+ *
+ * @details
+ * An append folds the new samples into level 0, then refolds at each higher level only
+ * the buckets whose children changed: the one that was open before the append and the
+ * ones created by it. Rendering reads at most about @c TC_PYRAMID_FANOUT buckets per
+ * column.
+ */
+
+
+/* ------------------------------------- Includes -------------------------------------- */
+
+#include "thermocouple_pyramid.h"    ///< Header file for the decimation pyramid
+#include <stdlib.h>                  ///< realloc, free
+#include <string.h>                  ///< memset
+
+
+
+/* ------------------------------------- Functions ------------------------------------- */
+
+/**
+ * @brief  Returns the samples spanned by one bucket of a level.
+ *
+ * @param[in] level  Level index.
+ *
+ * @return FANOUT^(level+1).
+ */
+static uint64_t Pyramid_Span(size_t level)
+{
+    uint64_t span = TC_PYRAMID_FANOUT;
+    size_t k;
+
+    for (k = 0U; k < level; ++k)
+    {
+        span *= TC_PYRAMID_FANOUT;
+    }
+
+    return span;
+}
+
+/**
+ * @brief  Folds a run of buckets into one.
+ *
+ * @param[out] pOut     Extrema of the run.
+ * @param[in]  pBucket  First bucket.
+ * @param[in]  count    Buckets in the run (at least 1).
+ */
+static void Pyramid_Fold(PyramidBucket *pOut, const PyramidBucket *pBucket, size_t count)
+{
+    PyramidBucket result = pBucket[0];
+    size_t i;
+
+    for (i = 1U; i < count; ++i)
+    {
+        result.minVoltage = (pBucket[i].minVoltage < result.minVoltage) ? pBucket[i].minVoltage : result.minVoltage;
+        result.maxVoltage = (pBucket[i].maxVoltage > result.maxVoltage) ? pBucket[i].maxVoltage : result.maxVoltage;
+    }
+
+    *pOut = result;
+}
+
+/**
+ * @brief  Initializes an empty pyramid.
+ *
+ * @param[out] pPyramid  Pyramid.
+ * @param[in]  type      Thermocouple type as defined in the @c ThermocoupleType enum.
+ */
+void TC_Pyramid_Init(TemperaturePyramid *pPyramid, ThermocoupleType type)
+{
+    (void)memset(pPyramid, 0, sizeof(*pPyramid));
+    pPyramid->type = type;
+}
+
+/**
+ * @brief  Releases the memory of a pyramid.
+ *
+ * @param[in] pPyramid  Pyramid.
+ */
+void TC_Pyramid_Destroy(TemperaturePyramid *pPyramid)
+{
+    size_t k;
+
+    if (pPyramid != NULL)
+    {
+        for (k = 0U; k < TC_PYRAMID_LEVELS; ++k)
+        {
+            free(pPyramid->level[k].pBucket);
+        }
+        (void)memset(pPyramid->level, 0, sizeof(pPyramid->level));
+        pPyramid->samples = 0U;
+    }
+}
+
+/**
+ * @brief  Appends samples.
+ *
+ * @param[in] pPyramid  Pyramid.
+ * @param[in] pVoltage  @p count voltages in mV.
+ * @param[in] count     Number of samples.
+ *
+ * @return 1 on success, or 0 if a level could not grow; the pyramid is then unchanged.
+ */
+uint8_t TC_Pyramid_Append(TemperaturePyramid *pPyramid, const double *pVoltage, size_t count)
+{
+    const uint64_t total = pPyramid->samples + count;
+    uint8_t result       = 1U;
+    size_t first;
+    size_t k;
+    size_t b;
+    size_t i;
+
+    /* Grow every level first, so a failure leaves the contents untouched */
+    for (k = 0U; (result != 0U) && (k < TC_PYRAMID_LEVELS); ++k)
+    {
+        PyramidLevel *pLevel = &pPyramid->level[k];
+        const size_t need    = (size_t)((total + Pyramid_Span(k) - 1U) / Pyramid_Span(k));
+
+        if (need > pLevel->capacity)
+        {
+            size_t capacity = (pLevel->capacity != 0U) ? pLevel->capacity : 64U;
+            PyramidBucket *pBucket;
+
+            while (capacity < need)
+            {
+                capacity *= 2U;
+            }
+            pBucket = (PyramidBucket *)realloc(pLevel->pBucket, capacity * sizeof(PyramidBucket));
+            if (pBucket != NULL)
+            {
+                pLevel->pBucket  = pBucket;
+                pLevel->capacity = capacity;
+            }
+            else
+            {
+                result = 0U;
+            }
+        }
+    }
+
+    if ((result != 0U) && (count != 0U))
+    {
+        PyramidBucket *pBase = pPyramid->level[0].pBucket;
+        uint64_t sample      = pPyramid->samples;
+
+        first = (size_t)(sample / TC_PYRAMID_FANOUT);
+        i     = 0U;
+        while (i < count)
+        {
+            PyramidBucket *pBucket = &pBase[sample / TC_PYRAMID_FANOUT];
+            const size_t phase     = (size_t)(sample % TC_PYRAMID_FANOUT);
+            const size_t run       = ((count - i) < (TC_PYRAMID_FANOUT - phase)) ? (count - i)
+                                                                                 : (TC_PYRAMID_FANOUT - phase);
+            size_t j;
+
+            if (phase == 0U)
+            {
+                pBucket->minVoltage = pVoltage[i];
+                pBucket->maxVoltage = pVoltage[i];
+            }
+            for (j = i; j < (i + run); ++j)
+            {
+                pBucket->minVoltage = (pVoltage[j] < pBucket->minVoltage) ? pVoltage[j] : pBucket->minVoltage;
+                pBucket->maxVoltage = (pVoltage[j] > pBucket->maxVoltage) ? pVoltage[j] : pBucket->maxVoltage;
+            }
+
+            i      += run;
+            sample += run;
+        }
+        pPyramid->level[0].count = (size_t)((total + TC_PYRAMID_FANOUT - 1U) / TC_PYRAMID_FANOUT);
+
+        for (k = 1U; k < TC_PYRAMID_LEVELS; ++k)
+        {
+            const PyramidLevel *pChild = &pPyramid->level[k - 1U];
+            PyramidLevel *pLevel       = &pPyramid->level[k];
+
+            first         = first / TC_PYRAMID_FANOUT;
+            pLevel->count = (pChild->count + TC_PYRAMID_FANOUT - 1U) / TC_PYRAMID_FANOUT;
+            for (b = first; b < pLevel->count; ++b)
+            {
+                const size_t child = b * TC_PYRAMID_FANOUT;
+                const size_t n     = ((pChild->count - child) < TC_PYRAMID_FANOUT) ? (pChild->count - child)
+                                                                                   : TC_PYRAMID_FANOUT;
+                Pyramid_Fold(&pLevel->pBucket[b], &pChild->pBucket[child], n);
+            }
+        }
+
+        pPyramid->samples = total;
+    }
+
+    return result;
+}
+
+/**
+ * @brief  Converts the voltage extrema of a block of columns into temperature bounds.
+ *
+ * @details
+ * The fast conversion is increasing within each polynomial segment but steps down by up
+ * to 0.07 °C at some joins, so the converted pair of a column is put in order. For a
+ * column whose voltages straddle a join, the temperatures on both sides of the join are
+ * folded in as well, so the bounds contain the temperature of every sample of the
+ * column. Failed conversions are left as they are.
+ *
+ * @param[in]  type             Thermocouple type.
+ * @param[in]  pExtrema         Voltage extrema of each column.
+ * @param[in]  count            Columns; at most @c TC_BATCH_BLOCK_SIZE.
+ * @param[out] pMinTemperature  Receives the lower bound of each column in °C.
+ * @param[out] pMaxTemperature  Receives the upper bound of each column in °C.
+ */
+static void Pyramid_Convert(ThermocoupleType type, const PyramidBucket *pExtrema, size_t count,
+                            double *pMinTemperature, double *pMaxTemperature)
+{
+    double join[TC_MAX_INVERSE_JOINS];
+    double low[TC_BATCH_BLOCK_SIZE];
+    double high[TC_BATCH_BLOCK_SIZE];
+    const size_t joins = TC_GetInverseJoins(type, join);
+    size_t c;
+    size_t j;
+
+    for (c = 0U; c < count; ++c)
+    {
+        low[c]  = pExtrema[c].minVoltage;
+        high[c] = pExtrema[c].maxVoltage;
+    }
+    (void)TC_CalculateTemperatureArray(type, low, low, count, TC_MODE_FAST);
+    (void)TC_CalculateTemperatureArray(type, high, high, count, TC_MODE_FAST);
+
+    for (c = 0U; c < count; ++c)
+    {
+        double lower = low[c];
+        double upper = high[c];
+
+        if ((lower != TC_CONVERSION_FAILED) && (upper != TC_CONVERSION_FAILED))
+        {
+            lower = (low[c] < high[c]) ? low[c] : high[c];
+            upper = (low[c] < high[c]) ? high[c] : low[c];
+
+            for (j = 0U; j < joins; ++j)
+            {
+                /* A join converts with the lower segment, the next double with the upper one */
+                const double above = nextafter(join[j], HUGE_VAL);
+
+                if ((pExtrema[c].minVoltage <= join[j]) && (pExtrema[c].maxVoltage >= above))
+                {
+                    const double below = TC_CalculateTemperature(type, join[j]);
+                    const double after = TC_CalculateTemperature(type, above);
+
+                    lower = (below < lower) ? below : lower;
+                    lower = (after < lower) ? after : lower;
+                    upper = (below > upper) ? below : upper;
+                    upper = (after > upper) ? after : upper;
+                }
+            }
+        }
+
+        pMinTemperature[c] = lower;
+        pMaxTemperature[c] = upper;
+    }
+}
+
+/**
+ * @brief  Computes the temperature extrema of each pixel column of a time range.
+ *
+ * @param[in]  pPyramid         Pyramid.
+ * @param[in]  firstSample      First sample of the range.
+ * @param[in]  sampleCount      Samples in the range.
+ * @param[in]  pixels           Columns wanted.
+ * @param[out] pMinTemperature  Receives the minimum of each column in °C.
+ * @param[out] pMaxTemperature  Receives the maximum of each column in °C.
+ *
+ * @return Number of columns written.
+ */
+size_t TC_Pyramid_Render(const TemperaturePyramid *pPyramid, uint64_t firstSample, uint64_t sampleCount,
+                         size_t pixels, double *pMinTemperature, double *pMaxTemperature)
+{
+    size_t columns = 0U;
+    size_t k       = 0U;
+    uint64_t end;
+    uint64_t perPixel;
+    uint64_t span;
+    size_t begin;
+    size_t buckets;
+    size_t block;
+    size_t c;
+    size_t i;
+
+    if ((pixels != 0U) && (sampleCount != 0U) && (firstSample < pPyramid->samples))
+    {
+        end      = ((pPyramid->samples - firstSample) < sampleCount) ? pPyramid->samples : (firstSample + sampleCount);
+        perPixel = (end - firstSample) / pixels;
+
+        /* Coarsest level that still has a bucket for every pixel */
+        while (((k + 1U) < TC_PYRAMID_LEVELS) && (Pyramid_Span(k + 1U) <= perPixel))
+        {
+            k++;
+        }
+
+        span    = Pyramid_Span(k);
+        begin   = (size_t)(firstSample / span);
+        buckets = (size_t)((end + span - 1U) / span) - begin;
+        columns = (buckets < pixels) ? buckets : pixels;
+
+        for (c = 0U; c < columns; c += block)
+        {
+            PyramidBucket extrema[TC_BATCH_BLOCK_SIZE];
+
+            block = ((columns - c) < TC_BATCH_BLOCK_SIZE) ? (columns - c) : TC_BATCH_BLOCK_SIZE;
+            for (i = 0U; i < block; ++i)
+            {
+                const size_t b0 = begin + (size_t)(((uint64_t)(c + i) * buckets) / columns);
+                const size_t b1 = begin + (size_t)((((uint64_t)(c + i) + 1U) * buckets) / columns);
+
+                Pyramid_Fold(&extrema[i], &pPyramid->level[k].pBucket[b0], b1 - b0);
+            }
+
+            Pyramid_Convert(pPyramid->type, extrema, block, &pMinTemperature[c], &pMaxTemperature[c]);
+        }
+    }
+
+    return columns;
+}
+
+
+/* thermocouple_pyramid.c */
@@ -0,0 +1,137 @@
+/**
+ * @file    thermocouple_pyramid.h
+ * @author  Amirhossein Askari
+ * @version v1.0.0
+ * @date    2026-10-16
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Header file for the min/max decimation pyramid of raw voltages.
+ *
+ * @details
+ * A pyramid summarizes one channel at several resolutions for trend rendering. Level 0
+ * holds the minimum and maximum voltage (mV) of each run of @c TC_PYRAMID_FANOUT
+ * samples, and every further level holds the extrema of @c TC_PYRAMID_FANOUT buckets of
+ * the level below. Samples are appended as they arrive; the last bucket of each level
+ * stays open and always covers the newest samples.
+ *
+ * Rendering picks the coarsest level that still gives at least one bucket per pixel and
+ * converts only the extrema of each pixel, so the cost depends on the number of pixels,
+ * not samples. The fast mV-to-°C conversion is increasing within each polynomial
+ * segment but steps down by up to 0.07 °C at some segment joins (type J at 42.914 mV,
+ * type K at 20.644 mV). A column is therefore bounded by its converted extrema and, when
+ * its voltages straddle a join, by the temperatures on both sides of the join. The
+ * bounds contain every converted sample and are at most that step wider than the true
+ * sample extrema.
+ */
+
+
+#ifndef _THERMOCOUPLE_PYRAMID_H
+#define _THERMOCOUPLE_PYRAMID_H
+
+/* ------------------------------------- Includes ------------------------------------- */
+
+#include "thermocouple_sensor.h"    ///< Thermocouple types and conversions
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/* -------------------------------------- Defines ------------------------------------- */
+
+#define  TC_PYRAMID_FANOUT    16U    ///< Samples per level-0 bucket, and buckets per parent
+#define  TC_PYRAMID_LEVELS    8U     ///< Levels; the top bucket spans 16^8 samples
+
+
+/* --------------------------------------- Types -------------------------------------- */
+
+/** @brief Extrema of one bucket */
+typedef struct
+{
+    double minVoltage;    /**< Smallest voltage in mV */
+    double maxVoltage;    /**< Largest voltage in mV */
+} PyramidBucket;
+
+/** @brief Buckets of one level */
+typedef struct
+{
+    PyramidBucket *pBucket;    /**< Buckets, oldest first */
+    size_t count;              /**< Buckets in use, including the open one */
+    size_t capacity;           /**< Buckets allocated */
+} PyramidLevel;
+
+/** @brief Pyramid of one channel */
+typedef struct
+{
+    ThermocoupleType type;                     /**< Thermocouple type of the channel */
+    uint64_t samples;                          /**< Samples appended */
+    PyramidLevel level[TC_PYRAMID_LEVELS];     /**< Level @c k buckets span FANOUT^(k+1) samples */
+} TemperaturePyramid;
+
+
+/* ------------------------------------- Prototype ------------------------------------- */
+
+/**
+ * @brief  Initializes an empty pyramid.
+ *
+ * @param[out] pPyramid  Pyramid.
+ * @param[in]  type      Thermocouple type as defined in the @c ThermocoupleType enum.
+ */
+void TC_Pyramid_Init(TemperaturePyramid *pPyramid, ThermocoupleType type);
+
+/**
+ * @brief  Releases the memory of a pyramid.
+ *
+ * @param[in] pPyramid  Pyramid.
+ */
+void TC_Pyramid_Destroy(TemperaturePyramid *pPyramid);
+
+/**
+ * @brief  Appends samples.
+ *
+ * @details
+ * Costs one comparison pair per sample at level 0 and, per higher level, a refold of the
+ * buckets whose children changed.
+ *
+ * @param[in] pPyramid  Pyramid.
+ * @param[in] pVoltage  @p count voltages in mV.
+ * @param[in] count     Number of samples.
+ *
+ * @return 1 on success, or 0 if a level could not grow; the pyramid is then unchanged.
+ */
+uint8_t TC_Pyramid_Append(TemperaturePyramid *pPyramid, const double *pVoltage, size_t count);
+
+/**
+ * @brief  Computes the temperature extrema of each pixel column of a time range.
+ *
+ * @details
+ * The range is rounded outwards to whole buckets of the chosen level, and each column
+ * covers a whole number of those buckets. The 2 x columns extrema are converted with
+ * @c TC_CalculateTemperatureArray in @c TC_MODE_FAST, bit-identical to
+ * @c TC_CalculateTemperature, and each pair is put in order. A column that straddles a
+ * segment join also converts the two voltages around the join (see
+ * @ref TC_GetInverseJoins). An extremum out of the type's range yields
+ * @c TC_CONVERSION_FAILED.
+ *
+ * @param[in]  pPyramid         Pyramid.
+ * @param[in]  firstSample      First sample of the range.
+ * @param[in]  sampleCount      Samples in the range.
+ * @param[in]  pixels           Columns wanted.
+ * @param[out] pMinTemperature  Receives a lower bound of each column in °C, never above
+ *                              the column's smallest converted sample.
+ * @param[out] pMaxTemperature  Receives an upper bound of each column in °C, never below
+ *                              the column's largest converted sample.
+ *
+ * @return Number of columns written, at most @p pixels; fewer when the range holds
+ *         fewer level-0 buckets than @p pixels.
+ */
+size_t TC_Pyramid_Render(const TemperaturePyramid *pPyramid, uint64_t firstSample, uint64_t sampleCount,
+                         size_t pixels, double *pMinTemperature, double *pMaxTemperature);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* thermocouple_pyramid.h */
@@ -0,0 +1,200 @@
+/**
+ * @file    thermocouple_ring.c
+ * @author  Amirhossein Askari
+ * @version v1.0.0
+ * @date    2026-10-16
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Source file for the lock-free sample block ring.
+ *
+ * @details
+ * Implements the single-producer/single-consumer block ring with C11 acquire/release
+ * atomics. @c head and @c tail count blocks monotonically; slot @c i of the ring is
+ * @c i & (capacity - 1).
+ */
+
+
+/* ------------------------------------- Includes -------------------------------------- */
+
+#include "thermocouple_ring.h"    ///< Header file for the sample ring
+
+
+
+/* ------------------------------------- Functions ------------------------------------- */
+
+/**
+ * @brief  Initializes a sample ring over caller-provided storage.
+ *
+ * @param[out] pRing      Ring to initialize.
+ * @param[in]  pStorage   Slot storage of at least @p capacity * @p blockSize samples.
+ * @param[in]  pCounts    Array of @p capacity sample counts.
+ * @param[in]  capacity   Number of slots; must be a power of two.
+ * @param[in]  blockSize  Maximum number of samples per slot.
+ *
+ * @return 1 on success, or 0 if an argument is invalid.
+ */
+uint8_t TC_Ring_Init(SampleRing *pRing, double *pStorage, size_t *pCounts, size_t capacity, size_t blockSize)
+{
+    uint8_t result = 1U;
+
+    if ((pRing == NULL) || (pStorage == NULL) || (pCounts == NULL) || (blockSize == 0U) ||
+        (capacity == 0U) || ((capacity & (capacity - 1U)) != 0U))
+    {
+        result = 0U;
+    }
+    else
+    {
+        atomic_init(&pRing->head, 0U);
+        atomic_init(&pRing->tail, 0U);
+        pRing->cachedTail = 0U;
+        pRing->cachedHead = 0U;
+        pRing->readOffset = 0U;
+        pRing->pStorage   = pStorage;
+        pRing->pCounts    = pCounts;
+        pRing->capacity   = capacity;
+        pRing->blockSize  = blockSize;
+    }
+
+    return result;
+}
+
+/**
+ * @brief  Returns the next free slot for the producer to fill.
+ *
+ * @details
+ * Reloads the consumer index only when the cached copy says the ring is full.
+ *
+ * @param[in] pRing  Ring.
+ *
+ * @return Slot of @c blockSize samples, or NULL if the ring is full.
+ */
+double *TC_Ring_AcquireWrite(SampleRing *pRing)
+{
+    const size_t head = atomic_load_explicit(&pRing->head, memory_order_relaxed);
+    double *pSlot     = NULL;
+
+    if ((head - pRing->cachedTail) == pRing->capacity)
+    {
+        pRing->cachedTail = atomic_load_explicit(&pRing->tail, memory_order_acquire);
+    }
+    if ((head - pRing->cachedTail) < pRing->capacity)
+    {
+        pSlot = &pRing->pStorage[(head & (pRing->capacity - 1U)) * pRing->blockSize];
+    }
+
+    return pSlot;
+}
+
+/**
+ * @brief  Publishes the slot returned by @ref TC_Ring_AcquireWrite to the consumer.
+ *
+ * @param[in] pRing  Ring.
+ * @param[in] count  Number of samples written to the slot; clamped to @c blockSize.
+ */
+void TC_Ring_CommitWrite(SampleRing *pRing, size_t count)
+{
+    const size_t head = atomic_load_explicit(&pRing->head, memory_order_relaxed);
+
+    pRing->pCounts[head & (pRing->capacity - 1U)] = (count < pRing->blockSize) ? count : pRing->blockSize;
+    atomic_store_explicit(&pRing->head, head + 1U, memory_order_release);
+}
+
+/**
+ * @brief  Returns the oldest committed slot for the consumer to read.
+ *
+ * @details
+ * Reloads the producer index only when the cached copy says the ring is empty.
+ *
+ * @param[in]  pRing   Ring.
+ * @param[out] pCount  Receives the number of samples left in the slot.
+ *
+ * @return First sample not yet drained from the slot, or NULL if the ring is empty.
+ */
+const double *TC_Ring_AcquireRead(SampleRing *pRing, size_t *pCount)
+{
+    const size_t tail   = atomic_load_explicit(&pRing->tail, memory_order_relaxed);
+    const double *pSlot = NULL;
+
+    if (tail == pRing->cachedHead)
+    {
+        pRing->cachedHead = atomic_load_explicit(&pRing->head, memory_order_acquire);
+    }
+    if (tail != pRing->cachedHead)
+    {
+        const size_t slot = tail & (pRing->capacity - 1U);
+        pSlot   = &pRing->pStorage[(slot * pRing->blockSize) + pRing->readOffset];
+        *pCount = pRing->pCounts[slot] - pRing->readOffset;
+    }
+
+    return pSlot;
+}
+
+/**
+ * @brief  Returns the slot obtained from @ref TC_Ring_AcquireRead to the producer.
+ *
+ * @param[in] pRing  Ring.
+ */
+void TC_Ring_Release(SampleRing *pRing)
+{
+    const size_t tail = atomic_load_explicit(&pRing->tail, memory_order_relaxed);
+
+    pRing->readOffset = 0U;
+    atomic_store_explicit(&pRing->tail, tail + 1U, memory_order_release);
+}
+
+/**
+ * @brief  Converts committed blocks to temperatures and releases them.
+ *
+ * @details
+ * A block larger than the space left is converted in part and stays acquired, with
+ * @c readOffset marking where the next call resumes.
+ *
+ * @param[in]  pRing         Ring (consumer side).
+ * @param[in]  type          Thermocouple type.
+ * @param[in]  mode          Conversion mode as defined in the @c ConversionMode enum.
+ * @param[out] pTemperature  Receives the temperatures in degrees Celsius.
+ * @param[in]  capacity      Length of @p pTemperature in samples.
+ * @param[out] pFailed       Optional; receives the number of samples set to @c TC_CONVERSION_FAILED.
+ *
+ * @return Number of samples written to @p pTemperature.
+ */
+size_t TC_Ring_Drain(SampleRing *pRing, ThermocoupleType type, ConversionMode mode,
+                     double *pTemperature, size_t capacity, size_t *pFailed)
+{
+    size_t written = 0U;
+    size_t failed  = 0U;
+    size_t count   = 0U;
+    const double *pSlot;
+
+    if ((pRing != NULL) && (pTemperature != NULL))
+    {
+        pSlot = TC_Ring_AcquireRead(pRing, &count);
+        while ((pSlot != NULL) && (written < capacity))
+        {
+            const size_t run = (count < (capacity - written)) ? count : (capacity - written);
+
+            failed  += TC_CalculateTemperatureArray(type, pSlot, &pTemperature[written], run, mode);
+            written += run;
+            if (run == count)
+            {
+                TC_Ring_Release(pRing);
+                pSlot = TC_Ring_AcquireRead(pRing, &count);
+            }
+            else
+            {
+                pRing->readOffset += run;
+                pSlot = NULL;
+            }
+        }
+    }
+
+    if (pFailed != NULL)
+    {
+        *pFailed = failed;
+    }
+
+    return written;
+}
+
+
+/* thermocouple_ring.c */
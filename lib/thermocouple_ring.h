@@ -0,0 +1,143 @@
+/**
+ * @file    thermocouple_ring.h
+ * @author  Amirhossein Askari
+ * @version v1.0.0
+ * @date    2026-10-16
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Header file for the lock-free sample block ring.
+ *
+ * @details
+ * A single-producer/single-consumer ring of fixed-size voltage blocks for handing samples
+ * from an acquisition thread to a conversion thread without locks. The producer fills a
+ * slot in place and commits it; the consumer drains committed slots through
+ * @c TC_CalculateTemperatureArray. Slot storage is supplied by the caller, so the ring
+ * never allocates.
+ *
+ * @note
+ * The producer and consumer indices sit on separate cache lines, and each side keeps a
+ * cached copy of the other side's index. A hand-over therefore costs one release store,
+ * and the other side only reloads the shared index when the ring looks full or empty.
+ * The source requires C11 atomics.
+ *
+ * @warning
+ * Exactly one thread may call the producer functions and exactly one thread the consumer
+ * functions at any time.
+ */
+
+
+#ifndef _THERMOCOUPLE_RING_H
+#define _THERMOCOUPLE_RING_H
+
+/* ------------------------------------- Includes ------------------------------------- */
+
+#include "thermocouple_atomic.h"    ///< Atomic members and cache-line alignment
+#include "thermocouple_sensor.h"    ///< Thermocouple types and batch conversions
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/* --------------------------------------- Types -------------------------------------- */
+
+/** @brief Single-producer/single-consumer ring of voltage blocks */
+typedef struct
+{
+    TC_CACHE_ALIGNED TC_ATOMIC(size_t) head;    /**< Blocks committed by the producer */
+    size_t cachedTail;                          /**< Producer's last view of @c tail */
+
+    TC_CACHE_ALIGNED TC_ATOMIC(size_t) tail;    /**< Blocks released by the consumer */
+    size_t cachedHead;                          /**< Consumer's last view of @c head */
+    size_t readOffset;                          /**< Samples of the oldest slot already drained */
+
+    TC_CACHE_ALIGNED double *pStorage;          /**< Slot storage, @c capacity * @c blockSize samples */
+    size_t *pCounts;                            /**< Number of valid samples in each slot */
+    size_t capacity;                            /**< Number of slots, a power of two */
+    size_t blockSize;                           /**< Samples per slot */
+} SampleRing;
+
+
+/* ------------------------------------- Prototype ------------------------------------- */
+
+/**
+ * @brief  Initializes a sample ring over caller-provided storage.
+ *
+ * @param[out] pRing      Ring to initialize.
+ * @param[in]  pStorage   Slot storage of at least @p capacity * @p blockSize samples.
+ * @param[in]  pCounts    Array of @p capacity sample counts.
+ * @param[in]  capacity   Number of slots; must be a power of two.
+ * @param[in]  blockSize  Maximum number of samples per slot.
+ *
+ * @return 1 on success, or 0 if an argument is invalid.
+ *
+ * @note Call before the producer and consumer threads start.
+ */
+uint8_t TC_Ring_Init(SampleRing *pRing, double *pStorage, size_t *pCounts, size_t capacity, size_t blockSize);
+
+/**
+ * @brief  Returns the next free slot for the producer to fill.
+ *
+ * @param[in] pRing  Ring.
+ *
+ * @return Slot of @c blockSize samples, or NULL if the ring is full. Repeated calls
+ *         return the same slot until it is committed.
+ */
+double *TC_Ring_AcquireWrite(SampleRing *pRing);
+
+/**
+ * @brief  Publishes the slot returned by @ref TC_Ring_AcquireWrite to the consumer.
+ *
+ * @param[in] pRing  Ring.
+ * @param[in] count  Number of samples written to the slot; clamped to @c blockSize.
+ */
+void TC_Ring_CommitWrite(SampleRing *pRing, size_t count);
+
+/**
+ * @brief  Returns the oldest committed slot for the consumer to read.
+ *
+ * @param[in]  pRing   Ring.
+ * @param[out] pCount  Receives the number of samples left in the slot.
+ *
+ * @return First sample not yet drained from the slot, or NULL if the ring is empty. The
+ *         slot stays valid until @ref TC_Ring_Release is called.
+ */
+const double *TC_Ring_AcquireRead(SampleRing *pRing, size_t *pCount);
+
+/**
+ * @brief  Returns the slot obtained from @ref TC_Ring_AcquireRead to the producer.
+ *
+ * @param[in] pRing  Ring.
+ */
+void TC_Ring_Release(SampleRing *pRing);
+
+/**
+ * @brief  Converts committed blocks to temperatures and releases them.
+ *
+ * @details
+ * Takes blocks oldest first and converts them from their slots straight into
+ * @p pTemperature with @ref TC_CalculateTemperatureArray until @p capacity samples are
+ * written or the ring is empty. A block that does not fit is converted in part: the ring
+ * remembers how far it was drained, and the next call resumes there. A slot is released
+ * once all of its samples are drained, so any @p capacity above 0 makes progress.
+ *
+ * @param[in]  pRing         Ring (consumer side).
+ * @param[in]  type          Thermocouple type.
+ * @param[in]  mode          @c TC_MODE_FAST or @c TC_MODE_EXACT.
+ * @param[out] pTemperature  Receives the temperatures in degrees Celsius.
+ * @param[in]  capacity      Length of @p pTemperature in samples.
+ * @param[out] pFailed       Optional; receives the number of samples set to @c TC_CONVERSION_FAILED.
+ *
+ * @return Number of samples written to @p pTemperature; 0 only if the ring is empty or
+ *         @p capacity is 0.
+ */
+size_t TC_Ring_Drain(SampleRing *pRing, ThermocoupleType type, ConversionMode mode,
+                     double *pTemperature, size_t capacity, size_t *pFailed);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* thermocouple_ring.h */
@@ -0,0 +1,553 @@
+/**
+ * @file    thermocouple_scheduler.c
+ * @author  Amirhossein Askari
+ * @version v1.0.0
+ * @date    2026-10-16
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Source file for the work-stealing conversion scheduler.
+ *
+ * @details
+ * Each worker owns a fixed-size Chase-Lev deque of sample ranges: the owner pushes and
+ * pops at the bottom, thieves take from the top. Idle workers sleep on a condition
+ * variable; an epoch counter bumped on every push, submission and stop makes sure a
+ * worker never goes to sleep after missing new work.
+ */
+
+
+/* ------------------------------------- Includes -------------------------------------- */
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE                     ///< sysconf(_SC_NPROCESSORS_ONLN)
+#endif
+#include "thermocouple_scheduler.h"    ///< Header file for the scheduler
+#include <stdlib.h>                    ///< aligned_alloc, free
+#include <unistd.h>                    ///< sysconf
+
+
+
+/* --------------------------------------- Types --------------------------------------- */
+
+/** @brief Range of samples of one job */
+typedef struct
+{
+    ConversionJob *pJob;    /**< Job the range belongs to */
+    size_t begin;           /**< First sample */
+    size_t end;             /**< One past the last sample */
+} Task;
+
+/** @brief Deque slot; read by thieves while the owner may be reusing it */
+typedef struct
+{
+    TC_ATOMIC(ConversionJob *) pJob;
+    TC_ATOMIC(size_t) begin;
+    TC_ATOMIC(size_t) end;
+} TaskSlot;
+
+/** @brief Worker state */
+struct SchedulerWorker
+{
+    TC_CACHE_ALIGNED TC_ATOMIC(ptrdiff_t) top;       /**< Next slot thieves take */
+    TC_CACHE_ALIGNED TC_ATOMIC(ptrdiff_t) bottom;    /**< Next slot the owner pushes */
+    TaskSlot slots[TC_SCHED_DEQUE_SIZE];             /**< Ring of deque slots */
+    Scheduler *pScheduler;                           /**< Owning scheduler */
+    pthread_t thread;                                /**< Worker thread */
+    uint32_t seed;                                   /**< Victim selection state */
+};
+
+
+
+/* ------------------------------------- Functions ------------------------------------- */
+
+/**
+ * @brief  Pushes a range onto the bottom of the owner's deque.
+ *
+ * @param[in] pWorker  Owning worker.
+ * @param[in] pTask    Range to push.
+ *
+ * @return 1 on success, or 0 if the deque is full.
+ */
+static uint8_t Deque_Push(SchedulerWorker *pWorker, const Task *pTask)
+{
+    const ptrdiff_t b = atomic_load_explicit(&pWorker->bottom, memory_order_relaxed);
+    const ptrdiff_t t = atomic_load_explicit(&pWorker->top, memory_order_acquire);
+    uint8_t result = 0U;
+
+    if ((b - t) < (ptrdiff_t)TC_SCHED_DEQUE_SIZE)
+    {
+        TaskSlot *pSlot = &pWorker->slots[(size_t)b & (TC_SCHED_DEQUE_SIZE - 1U)];
+
+        atomic_store_explicit(&pSlot->pJob, pTask->pJob, memory_order_relaxed);
+        atomic_store_explicit(&pSlot->begin, pTask->begin, memory_order_relaxed);
+        atomic_store_explicit(&pSlot->end, pTask->end, memory_order_relaxed);
+        atomic_thread_fence(memory_order_release);
+        atomic_store_explicit(&pWorker->bottom, b + 1, memory_order_relaxed);
+        result = 1U;
+    }
+
+    return result;
+}
+
+/**
+ * @brief  Reads a deque slot.
+ *
+ * @param[in]  pWorker  Worker owning the deque.
+ * @param[in]  index    Deque position.
+ * @param[out] pTask    Receives the range.
+ */
+static void Deque_Read(SchedulerWorker *pWorker, ptrdiff_t index, Task *pTask)
+{
+    TaskSlot *pSlot = &pWorker->slots[(size_t)index & (TC_SCHED_DEQUE_SIZE - 1U)];
+
+    pTask->pJob  = atomic_load_explicit(&pSlot->pJob, memory_order_relaxed);
+    pTask->begin = atomic_load_explicit(&pSlot->begin, memory_order_relaxed);
+    pTask->end   = atomic_load_explicit(&pSlot->end, memory_order_relaxed);
+}
+
+/**
+ * @brief  Pops the newest range from the bottom of the owner's deque.
+ *
+ * @param[in]  pWorker  Owning worker.
+ * @param[out] pTask    Receives the range.
+ *
+ * @return 1 if a range was taken, or 0 if the deque is empty.
+ */
+static uint8_t Deque_Pop(SchedulerWorker *pWorker, Task *pTask)
+{
+    const ptrdiff_t b = atomic_load_explicit(&pWorker->bottom, memory_order_relaxed) - 1;
+    ptrdiff_t t;
+    uint8_t result = 0U;
+
+    atomic_store_explicit(&pWorker->bottom, b, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+    t = atomic_load_explicit(&pWorker->top, memory_order_relaxed);
+
+    if (t <= b)
+    {
+        Deque_Read(pWorker, b, pTask);
+        result = 1U;
+        if (t == b)
+        {
+            /* Last range: race the thieves for it */
+            if (!atomic_compare_exchange_strong_explicit(&pWorker->top, &t, t + 1, memory_order_seq_cst,
+                                                         memory_order_relaxed))
+            {
+                result = 0U;
+            }
+            atomic_store_explicit(&pWorker->bottom, b + 1, memory_order_relaxed);
+        }
+    }
+    else
+    {
+        atomic_store_explicit(&pWorker->bottom, b + 1, memory_order_relaxed);
+    }
+
+    return result;
+}
+
+/**
+ * @brief  Steals the oldest range from the top of another worker's deque.
+ *
+ * @param[in]  pVictim  Worker to steal from.
+ * @param[out] pTask    Receives the range.
+ *
+ * @return 1 if a range was stolen, otherwise 0.
+ */
+static uint8_t Deque_Steal(SchedulerWorker *pVictim, Task *pTask)
+{
+    ptrdiff_t t = atomic_load_explicit(&pVictim->top, memory_order_acquire);
+    ptrdiff_t b;
+    uint8_t result = 0U;
+
+    atomic_thread_fence(memory_order_seq_cst);
+    b = atomic_load_explicit(&pVictim->bottom, memory_order_acquire);
+
+    if (t < b)
+    {
+        Deque_Read(pVictim, t, pTask);
+        if (atomic_compare_exchange_strong_explicit(&pVictim->top, &t, t + 1, memory_order_seq_cst,
+                                                    memory_order_relaxed))
+        {
+            result = 1U;
+        }
+    }
+
+    return result;
+}
+
+/**
+ * @brief  Makes new work visible to idle workers and wakes them if any are asleep.
+ *
+ * @param[in] pScheduler  Scheduler.
+ */
+static void Scheduler_Notify(Scheduler *pScheduler)
+{
+    (void)atomic_fetch_add(&pScheduler->epoch, 1U);
+    if (atomic_load(&pScheduler->sleepers) != 0U)
+    {
+        (void)pthread_mutex_lock(&pScheduler->lock);
+        (void)pthread_cond_broadcast(&pScheduler->wake);
+        (void)pthread_mutex_unlock(&pScheduler->lock);
+    }
+}
+
+/**
+ * @brief  Takes the oldest job from the injection queue as one range.
+ *
+ * @param[in]  pScheduler  Scheduler.
+ * @param[out] pTask       Receives the whole job.
+ *
+ * @return 1 if a job was taken, otherwise 0.
+ */
+static uint8_t Scheduler_TakeInjected(Scheduler *pScheduler, Task *pTask)
+{
+    ConversionJob *pJob = NULL;
+
+    if (atomic_load_explicit(&pScheduler->injected, memory_order_relaxed) != 0U)
+    {
+        (void)pthread_mutex_lock(&pScheduler->lock);
+        pJob = pScheduler->pHead;
+        if (pJob != NULL)
+        {
+            pScheduler->pHead = pJob->pNext;
+            if (pScheduler->pHead == NULL)
+            {
+                pScheduler->pTail = NULL;
+            }
+            (void)atomic_fetch_sub_explicit(&pScheduler->injected, 1U, memory_order_relaxed);
+        }
+        (void)pthread_mutex_unlock(&pScheduler->lock);
+    }
+
+    if (pJob != NULL)
+    {
+        pTask->pJob  = pJob;
+        pTask->begin = 0U;
+        pTask->end   = pJob->count;
+    }
+
+    return (pJob != NULL) ? 1U : 0U;
+}
+
+/**
+ * @brief  Looks for a range to steal, starting from a random victim.
+ *
+ * @param[in]  pWorker  Thief.
+ * @param[out] pTask    Receives the range.
+ *
+ * @return 1 if a range was stolen, otherwise 0.
+ */
+static uint8_t Worker_Steal(SchedulerWorker *pWorker, Task *pTask)
+{
+    Scheduler *pScheduler = pWorker->pScheduler;
+    const size_t count    = pScheduler->workerCount;
+    uint8_t result = 0U;
+    size_t start;
+    size_t i;
+
+    /* xorshift32 */
+    pWorker->seed ^= pWorker->seed << 13;
+    pWorker->seed ^= pWorker->seed >> 17;
+    pWorker->seed ^= pWorker->seed << 5;
+    start = (size_t)pWorker->seed % count;
+
+    for (i = 0U; (i < count) && (result == 0U); ++i)
+    {
+        SchedulerWorker *pVictim = &pScheduler->pWorkers[(start + i) % count];
+        if (pVictim != pWorker)
+        {
+            result = Deque_Steal(pVictim, pTask);
+        }
+    }
+
+    return result;
+}
+
+/**
+ * @brief  Converts a range, first splitting off upper halves for other workers to steal.
+ *
+ * @param[in] pWorker  Worker running the range.
+ * @param[in] pTask    Range to convert.
+ */
+static void Worker_Run(SchedulerWorker *pWorker, const Task *pTask)
+{
+    Scheduler *pScheduler = pWorker->pScheduler;
+    ConversionJob *pJob   = pTask->pJob;
+    Task task             = *pTask;
+    size_t count;
+    size_t failed;
+
+    while ((task.end - task.begin) > TC_SCHED_CHUNK_SIZE)
+    {
+        const size_t half = (task.end - task.begin) / 2U;
+        const size_t mid  = task.begin + (((half + TC_SCHED_CHUNK_SIZE - 1U) / TC_SCHED_CHUNK_SIZE) * TC_SCHED_CHUNK_SIZE);
+        const Task upper  = { pJob, mid, task.end };
+
+        if (Deque_Push(pWorker, &upper) == 0U)
+        {
+            break;
+        }
+        Scheduler_Notify(pScheduler);
+        task.end = mid;
+    }
+
+    count  = task.end - task.begin;
+    failed = TC_CalculateTemperatureArray(pJob->type, &pJob->pVoltage[task.begin], &pJob->pTemperature[task.begin],
+                                          count, pJob->mode);
+
+    (void)atomic_fetch_add_explicit(&pJob->failed, failed, memory_order_relaxed);
+    if (atomic_fetch_sub_explicit(&pJob->remaining, count, memory_order_acq_rel) == count)
+    {
+        if (atomic_fetch_sub_explicit(&pScheduler->pending, 1U, memory_order_acq_rel) == 1U)
+        {
+            (void)pthread_mutex_lock(&pScheduler->lock);
+            (void)pthread_cond_broadcast(&pScheduler->done);
+            (void)pthread_mutex_unlock(&pScheduler->lock);
+        }
+    }
+}
+
+/**
+ * @brief  Worker thread: runs its own ranges, then stolen ones, then injected jobs.
+ *
+ * @param[in] pArg  Worker.
+ *
+ * @return NULL.
+ */
+static void *Worker_Main(void *pArg)
+{
+    SchedulerWorker *pWorker = (SchedulerWorker *)pArg;
+    Scheduler *pScheduler    = pWorker->pScheduler;
+    uint8_t running = 1U;
+    Task task;
+
+    while (running != 0U)
+    {
+        const size_t epoch = atomic_load(&pScheduler->epoch);
+
+        if ((Deque_Pop(pWorker, &task) != 0U) || (Worker_Steal(pWorker, &task) != 0U) ||
+            (Scheduler_TakeInjected(pScheduler, &task) != 0U))
+        {
+            Worker_Run(pWorker, &task);
+        }
+        else if (atomic_load(&pScheduler->stop) != 0U)
+        {
+            running = 0U;
+        }
+        else
+        {
+            /* Sleep unless work arrived since the scan started */
+            (void)pthread_mutex_lock(&pScheduler->lock);
+            (void)atomic_fetch_add(&pScheduler->sleepers, 1U);
+            if ((atomic_load(&pScheduler->epoch) == epoch) && (atomic_load(&pScheduler->stop) == 0U))
+            {
+                (void)pthread_cond_wait(&pScheduler->wake, &pScheduler->lock);
+            }
+            (void)atomic_fetch_sub(&pScheduler->sleepers, 1U);
+            (void)pthread_mutex_unlock(&pScheduler->lock);
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief  Creates the worker threads of a scheduler.
+ *
+ * @param[out] pScheduler   Scheduler to initialize.
+ * @param[in]  workerCount  Number of workers; 0 uses one per online CPU.
+ *
+ * @return 1 on success, or 0 if memory or threads could not be obtained.
+ */
+uint8_t TC_Scheduler_Init(Scheduler *pScheduler, size_t workerCount)
+{
+    uint8_t result = 1U;
+    size_t started = 0U;
+    size_t i;
+
+    if (pScheduler == NULL)
+    {
+        result = 0U;
+    }
+    else
+    {
+        if (workerCount == 0U)
+        {
+            const long online = sysconf(_SC_NPROCESSORS_ONLN);
+            workerCount = (online > 0) ? (size_t)online : 1U;
+        }
+
+        pScheduler->pWorkers    = (SchedulerWorker *)aligned_alloc(TC_CACHE_LINE_SIZE, workerCount * sizeof(SchedulerWorker));
+        pScheduler->workerCount = workerCount;
+        pScheduler->pHead       = NULL;
+        pScheduler->pTail       = NULL;
+        atomic_init(&pScheduler->injected, 0U);
+        atomic_init(&pScheduler->pending, 0U);
+        atomic_init(&pScheduler->epoch, 0U);
+        atomic_init(&pScheduler->sleepers, 0U);
+        atomic_init(&pScheduler->stop, 0U);
+
+        if (pScheduler->pWorkers == NULL)
+        {
+            result = 0U;
+        }
+        else if ((pthread_mutex_init(&pScheduler->lock, NULL) != 0) || (pthread_cond_init(&pScheduler->wake, NULL) != 0) ||
+                 (pthread_cond_init(&pScheduler->done, NULL) != 0))
+        {
+            free(pScheduler->pWorkers);
+            result = 0U;
+        }
+        else
+        {
+            for (i = 0U; i < workerCount; ++i)
+            {
+                SchedulerWorker *pWorker = &pScheduler->pWorkers[i];
+                atomic_init(&pWorker->top, 0);
+                atomic_init(&pWorker->bottom, 0);
+                pWorker->pScheduler = pScheduler;
+                pWorker->seed       = ((uint32_t)i * 2654435761U) + 1U;
+            }
+
+            while ((started < workerCount) && (result != 0U))
+            {
+                if (pthread_create(&pScheduler->pWorkers[started].thread, NULL, Worker_Main,
+                                   &pScheduler->pWorkers[started]) != 0)
+                {
+                    result = 0U;
+                }
+                else
+                {
+                    ++started;
+                }
+            }
+
+            if (result == 0U)
+            {
+                atomic_store(&pScheduler->stop, 1U);
+                Scheduler_Notify(pScheduler);
+                for (i = 0U; i < started; ++i)
+                {
+                    (void)pthread_join(pScheduler->pWorkers[i].thread, NULL);
+                }
+                (void)pthread_cond_destroy(&pScheduler->done);
+                (void)pthread_cond_destroy(&pScheduler->wake);
+                (void)pthread_mutex_destroy(&pScheduler->lock);
+                free(pScheduler->pWorkers);
+            }
+        }
+    }
+
+    return result;
+}
+
+/**
+ * @brief  Queues a conversion job.
+ *
+ * @param[in]     pScheduler  Scheduler.
+ * @param[in,out] pJob        Job with its first five members filled in.
+ *
+ * @return 1 on success, or 0 if an argument is invalid.
+ */
+uint8_t TC_Scheduler_Submit(Scheduler *pScheduler, ConversionJob *pJob)
+{
+    uint8_t result = 1U;
+
+    if ((pScheduler == NULL) || (pJob == NULL) || (pJob->pVoltage == NULL) || (pJob->pTemperature == NULL))
+    {
+        result = 0U;
+    }
+    else
+    {
+        atomic_init(&pJob->remaining, pJob->count);
+        atomic_init(&pJob->failed, 0U);
+        pJob->pNext = NULL;
+
+        if (pJob->count != 0U)
+        {
+            (void)atomic_fetch_add(&pScheduler->pending, 1U);
+
+            (void)pthread_mutex_lock(&pScheduler->lock);
+            if (pScheduler->pTail != NULL)
+            {
+                pScheduler->pTail->pNext = pJob;
+            }
+            else
+            {
+                pScheduler->pHead = pJob;
+            }
+            pScheduler->pTail = pJob;
+            (void)atomic_fetch_add_explicit(&pScheduler->injected, 1U, memory_order_relaxed);
+            (void)pthread_mutex_unlock(&pScheduler->lock);
+
+            Scheduler_Notify(pScheduler);
+        }
+    }
+
+    return result;
+}
+
+/**
+ * @brief  Returns whether a submitted job has completed.
+ *
+ * @param[in]  pJob     Submitted job.
+ * @param[out] pFailed  Optional; receives the number of samples set to @c TC_CONVERSION_FAILED.
+ *
+ * @return 1 if every sample of the job has been converted, otherwise 0.
+ */
+uint8_t TC_Scheduler_JobDone(const ConversionJob *pJob, size_t *pFailed)
+{
+    const uint8_t done = (atomic_load_explicit(&pJob->remaining, memory_order_acquire) == 0U) ? 1U : 0U;
+
+    if ((done != 0U) && (pFailed != NULL))
+    {
+        *pFailed = atomic_load_explicit(&pJob->failed, memory_order_relaxed);
+    }
+
+    return done;
+}
+
+/**
+ * @brief  Blocks until every submitted job has completed.
+ *
+ * @param[in] pScheduler  Scheduler.
+ */
+void TC_Scheduler_Wait(Scheduler *pScheduler)
+{
+    (void)pthread_mutex_lock(&pScheduler->lock);
+    while (atomic_load(&pScheduler->pending) != 0U)
+    {
+        (void)pthread_cond_wait(&pScheduler->done, &pScheduler->lock);
+    }
+    (void)pthread_mutex_unlock(&pScheduler->lock);
+}
+
+/**
+ * @brief  Completes the outstanding jobs, stops the workers and frees the scheduler.
+ *
+ * @param[in] pScheduler  Scheduler initialized by @ref TC_Scheduler_Init.
+ */
+void TC_Scheduler_Destroy(Scheduler *pScheduler)
+{
+    size_t i;
+
+    if (pScheduler != NULL)
+    {
+        TC_Scheduler_Wait(pScheduler);
+        atomic_store(&pScheduler->stop, 1U);
+        Scheduler_Notify(pScheduler);
+
+        for (i = 0U; i < pScheduler->workerCount; ++i)
+        {
+            (void)pthread_join(pScheduler->pWorkers[i].thread, NULL);
+        }
+
+        (void)pthread_cond_destroy(&pScheduler->done);
+        (void)pthread_cond_destroy(&pScheduler->wake);
+        (void)pthread_mutex_destroy(&pScheduler->lock);
+        free(pScheduler->pWorkers);
+        pScheduler->pWorkers = NULL;
+    }
+}
+
+
+/* thermocouple_scheduler.c */
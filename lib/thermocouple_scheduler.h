@@ -0,0 +1,153 @@
+/**
+ * @file    thermocouple_scheduler.h
+ * @author  Amirhossein Askari
+ * @version v1.0.0
+ * @date    2026-10-16
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Header file for the work-stealing conversion scheduler.
+ *
+ * @details
+ * A pool of worker threads that runs conversion jobs of any size and any thermocouple type.
+ * Submitted jobs go to a shared injection queue. A worker that picks up a range larger than
+ * @c TC_SCHED_CHUNK_SIZE splits it in half, keeps the lower half and pushes the upper half
+ * onto its own Chase-Lev deque. Idle workers steal the oldest and largest halves from the
+ * other deques. A few very large jobs (e.g. R/S archives in exact mode) therefore spread
+ * over all cores, while small jobs never pay for splitting. Every chunk is converted with
+ * @c TC_CalculateTemperatureArray.
+ *
+ * @note
+ * Requires POSIX threads and C11 atomics. Jobs may be submitted from any thread, including
+ * from inside other jobs' workers.
+ */
+
+
+#ifndef _THERMOCOUPLE_SCHEDULER_H
+#define _THERMOCOUPLE_SCHEDULER_H
+
+/* ------------------------------------- Includes ------------------------------------- */
+
+#include <pthread.h>                 ///< Worker threads
+#include "thermocouple_atomic.h"    ///< Atomic members and cache-line alignment
+#include "thermocouple_sensor.h"    ///< Thermocouple types and batch conversions
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/* -------------------------------------- Defines ------------------------------------- */
+
+/** @brief Ranges at or below this many samples are converted without further splitting */
+#ifndef TC_SCHED_CHUNK_SIZE
+#define  TC_SCHED_CHUNK_SIZE     16384U    ///< Smallest stealable range in samples
+#endif
+
+/** @brief Capacity of each worker's deque; a power of two */
+#ifndef TC_SCHED_DEQUE_SIZE
+#define  TC_SCHED_DEQUE_SIZE     1024U     ///< Deque slots per worker
+#endif
+
+#if ((TC_SCHED_DEQUE_SIZE & (TC_SCHED_DEQUE_SIZE - 1U)) != 0U)
+#error "TC_SCHED_DEQUE_SIZE must be a power of two"
+#endif
+
+
+/* --------------------------------------- Types -------------------------------------- */
+
+/**
+ * @brief Conversion job.
+ *
+ * @details
+ * The caller fills the first five members and keeps the job alive until it completes;
+ * the remaining members are managed by the scheduler.
+ */
+typedef struct ConversionJob
+{
+    ThermocoupleType type;                  /**< Thermocouple type */
+    ConversionMode mode;                    /**< Conversion mode */
+    const double *pVoltage;                 /**< Voltages in millivolts (mV) */
+    double *pTemperature;                   /**< Receives the temperatures in degrees Celsius; may alias @c pVoltage */
+    size_t count;                           /**< Number of samples */
+
+    TC_ATOMIC(size_t) remaining;            /**< Samples not converted yet */
+    TC_ATOMIC(size_t) failed;               /**< Samples set to @c TC_CONVERSION_FAILED */
+    struct ConversionJob *pNext;            /**< Link in the injection queue */
+} ConversionJob;
+
+/** @brief Worker state (deque and thread), defined in the source file */
+typedef struct SchedulerWorker SchedulerWorker;
+
+/** @brief Work-stealing conversion scheduler */
+typedef struct
+{
+    SchedulerWorker *pWorkers;              /**< Worker array */
+    size_t workerCount;                     /**< Number of workers */
+
+    pthread_mutex_t lock;                   /**< Guards the injection queue and sleeping */
+    pthread_cond_t wake;                    /**< Signals idle workers that work arrived */
+    pthread_cond_t done;                    /**< Signals that the last pending job completed */
+    ConversionJob *pHead;                   /**< Oldest injected job */
+    ConversionJob *pTail;                   /**< Newest injected job */
+
+    TC_CACHE_ALIGNED TC_ATOMIC(size_t) injected;    /**< Jobs in the injection queue */
+    TC_ATOMIC(size_t) pending;                      /**< Submitted jobs not completed yet */
+    TC_ATOMIC(size_t) epoch;                        /**< Bumped whenever new work becomes visible */
+    TC_ATOMIC(size_t) sleepers;                     /**< Workers blocked on @c wake */
+    TC_ATOMIC(uint32_t) stop;                       /**< Set by @ref TC_Scheduler_Destroy */
+} Scheduler;
+
+
+/* ------------------------------------- Prototype ------------------------------------- */
+
+/**
+ * @brief  Creates the worker threads of a scheduler.
+ *
+ * @param[out] pScheduler   Scheduler to initialize.
+ * @param[in]  workerCount  Number of workers; 0 uses one per online CPU.
+ *
+ * @return 1 on success, or 0 if memory or threads could not be obtained.
+ */
+uint8_t TC_Scheduler_Init(Scheduler *pScheduler, size_t workerCount);
+
+/**
+ * @brief  Queues a conversion job.
+ *
+ * @param[in]     pScheduler  Scheduler.
+ * @param[in,out] pJob        Job with its first five members filled in; must stay valid until it completes.
+ *
+ * @return 1 on success, or 0 if an argument is invalid.
+ */
+uint8_t TC_Scheduler_Submit(Scheduler *pScheduler, ConversionJob *pJob);
+
+/**
+ * @brief  Returns whether a submitted job has completed.
+ *
+ * @param[in]  pJob     Submitted job.
+ * @param[out] pFailed  Optional; receives the number of samples set to @c TC_CONVERSION_FAILED.
+ *
+ * @return 1 if every sample of the job has been converted, otherwise 0.
+ */
+uint8_t TC_Scheduler_JobDone(const ConversionJob *pJob, size_t *pFailed);
+
+/**
+ * @brief  Blocks until every submitted job has completed.
+ *
+ * @param[in] pScheduler  Scheduler.
+ */
+void TC_Scheduler_Wait(Scheduler *pScheduler);
+
+/**
+ * @brief  Completes the outstanding jobs, stops the workers and frees the scheduler.
+ *
+ * @param[in] pScheduler  Scheduler initialized by @ref TC_Scheduler_Init.
+ */
+void TC_Scheduler_Destroy(Scheduler *pScheduler);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* thermocouple_scheduler.h */
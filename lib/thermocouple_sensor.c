@@ -24,558 +24,132 @@
 /* ------------------------------------- Includes -------------------------------------- */
 
 #include "thermocouple_sensor.h"    ///< Header file for thermocouple functions
+#include "thermocouple_tables.h"    ///< Coefficient tables
+#include <string.h>                 ///< memcpy for strided access
+#if defined(__SSE2__) && !defined(TC_NO_STREAMING)
+#include <emmintrin.h>              ///< Streaming stores, prefetch and fences of large conversions
+#endif
 
 
+/* -------------------------------------- Defines -------------------------------------- */
 
-/* ------------------------------------- Variables ------------------------------------- */
-
-/* -------------------------------- Thermocouple Type R -------------------------------- */
-static const double TC_Coeff_R_mVToTemp_Range1[] =
-{
-    0.0000000E+00,  1.8891380E+02, -9.3835290E+01, 1.3068619E+02,
-    -2.2703580E+02, 3.5145659E+02, -3.8953900E+02, 2.8239471E+02,
-    -1.2607281E+02, 3.1353611E+01, -3.3187769E+00
-};
-static const double TC_Coeff_R_mVToTemp_Range2[] =
-{
-    1.334584505E+01,  1.472644573E+02, -1.844024844E+01, 4.031129726E+00,
-    -6.249428360E-01, 6.468412046E-02, -4.458750426E-03, 1.994710149E-04,
-    -5.313401790E-06, 6.481976217E-08, 0.000000000E+00
-};
-static const double TC_Coeff_R_mVToTemp_Range3[] =
-{
-    -8.199599416E+01, 1.553962042E+02, -8.342197663E+00, 4.279433549E-01,
-    -1.191577910E-02, 1.492290091E-04, 0.000000000E+00,  0.000000000E+00,
-    0.000000000E+00,  0.000000000E+00, 0.000000000E+00
-};
-static const double TC_Coeff_R_mVToTemp_Range4[] =
-{
-    3.406177836E+04, -7.023729171E+03, 5.582903813E+02, -1.952394635E+01,
-    2.560740231E-01, 0.000000000E+00,  0.000000000E+00, 0.000000000E+00,
-    0.000000000E+00, 0.000000000E+00,  0.000000000E+00
-};
-static const RangePoly TC_R_mVToTemp[] =
-{
-{ -0.228, 1.923,  { TC_Coeff_R_mVToTemp_Range1, sizeof(TC_Coeff_R_mVToTemp_Range1) / sizeof(double) } },
-{ 1.923,  11.361, { TC_Coeff_R_mVToTemp_Range2, sizeof(TC_Coeff_R_mVToTemp_Range2) / sizeof(double) } },
-{ 11.361, 19.739, { TC_Coeff_R_mVToTemp_Range3, sizeof(TC_Coeff_R_mVToTemp_Range3) / sizeof(double) } },
-{ 19.739, 21.105, { TC_Coeff_R_mVToTemp_Range4, sizeof(TC_Coeff_R_mVToTemp_Range4) / sizeof(double) } }
-};
-static const size_t TC_R_mVToTemp_len = sizeof(TC_R_mVToTemp) / sizeof(TC_R_mVToTemp[0U]);
-
-static const double TC_Coeff_R_TempToMV_Range1[] =
-{
-    0.000000000000E+00, 0.528961729765E-02,  0.139166589782E-04, -0.238855693017E-07,
-    0.356916001063E-10, -0.462347666298E-13, 0.500777441034E-16, -0.373105886191E-19,
-    0.157716482367E-22, -0.281038625251E-26
-};
-static const double TC_Coeff_R_TempToMV_Range2[] =
-{
-    0.295157925316E+01,  -0.252061251332E-02, 0.159564501865E-04,
-    -0.764085947576E-08, 0.205305291024E-11,  -0.293359668173E-15
-};
-static const double TC_Coeff_R_TempToMV_Range3[] =
-{
-    0.152232118209E+03,  -0.268819888545E+00, 0.171280280471E-03,
-    -0.345895706453E-07, -0.934633971046E-14
-};
-static const RangePoly TC_R_TempToMV[] =
-{
-{ -50.5,   1064.18, { TC_Coeff_R_TempToMV_Range1, sizeof(TC_Coeff_R_TempToMV_Range1) / sizeof(double) } },
-{ 1064.18, 1664.5,  { TC_Coeff_R_TempToMV_Range2, sizeof(TC_Coeff_R_TempToMV_Range2) / sizeof(double) } },
-{ 1664.5,  1768.5,  { TC_Coeff_R_TempToMV_Range3, sizeof(TC_Coeff_R_TempToMV_Range3) / sizeof(double) } }
-};
-static const size_t TC_R_TempToMV_len = sizeof(TC_R_TempToMV) / sizeof(TC_R_TempToMV[0U]);
-
-
-/* -------------------------------- Thermocouple Type S -------------------------------- */
-static const double TC_Coeff_S_mVToTemp_Range1[] =
-{
-    0.00000000E+00,  1.84949460E+02, -8.00504062E+01, 1.02237430E+02,
-    -1.52248592E+02, 1.88821343E+02, -1.59085941E+02, 8.23027880E+01,
-    -2.34181944E+01, 2.79786260E+00
-};
-static const double TC_Coeff_S_mVToTemp_Range2[] =
-{
-    1.291507177E+01,  1.466298863E+02, -1.534713402E+01, 3.145945973E+00,
-    -4.163257839E-01, 3.187963771E-02, -1.291637500E-03, 2.183475087E-05,
-    -1.447379511E-07, 8.211272125E-09
-};
-static const double TC_Coeff_S_mVToTemp_Range3[] =
-{
-    -8.087801117E+01, 1.621573104E+02, -8.536869453E+00, 4.719686976E-01,
-    -1.441693666E-02, 2.081618890E-04, 0.000000000E+00,  0.000000000E+00,
-    0.000000000E+00,  0.000000000E+00
-};
-static const double TC_Coeff_S_mVToTemp_Range4[] =
-{
-    5.333875126E+04, -1.235892298E+04, 1.092657613E+03, -4.265693686E+01,
-    6.247205420E-01, 0.000000000E+00,  0.000000000E+00, 0.000000000E+00,
-    0.000000000E+00, 0.000000000E+00
-};
-static const RangePoly TC_S_mVToTemp[] =
-{
-{ -0.237, 1.874,  { TC_Coeff_S_mVToTemp_Range1, sizeof(TC_Coeff_S_mVToTemp_Range1) / sizeof(double) } },
-{ 1.874,  10.332, { TC_Coeff_S_mVToTemp_Range2, sizeof(TC_Coeff_S_mVToTemp_Range2) / sizeof(double) } },
-{ 10.332, 17.536, { TC_Coeff_S_mVToTemp_Range3, sizeof(TC_Coeff_S_mVToTemp_Range3) / sizeof(double) } },
-{ 17.536, 18.697, { TC_Coeff_S_mVToTemp_Range4, sizeof(TC_Coeff_S_mVToTemp_Range4) / sizeof(double) } }
-};
-static const size_t TC_S_mVToTemp_len = sizeof(TC_S_mVToTemp) / sizeof(TC_S_mVToTemp[0U]);
-
-static const double TC_Coeff_S_TempToMV_Range1[] =
-{
-    0.000000000000E+00,  0.540313308631E-02,  0.125934289740E-04,
-    -0.232477968689E-07, 0.322028823036E-10, -0.331465196389E-13,
-    0.255744251786E-16,  -0.125068871393E-19, 0.271443176145E-23
-};
-static const double TC_Coeff_S_TempToMV_Range2[] =
-{
-    0.132900444085E+01,  0.334509311344E-02, 0.654805192818E-05,
-    -0.164856259209E-08, 0.129989605174E-13
-};
-static const double TC_Coeff_S_TempToMV_Range3[] =
-{
-    0.146628232636E+03, -0.258430516752E+00, 0.163693574641E-03,
-    -0.330439046987E-07, -0.943223690612E-14
-};
-static const RangePoly TC_S_TempToMV[] =
-{
-{ -50.5,   1064.18, { TC_Coeff_S_TempToMV_Range1, sizeof(TC_Coeff_S_TempToMV_Range1) / sizeof(double) } },
-{ 1064.18, 1664.5,  { TC_Coeff_S_TempToMV_Range2, sizeof(TC_Coeff_S_TempToMV_Range2) / sizeof(double) } },
-{ 1664.5,  1768.5,  { TC_Coeff_S_TempToMV_Range3, sizeof(TC_Coeff_S_TempToMV_Range3) / sizeof(double) } }
-};
-static const size_t TC_S_TempToMV_len = sizeof(TC_S_TempToMV) / sizeof(TC_S_TempToMV[0U]);
-  
-
-/* -------------------------------- Thermocouple Type B -------------------------------- */
-static const double TC_Coeff_B_mVToTemp_Range1[] =
-{
-    9.8423321E+01, 6.9971500E+02,  -8.4765304E+02,
-    1.0052644E+03, -8.3345952E+02, 4.5508542E+02,
-    -1.5523037E+02, 2.9886750E+01, -2.4742860E+00
-};
-static const double TC_Coeff_B_mVToTemp_Range2[] =
-{
-    2.1315071E+02, 2.8510504E+02,  -5.2742887E+01,
-    9.9160804E+00, -1.2965303E+00, 1.1195870E-01,
-    -6.0625199E-03, 1.8661696E-04, -2.4878585E-06
-};
-static const RangePoly TC_B_mVToTemp[] =
-{
-{ 0.292, 2.431,  { TC_Coeff_B_mVToTemp_Range1, sizeof(TC_Coeff_B_mVToTemp_Range1) / sizeof(double) } },
-{ 2.431, 13.825, { TC_Coeff_B_mVToTemp_Range2, sizeof(TC_Coeff_B_mVToTemp_Range2) / sizeof(double) } }
-};
-static const size_t TC_B_mVToTemp_len = sizeof(TC_B_mVToTemp) / sizeof(TC_B_mVToTemp[0U]);
-
-static const double TC_Coeff_B_TempToMV_Range1[] =
-{
-    0.000000000000E+00, -0.246508183460E-03, 0.590404211710E-05, -0.132579316360E-08,
-    0.156682919010E-11, -0.169445292400E-14, 0.629903470940E-18
-};
-static const double TC_Coeff_B_TempToMV_Range2[] =
-{
-    -0.389381686210E+01, 0.285717474700E-01, -0.848851047850E-04,
-    0.157852801640E-06, -0.168353448640E-09,  0.111097940130E-12,
-    -0.445154310330E-16, 0.989756408210E-20, -0.937913302890E-24
-};
-static const RangePoly TC_B_TempToMV[] =
-{
-{ -0.5,   630.615, { TC_Coeff_B_TempToMV_Range1, sizeof(TC_Coeff_B_TempToMV_Range1) / sizeof(double) } },
-{ 630.615, 1820.5, { TC_Coeff_B_TempToMV_Range2, sizeof(TC_Coeff_B_TempToMV_Range2) / sizeof(double) } }
-};
-static const size_t TC_B_TempToMV_len = sizeof(TC_B_TempToMV) / sizeof(TC_B_TempToMV[0U]);
- 
-
-/* -------------------------------- Thermocouple Type J -------------------------------- */
-static const double TC_Coeff_J_mVToTemp_Range1[] =
-{
-    0.0000000E+00,  1.9528268E+01,  -1.2286185E+00,
-    -1.0752178E+00, -5.9086933E-01, -1.7256713E-01,
-    -2.8131513E-02, -2.3963370E-03, -8.3823321E-05
-};
-static const double TC_Coeff_J_mVToTemp_Range2[] =
-{
-    0.000000E+00, 1.978425E+01, -2.001204E-01,
-    1.036969E-02, -2.549687E-04, 3.585153E-06,
-    -5.344285E-08, 5.099890E-10, 0.000000E+00
-};
-static const double TC_Coeff_J_mVToTemp_Range3[] =
-{
-    -3.11358187E+03, 3.00543684E+02,  -9.94773230E+00,
-    1.70276630E-01,  -1.43033468E-03, 4.73886084E-06,
-    0.00000000E+00,  0.00000000E+00,  0.00000000E+00
-};
-static const RangePoly TC_J_mVToTemp[] =
-{
-{ -8.1, 0.0,     { TC_Coeff_J_mVToTemp_Range1, sizeof(TC_Coeff_J_mVToTemp_Range1) / sizeof(double) } },
-{ 0.0,   42.914, { TC_Coeff_J_mVToTemp_Range2, sizeof(TC_Coeff_J_mVToTemp_Range2) / sizeof(double) } },
-{ 42.914, 69.58, { TC_Coeff_J_mVToTemp_Range3, sizeof(TC_Coeff_J_mVToTemp_Range3) / sizeof(double) } }
-};
-static const size_t TC_J_mVToTemp_len = sizeof(TC_J_mVToTemp) / sizeof(TC_J_mVToTemp[0U]);
-
-static const double TC_Coeff_J_TempToMV_Range1[] =
-{
-    0.000000000000E+00,  0.503811878150E-01,  0.304758369300E-04,
-    -0.856810657200E-07, 0.132281952950E-09, -0.170529583370E-12,
-    0.209480906970E-15, -0.125383953360E-18,  0.156317256970E-22
-};
-static const double TC_Coeff_J_TempToMV_Range2[] =
-{
-    0.296456256810E+03, -0.149761277860E+01, 0.317871039240E-02,
-    -0.318476867010E-05, 0.157208190040E-08, -0.306913690560E-12
-};
-static const RangePoly TC_J_TempToMV[] =
-{
-{ -210.5, 760.0, { TC_Coeff_J_TempToMV_Range1, sizeof(TC_Coeff_J_TempToMV_Range1) / sizeof(double) } },
-{ 760.0, 1200.5, { TC_Coeff_J_TempToMV_Range2, sizeof(TC_Coeff_J_TempToMV_Range2) / sizeof(double) } }
-};
-static const size_t TC_J_TempToMV_len = sizeof(TC_J_TempToMV) / sizeof(TC_J_TempToMV[0U]);
-  
-
-/* -------------------------------- Thermocouple Type T -------------------------------- */
-static const double TC_Coeff_T_mVToTemp_Range1[] =
-{
-    0.0000000E+00, 2.5949192E+01, -2.1316967E-01, 7.9018692E-01,
-    4.2527777E-01, 1.3304473E-01, 2.0241446E-02,  1.2668171E-03
-};
-static const double TC_Coeff_T_mVToTemp_Range2[] =
-{
-    0.000000E+00,  2.592800E+01, -7.602961E-01, 4.637791E-02,
-    -2.165394E-03, 6.048144E-05, -7.293422E-07, 0.000000E+00
-};
-static const RangePoly TC_T_mVToTemp[] =
-{
-{ -5.61, 0.0,   { TC_Coeff_T_mVToTemp_Range1, sizeof(TC_Coeff_T_mVToTemp_Range1) / sizeof(double) } },
-{ 0.0,   20.88, { TC_Coeff_T_mVToTemp_Range2, sizeof(TC_Coeff_T_mVToTemp_Range2) / sizeof(double) } }
-};
-static const size_t TC_T_mVToTemp_len = sizeof(TC_T_mVToTemp) / sizeof(TC_T_mVToTemp[0U]);
-
-static const double TC_Coeff_T_TempToMV_Range1[] =
-{
-    0.000000000000E+00, 0.387481063640E-01, 0.441944343470E-04,
-    0.118443231050E-06, 0.200329735540E-07, 0.901380195590E-09,
-    0.226511565930E-10, 0.360711542050E-12, 0.384939398830E-14,
-    0.282135219250E-16, 0.142515947790E-18, 0.487686622860E-21,
-    0.107955392700E-23, 0.139450270620E-26, 0.797951539270E-30
-};
-static const double TC_Coeff_T_TempToMV_Range2[] =
-{
-    0.000000000000E+00, 0.387481063640E-01, 0.332922278800E-04,
-    0.206182434040E-06, -0.218822568460E-08, 0.109968809280E-10,
-    -0.308157587720E-13, 0.454791352900E-16, -0.275129016730E-19
-};
-static const RangePoly TC_T_TempToMV[] =
-{
-{ -270.5, 0.0, { TC_Coeff_T_TempToMV_Range1, sizeof(TC_Coeff_T_TempToMV_Range1) / sizeof(double) } },
-{ 0.0,  400.5, { TC_Coeff_T_TempToMV_Range2, sizeof(TC_Coeff_T_TempToMV_Range2) / sizeof(double) } }
-};
-static const size_t TC_T_TempToMV_len = sizeof(TC_T_TempToMV) / sizeof(TC_T_TempToMV[0U]);
-   
-
-/* -------------------------------- Thermocouple Type E -------------------------------- */
-static const double TC_Coeff_E_mVToTemp_Range1[] =
-{
-    0.0000000E+00,  1.6977288E+01,  -4.3514970E-01, -1.5859697E-01,
-    -9.2502871E-02, -2.6084314E-02, -4.1360199E-03, -3.4034030E-04,
-    -1.1564890E-05, 0.0000000E+00
-};
-static const double TC_Coeff_E_mVToTemp_Range2[] =
-{
-    0.0000000E+00,  1.7057035E+01, -2.3301759E-01, 6.5435585E-03,
-    -7.3562749E-05, -1.7896001E-06, 8.4036165E-08, -1.3735879E-09,
-    1.0629823E-11,  -3.2447087E-14
-};
-static const RangePoly TC_E_mVToTemp[] =
-{
-{ -8.84, 0.0, { TC_Coeff_E_mVToTemp_Range1, sizeof(TC_Coeff_E_mVToTemp_Range1) / sizeof(double) } },
-{ 0.0, 76.38, { TC_Coeff_E_mVToTemp_Range2, sizeof(TC_Coeff_E_mVToTemp_Range2) / sizeof(double) } }
-};
-static const size_t TC_E_mVToTemp_len = sizeof(TC_E_mVToTemp) / sizeof(TC_E_mVToTemp[0U]);
-
-static const double TC_Coeff_E_TempToMV_Range1[] =
-{
-    0.000000000000E+00,   0.586655087080E-01,  0.454109771240E-04, -0.779980486860E-06,
-    -0.258001608430E-07, -0.594525830570E-09, -0.932140586670E-11, -0.102876055340E-12,
-    -0.803701236210E-15, -0.439794973910E-17, -0.164147763550E-19, -0.396736195160E-22,
-    -0.558273287210E-25, -0.346578420130E-28
-};
-static const double TC_Coeff_E_TempToMV_Range2[] =
-{
-    0.000000000000E+00,  0.586655087100E-01, 0.450322755820E-04,  0.289084072120E-07,
-    -0.330568966520E-09, 0.650244032700E-12, -0.191974955040E-15, -0.125366004970E-17,
-    0.214892175690E-20, -0.143880417820E-23, 0.359608994810E-27
-}; 
-static const RangePoly TC_E_TempToMV[] =
-{
-{ -270.5, 0.0,  { TC_Coeff_E_TempToMV_Range1, sizeof(TC_Coeff_E_TempToMV_Range1) / sizeof(double) } },
-{ 0.0,  1000.5, { TC_Coeff_E_TempToMV_Range2, sizeof(TC_Coeff_E_TempToMV_Range2) / sizeof(double) } }
-};
-static const size_t TC_E_TempToMV_len = sizeof(TC_E_TempToMV) / sizeof(TC_E_TempToMV[0U]);
-
-
-/* -------------------------------- Thermocouple Type K -------------------------------- */
-static const double TC_Coeff_K_mVToTemp_Range1[] =
-{
-    0.0000000E+00,  2.5173462E+01,  -1.1662878E+00, -1.0833638E+00,
-    -8.9773540E-01, -3.7342377E-01, -8.6632643E-02, -1.0450598E-02,
-    -5.1920577E-04, 0.0000000E+00
-};
-static const double TC_Coeff_K_mVToTemp_Range2[] =
-{
-    0.000000E+00, 2.508355E+01,  7.860106E-02, -2.503131E-01,
-    8.315270E-02, -1.228034E-02, 9.804036E-04, -4.413030E-05,
-    1.057734E-06, -1.052755E-08
-};
-static const double TC_Coeff_K_mVToTemp_Range3[] =
-{
-    -1.318058E+02, 4.830222E+01, -1.646031E+00, 5.464731E-02,
-    -9.650715E-04, 8.802193E-06, -3.110810E-08, 0.000000E+00,
-    0.000000E+00,  0.000000E+00
-};
-static const RangePoly TC_K_mVToTemp[] =
-{
-{ -5.895, 0.0,    { TC_Coeff_K_mVToTemp_Range1, sizeof(TC_Coeff_K_mVToTemp_Range1) / sizeof(double) } },
-{ 0.0,    20.644, { TC_Coeff_K_mVToTemp_Range2, sizeof(TC_Coeff_K_mVToTemp_Range2) / sizeof(double) } },
-{ 20.644, 52.425, { TC_Coeff_K_mVToTemp_Range3, sizeof(TC_Coeff_K_mVToTemp_Range3) / sizeof(double) } }
-};
-static const size_t TC_K_mVToTemp_len = sizeof(TC_K_mVToTemp) / sizeof(TC_K_mVToTemp[0U]);
-
-static const double TC_Coeff_K_TempToMV_A0 =  0.118597600000E+00;
-static const double TC_Coeff_K_TempToMV_A1 = -0.118343200000E-03;
-static const double TC_Coeff_K_TempToMV_A2 =  0.126968600000E+03;
-static const double TC_Coeff_K_TempToMV_Range1[] =
-{
-    0.000000000000E+00,   0.394501280250E-01,  0.236223735980E-04, -0.328589067840E-06,
-    -0.499048287770E-08, -0.675090591730E-10, -0.574103274280E-12, -0.310888728940E-14,
-    -0.104516093650E-16, -0.198892668780E-19, -0.163226974860E-22
-};
-static const double TC_Coeff_K_TempToMV_Range2[] =
-{
-    -0.176004136860E-01, 0.389212049750E-01, 0.185587700320E-04, -0.994575928740E-07,
-    0.318409457190E-09, -0.560728448890E-12, 0.560750590590E-15, -0.320207200030E-18,
-    0.971511471520E-22, -0.121047212750E-25
-};
-  
-
-/* -------------------------------- Thermocouple Type N -------------------------------- */
-static const double TC_Coeff_N_mVToTemp_Range1[] =
-{
-    0.0000000E+00, 3.8436847E+01, 1.1010485E+00, 5.2229312E+00,
-    7.2060525E+00, 5.8488586E+00, 2.7754916E+00, 7.7075166E-01,
-    1.1582665E-01, 7.3138868E-03
-};
-static const double TC_Coeff_N_mVToTemp_Range2[] =
-{
-    0.00000E+00,  3.86896E+01,  -1.08267E+00, 4.70205E-02,
-    -2.12169E-06, -1.17272E-04, 5.39280E-06, -7.98156E-08,
-    0.00000E+00,  0.00000E+00
-};
-static const double TC_Coeff_N_mVToTemp_Range3[] =
-{
-    1.972485E+01,  3.300943E+01, -3.915159E-01, 9.855391E-03,
-    -1.274371E-04, 7.767022E-07, 0.000000E+00,  0.000000E+00,
-    0.000000E+00,  0.000000E+00
-};
-static const RangePoly TC_N_mVToTemp[] =
-{
-{ -4,    0.0,    { TC_Coeff_N_mVToTemp_Range1, sizeof(TC_Coeff_N_mVToTemp_Range1) / sizeof(double) } },
-{ 0.0,   20.613, { TC_Coeff_N_mVToTemp_Range2, sizeof(TC_Coeff_N_mVToTemp_Range2) / sizeof(double) } },
-{ 20.613, 47.52, { TC_Coeff_N_mVToTemp_Range3, sizeof(TC_Coeff_N_mVToTemp_Range3) / sizeof(double) } }
-};
-static const size_t TC_N_mVToTemp_len = sizeof(TC_N_mVToTemp) / sizeof(TC_N_mVToTemp[0U]);
-
-static const double TC_Coeff_N_TempToMV_Range1[] =
-{
-    0.000000000000E+00,   0.261591059620E-01,  0.109574842280E-04,
-    -0.938411115540E-07, -0.464120397590E-10, -0.263033577160E-11,
-    -0.226534380030E-13, -0.760893007910E-16, -0.934196678350E-19
-};
-static const double TC_Coeff_N_TempToMV_Range2[] =
-{
-    0.000000000000E+00,  0.259293946010E-01,  0.157101418800E-04,
-    0.438256272370E-07, -0.252611697940E-09,  0.643118193390E-12,
-    -0.100634715190E-14, 0.997453389920E-18, -0.608632456070E-21,
-    0.208492293390E-24, -0.306821961510E-28
-};
-static const RangePoly TC_N_TempToMV[] =
-{
-{ -270.5, 0.0,  { TC_Coeff_N_TempToMV_Range1, sizeof(TC_Coeff_N_TempToMV_Range1) / sizeof(double) } },
-{ 0.0,  1300.5, { TC_Coeff_N_TempToMV_Range2, sizeof(TC_Coeff_N_TempToMV_Range2) / sizeof(double) } }
-};
-static const size_t TC_N_TempToMV_len = sizeof(TC_N_TempToMV) / sizeof(TC_N_TempToMV[0U]);
+#define  TC_MAX_RANGES         4U     ///< Largest number of ranges in any table
+#define  TC_MAX_COEFFICIENTS   15U    ///< Largest number of coefficients in any polynomial
+#define  TC_CACHE_LINE         64U    ///< Bytes covered by one prefetch
 
+#if defined(__SSE2__) && !defined(TC_NO_STREAMING)
+#define  TC_STREAMING          1U     ///< Large-array mode available
+#else
+#define  TC_STREAMING          0U     ///< Large-array mode compiled out
+#endif
 
 
-/* ------------------------------------- Functions ------------------------------------- */
+/* --------------------------------------- Types --------------------------------------- */
 
-/**
- * @brief Finds the appropriate polynomial coefficients for a given input value.
- *
- * @details
- * Searches through an array of range-to-polynomial mappings and returns a pointer
- * to the polynomial coefficients corresponding to the range containing the input value.
- *
- * @param[in] ranges Pointer to the array of range-to-polynomial mappings.
- * @param[in] len    Number of elements in the @p ranges array.
- * @param[in] value  Input value to locate within the defined ranges.
- *
- * @return Pointer to the matching polynomial coefficients if a range is found;
- *         otherwise, returns @c NULL if the input value is outside all ranges.
- *
- * @note    Performs a linear search; consider optimizing if @p len is large.
- * @warning Ensure that the @p ranges array is correctly defined and covers all required input values.
- */
-static const PolyCoeff *FindPolyCoeff(const RangePoly *ranges, size_t len, double value)
+/** @brief Range table transposed for block evaluation */
+typedef struct
 {
-    const PolyCoeff *result = NULL;
-    size_t i;
+    double coeff[TC_MAX_COEFFICIENTS][TC_MAX_RANGES];    /**< Coefficient k of range r at [k][r], zero-padded */
+    double bound[TC_MAX_RANGES];                          /**< Upper bound of each range */
+    double lower;                                         /**< Lower bound of the first range */
+    double upper;                                         /**< Upper bound of the last range */
+    size_t ranges;                                        /**< Number of ranges */
+    uint8_t length;                                       /**< Number of coefficients of the longest polynomial */
+} BlockTable;
 
-    for (i = 0U; i < len; ++i)
-    {
-        if ((value >= ranges[i].min) && (value <= ranges[i].max))
-        {
-            result = &ranges[i].poly;
-            break;
-        }
-    }
+/** @brief Tables and settings of one mV-to-°C batch conversion */
+typedef struct
+{
+    BlockTable inverse;       /**< mV-to-°C table */
+    BlockTable forward;       /**< °C-to-mV table, prepared in @c TC_MODE_EXACT only */
+    ThermocoupleType type;    /**< Thermocouple type */
+    ConversionMode mode;      /**< Conversion mode */
+} BlockConverter;
 
-    return result; /* NULL if no valid range found */
-}
 
-/**
- * @brief Evaluates a polynomial at a given input using Horner's method.
- * 
- * @details
- * Efficiently computes the value of a polynomial of arbitrary degree at the specified input,
- * leveraging Horner's method to improve computational efficiency and numerical stability.
- *
- * @param[in] pCoefficient Pointer to an array of polynomial coefficients.
- * @param[in] length        Number of coefficients in the polynomial (degree + 1).
- * @param[in] input         The input value at which to evaluate the polynomial.
- *
- * @return The polynomial value evaluated at the input.
- *
- * @warning Ensure that @p length is greater than zero and @p pCoefficient is not @c NULL.
- */
-static double Polynomial_Evaluate(const double *pCoefficient, uint8_t length, double input)
-{
-    double result = 0;
-    for (int8_t i = length - 1; i >= 0; --i)
-    {
-        result = (result * input) + pCoefficient[i];
-    }
-    return result;
-}
+
+/* ------------------------------------- Functions ------------------------------------- */
 
 /**
- * @brief  Calculates temperature from thermocouple voltage.
- *
- * @details
- * Converts a voltage reading (in millivolts) from a specified thermocouple type
- * into a temperature value (in degrees Celsius) using type-specific polynomial approximations.
+ * @brief Returns the mV-to-°C range table of a thermocouple type.
  *
- * @param[in]  type     Thermocouple type (e.g., @c TC_TYPE_K, @c TC_TYPE_J) as defined in the @c ThermocoupleType enum.
- * @param[in]  voltage  Measured voltage from the thermocouple in millivolts (mV).
- * 
- * @return Calculated temperature in degrees Celsius.
- *         Returns @c TC_CONVERSION_FAILED if the voltage is out of range or if the thermocouple type is invalid.
+ * @param[in]  type     Thermocouple type as defined in the @c ThermocoupleType enum.
+ * @param[out] pLength  Receives the number of ranges in the returned table.
  *
- * @note     The function uses polynomial approximations specific to each thermocouple type.
- * @warning  Ensure the @p type is valid and the input voltage is within the supported range.
+ * @return Pointer to the range table, or @c NULL if @p type is invalid.
  */
-double TC_CalculateTemperature(ThermocoupleType type, double voltage)
-{	
-    double temperature      = TC_CONVERSION_FAILED;    
+static const RangePoly *GetTemperatureRanges(ThermocoupleType type, size_t *pLength)
+{
     const RangePoly *ranges = NULL;
-    const PolyCoeff *poly   = NULL;
     size_t ranges_len       = 0U;
-     
+
     switch (type)
-    { 
+    {
         case TC_TYPE_R:
             ranges = TC_R_mVToTemp;
             ranges_len = TC_R_mVToTemp_len;
         break;
-                
+
         case TC_TYPE_S:
             ranges = TC_S_mVToTemp;
             ranges_len = TC_S_mVToTemp_len;
         break;
-        
-        case TC_TYPE_B:    
+
+        case TC_TYPE_B:
             ranges = TC_B_mVToTemp;
             ranges_len = TC_B_mVToTemp_len;
         break;
-        
-        case TC_TYPE_J:     
+
+        case TC_TYPE_J:
             ranges = TC_J_mVToTemp;
             ranges_len = TC_J_mVToTemp_len;
         break;
-        
-        case TC_TYPE_T:    
+
+        case TC_TYPE_T:
             ranges = TC_T_mVToTemp;
             ranges_len = TC_T_mVToTemp_len;
         break;
-        
+
         case TC_TYPE_E:
             ranges = TC_E_mVToTemp;
             ranges_len = TC_E_mVToTemp_len;
         break;
-        
+
         case TC_TYPE_K:
             ranges = TC_K_mVToTemp;
             ranges_len = TC_K_mVToTemp_len;
         break;
-        
+
         case TC_TYPE_N:
             ranges = TC_N_mVToTemp;
             ranges_len = TC_N_mVToTemp_len;
         break;
-        
+
         default:
-            temperature = TC_CONVERSION_FAILED;
-    }
-    
-    if (ranges != NULL)
-    {
-        poly = FindPolyCoeff(ranges, ranges_len, voltage);
-        if (poly != NULL)
-        {
-            temperature = Polynomial_Evaluate(poly->pCoefficients, poly->length, voltage);
-        }
+            ranges = NULL;
     }
 
-    return temperature;
+    *pLength = ranges_len;
+    return ranges;
 }
 
 /**
- * @brief  Calculates thermocouple voltage from temperature.
+ * @brief Returns the °C-to-mV range table of a thermocouple type.
  *
- * @details
- * Converts a temperature value (in degrees Celsius) for a specified thermocouple type
- * into the corresponding voltage (in millivolts) using type-specific polynomial approximations.
+ * @param[in]  type     Thermocouple type as defined in the @c ThermocoupleType enum.
+ * @param[out] pLength  Receives the number of ranges in the returned table.
  *
- * @param[in]  type         Thermocouple type (e.g., @c TC_TYPE_K, @c TC_TYPE_J) as defined in the @c ThermocoupleType enum.
- * @param[in]  temperature  Temperature in degrees Celsius (°C).
- * 
- * @return Calculated voltage in millivolts (mV).  
- *         Returns @c TC_CONVERSION_FAILED if the temperature is out of range or the thermocouple type is invalid.
+ * @return Pointer to the range table, or @c NULL if @p type is invalid.
  *
- * @note     The function uses polynomial approximations specific to each thermocouple type.
- * @warning  Ensure the @p type is valid and the input temperature is within the supported range.
+ * @note The type K table holds the polynomial part only; see @ref KType_Correction.
  */
-double TC_CalculateVoltage(ThermocoupleType type, double temperature)
+static const RangePoly *GetVoltageRanges(ThermocoupleType type, size_t *pLength)
 {
-    double voltage          = TC_CONVERSION_FAILED;    
     const RangePoly *ranges = NULL;
-    const PolyCoeff *poly   = NULL;
-    const double *pCoeff    = NULL;
-    double correction       = 0;
     size_t ranges_len       = 0U;
-    size_t length           = 0U;
-      
+
     switch (type)
-    { 
+    {
         case TC_TYPE_R:
             ranges = TC_R_TempToMV;
             ranges_len = TC_R_TempToMV_len;
@@ -606,50 +180,1317 @@ double TC_CalculateVoltage(ThermocoupleType type, double temperature)
             ranges_len = TC_E_TempToMV_len;
         break;
 
-        case TC_TYPE_K:                     
-            if ( (temperature >= -270.5) && (temperature <= 0.0) )
-            {
-                pCoeff = TC_Coeff_K_TempToMV_Range1;
-                length = sizeof(TC_Coeff_K_TempToMV_Range1) / sizeof(double);
-            }
-            else if ( (temperature > 0.0) && (temperature <= 1372.5) )
-            {
-                pCoeff = TC_Coeff_K_TempToMV_Range2;
-                length = sizeof(TC_Coeff_K_TempToMV_Range2) / sizeof(double);
-            }
-            else
-            {
-                voltage = TC_CONVERSION_FAILED;
-            }
-
-            voltage = Polynomial_Evaluate(pCoeff, length, temperature);
-
-            if (temperature > 0.0)
-            {
-                correction = TC_Coeff_K_TempToMV_A0 * exp(TC_Coeff_K_TempToMV_A1 * pow((temperature - TC_Coeff_K_TempToMV_A2), 2.0));
-                voltage += correction;
-            }
+        case TC_TYPE_K:
+            ranges = TC_K_TempToMV;
+            ranges_len = TC_K_TempToMV_len;
         break;
 
         case TC_TYPE_N:
             ranges = TC_N_TempToMV;
             ranges_len = TC_N_TempToMV_len;
         break;
-        
+
         default:
-            voltage = TC_CONVERSION_FAILED;
+            ranges = NULL;
     }
-       
-    if (ranges != NULL)
+
+    *pLength = ranges_len;
+    return ranges;
+}
+
+/**
+ * @brief Finds the appropriate polynomial coefficients for a given input value.
+ *
+ * @details
+ * Searches through an array of range-to-polynomial mappings and returns a pointer
+ * to the polynomial coefficients corresponding to the range containing the input value.
+ *
+ * @param[in] ranges Pointer to the array of range-to-polynomial mappings.
+ * @param[in] len    Number of elements in the @p ranges array.
+ * @param[in] value  Input value to locate within the defined ranges.
+ *
+ * @return Pointer to the matching polynomial coefficients if a range is found;
+ *         otherwise, returns @c NULL if the input value is outside all ranges.
+ *
+ * @note    Performs a linear search; consider optimizing if @p len is large.
+ * @warning Ensure that the @p ranges array is correctly defined and covers all required input values.
+ */
+static const PolyCoeff *FindPolyCoeff(const RangePoly *ranges, size_t len, double value)
+{
+    const PolyCoeff *result = NULL;
+    size_t i;
+
+    for (i = 0U; i < len; ++i)
     {
-        poly = FindPolyCoeff(ranges, ranges_len, temperature);
-        if (poly != NULL)
+        if ((value >= ranges[i].min) && (value <= ranges[i].max))
         {
-            voltage = Polynomial_Evaluate(poly->pCoefficients, poly->length, temperature);
+            result = &ranges[i].poly;
+            break;
         }
     }
-       
-    return voltage;
+
+    return result; /* NULL if no valid range found */
+}
+
+/**
+ * @brief Prepares a range table for block evaluation.
+ *
+ * @details
+ * Transposes the coefficients of all ranges into one small matrix, padding shorter
+ * polynomials with zero high-order coefficients, so that the block kernels can
+ * select the coefficient of every element with an indexed load instead of
+ * following a per-element pointer.
+ *
+ * @param[out] pTable  Table to initialize.
+ * @param[in]  ranges  Pointer to the array of range-to-polynomial mappings.
+ * @param[in]  len     Number of elements in the @p ranges array; at most @c TC_MAX_RANGES.
+ */
+static void BlockTable_Init(BlockTable *pTable, const RangePoly *ranges, size_t len)
+{
+    size_t r;
+    size_t k;
+
+    pTable->ranges = len;
+    pTable->length = 0U;
+    pTable->lower  = ranges[0U].min;
+    pTable->upper  = ranges[len - 1U].max;
+
+    for (r = 0U; r < len; ++r)
+    {
+        pTable->bound[r] = ranges[r].max;
+        pTable->length = (ranges[r].poly.length > pTable->length) ? ranges[r].poly.length : pTable->length;
+    }
+
+    for (k = 0U; k < pTable->length; ++k)
+    {
+        for (r = 0U; r < TC_MAX_RANGES; ++r)
+        {
+            pTable->coeff[k][r] = ((r < len) && (k < ranges[r].poly.length)) ? ranges[r].poly.pCoefficients[k] : 0.0;
+        }
+    }
+}
+
+/**
+ * @brief Evaluates a polynomial at a given input using Horner's method.
+ * 
+ * @details
+ * Efficiently computes the value of a polynomial of arbitrary degree at the specified input,
+ * leveraging Horner's method to improve computational efficiency and numerical stability.
+ *
+ * @param[in] pCoefficient Pointer to an array of polynomial coefficients.
+ * @param[in] length        Number of coefficients in the polynomial (degree + 1).
+ * @param[in] input         The input value at which to evaluate the polynomial.
+ *
+ * @return The polynomial value evaluated at the input.
+ *
+ * @warning Ensure that @p length is greater than zero and @p pCoefficient is not @c NULL.
+ */
+static double Polynomial_Evaluate(const double *pCoefficient, uint8_t length, double input)
+{
+    double result = 0;
+    for (int8_t i = length - 1; i >= 0; --i)
+    {
+        result = (result * input) + pCoefficient[i];
+    }
+    return result;
+}
+
+/**
+ * @brief Evaluates a polynomial and its first derivative in a single Horner pass.
+ *
+ * @details
+ * The value is accumulated exactly as in @ref Polynomial_Evaluate, so it is
+ * bit-identical to it; the derivative is carried alongside at the cost of one
+ * extra multiply-add per coefficient.
+ *
+ * @param[in]  pCoefficient Pointer to an array of polynomial coefficients.
+ * @param[in]  length       Number of coefficients in the polynomial (degree + 1).
+ * @param[in]  input        The input value at which to evaluate the polynomial.
+ * @param[out] pDerivative  Receives the first derivative at @p input.
+ *
+ * @return The polynomial value evaluated at the input.
+ *
+ * @warning Ensure that @p length is greater than zero and @p pCoefficient is not @c NULL.
+ */
+static double Polynomial_EvaluateDerivative(const double *pCoefficient, uint8_t length, double input, double *pDerivative)
+{
+    double result     = 0;
+    double derivative = 0;
+    for (int8_t i = length - 1; i >= 0; --i)
+    {
+        derivative = (derivative * input) + result;
+        result = (result * input) + pCoefficient[i];
+    }
+    *pDerivative = derivative;
+    return result;
+}
+
+/**
+ * @brief Evaluates the piecewise polynomial of a range table over a block of inputs.
+ *
+ * @details
+ * The range of every element is found by counting the upper bounds below it; because
+ * the ranges of every table are contiguous and the lower range wins on a shared bound,
+ * this selects the same range as @ref FindPolyCoeff. All elements then run the same
+ * Horner recurrence over the longest polynomial of the table. Leading zero terms leave
+ * the accumulators at exactly zero, so each value is bit-identical to the scalar path,
+ * while the loops over elements have no data-dependent control flow and can be
+ * vectorized by the compiler.
+ *
+ * @param[in]  pTable       Table prepared by @ref BlockTable_Init.
+ * @param[in]  pInput       Input values.
+ * @param[out] pValue       Receives the polynomial values, or @c TC_CONVERSION_FAILED.
+ * @param[out] pDerivative  Receives the derivatives, or @c TC_CONVERSION_FAILED; may be @c NULL.
+ * @param[out] pValid       Receives 1 for elements inside the table and 0 otherwise.
+ * @param[in]  count        Number of elements; at most @c TC_BATCH_BLOCK_SIZE.
+ *
+ * @return Number of elements outside the table.
+ */
+static size_t Polynomial_EvaluateBlock(const BlockTable *pTable, const double *pInput,
+                                       double *pValue, double *pDerivative, uint8_t *pValid, size_t count)
+{
+    size_t index[TC_BATCH_BLOCK_SIZE];
+    double result[TC_BATCH_BLOCK_SIZE];
+    double derivative[TC_BATCH_BLOCK_SIZE];
+    size_t failed = 0U;
+    size_t i;
+    size_t k;
+    size_t r;
+
+    for (i = 0U; i < count; ++i)
+    {
+        index[i]  = 0U;
+        result[i] = 0;
+        derivative[i] = 0;
+        pValid[i] = ((pInput[i] >= pTable->lower) && (pInput[i] <= pTable->upper)) ? 1U : 0U;
+    }
+
+    for (r = 0U; (r + 1U) < pTable->ranges; ++r)
+    {
+        for (i = 0U; i < count; ++i)
+        {
+            index[i] += (pInput[i] > pTable->bound[r]) ? 1U : 0U;
+        }
+    }
+
+    for (k = pTable->length; k > 0U; --k)
+    {
+        const double *row = pTable->coeff[k - 1U];
+
+        if (pDerivative != NULL)
+        {
+            for (i = 0U; i < count; ++i)
+            {
+                derivative[i] = (derivative[i] * pInput[i]) + result[i];
+                result[i] = (result[i] * pInput[i]) + row[index[i]];
+            }
+        }
+        else
+        {
+            for (i = 0U; i < count; ++i)
+            {
+                result[i] = (result[i] * pInput[i]) + row[index[i]];
+            }
+        }
+    }
+
+    for (i = 0U; i < count; ++i)
+    {
+        failed += (pValid[i] != 0U) ? 0U : 1U;
+        pValue[i] = (pValid[i] != 0U) ? result[i] : TC_CONVERSION_FAILED;
+    }
+
+    if (pDerivative != NULL)
+    {
+        for (i = 0U; i < count; ++i)
+        {
+            pDerivative[i] = (pValid[i] != 0U) ? derivative[i] : TC_CONVERSION_FAILED;
+        }
+    }
+
+    return failed;
+}
+
+/**
+ * @brief Computes the exponential term of the type K reference function.
+ *
+ * @details
+ * For temperatures above 0 °C the IEC 60584 type K function adds
+ * a0 * exp(a1 * (t - a2)^2) to the polynomial. Its derivative,
+ * 2 * a1 * (t - a2) times the term itself, is returned through @p pDerivative.
+ *
+ * @param[in]  temperature  Temperature in degrees Celsius (°C).
+ * @param[out] pDerivative  Receives the derivative of the term in mV/°C; may be @c NULL.
+ *
+ * @return The correction in millivolts (mV), or zero at or below 0 °C.
+ */
+static double KType_Correction(double temperature, double *pDerivative)
+{
+    double correction = 0;
+    double slope      = 0;
+
+    if (temperature > 0.0)
+    {
+        correction = TC_Coeff_K_TempToMV_A0 * exp(TC_Coeff_K_TempToMV_A1 * pow((temperature - TC_Coeff_K_TempToMV_A2), 2.0));
+        slope = 2.0 * TC_Coeff_K_TempToMV_A1 * (temperature - TC_Coeff_K_TempToMV_A2) * correction;
+    }
+
+    if (pDerivative != NULL)
+    {
+        *pDerivative = slope;
+    }
+    return correction;
+}
+
+/**
+ * @brief Evaluates the °C-to-mV reference function and its slope over a block of temperatures.
+ *
+ * @details
+ * Runs @ref Polynomial_EvaluateBlock over a °C-to-mV range table and, for type K,
+ * adds the exponential term and its derivative to the valid elements.
+ *
+ * @param[in]  type          Thermocouple type the table belongs to.
+ * @param[in]  pTable        °C-to-mV table prepared by @ref BlockTable_Init.
+ * @param[in]  pTemperature  Temperatures in degrees Celsius; must not alias the outputs.
+ * @param[out] pVoltage      Receives the voltages, or @c TC_CONVERSION_FAILED.
+ * @param[out] pSeebeck      Receives dV/dT, or @c TC_CONVERSION_FAILED.
+ * @param[out] pValid        Receives 1 for elements inside the table and 0 otherwise.
+ * @param[in]  count         Number of elements; at most @c TC_BATCH_BLOCK_SIZE.
+ *
+ * @return Number of elements outside the table.
+ */
+static size_t Voltage_EvaluateBlock(ThermocoupleType type, const BlockTable *pTable, const double *pTemperature,
+                                    double *pVoltage, double *pSeebeck, uint8_t *pValid, size_t count)
+{
+    size_t failed = Polynomial_EvaluateBlock(pTable, pTemperature, pVoltage, pSeebeck, pValid, count);
+    double slope  = 0;
+    size_t i;
+
+    if (type == TC_TYPE_K)
+    {
+        for (i = 0U; i < count; ++i)
+        {
+            if (pValid[i] != 0U)
+            {
+                pVoltage[i] += KType_Correction(pTemperature[i], &slope);
+                pSeebeck[i] += slope;
+            }
+        }
+    }
+
+    return failed;
+}
+
+/**
+ * @brief Refines a block of temperatures with Newton steps on the °C-to-mV reference function.
+ *
+ * @details
+ * Every element runs exactly @c TC_NEWTON_STEPS iterations of
+ * t -= (E(t) - v) / E'(t), so all elements of the block advance together.
+ * Elements whose seed failed, whose iterate leaves the °C-to-mV table or whose
+ * slope vanishes are left unchanged.
+ *
+ * @param[in]     type          Thermocouple type.
+ * @param[in]     pForward      °C-to-mV table of @p type prepared by @ref BlockTable_Init.
+ * @param[in]     pVoltage      Target voltages in millivolts (mV); must not alias @p pTemperature.
+ * @param[in,out] pTemperature  Seed temperatures on entry, refined temperatures on return.
+ * @param[in]     pSeedValid    Nonzero for elements whose seed conversion succeeded.
+ * @param[in]     count         Number of elements; at most @c TC_BATCH_BLOCK_SIZE.
+ */
+static void Temperature_RefineBlock(ThermocoupleType type, const BlockTable *pForward, const double *pVoltage,
+                                    double *pTemperature, const uint8_t *pSeedValid, size_t count)
+{
+    double voltage[TC_BATCH_BLOCK_SIZE];
+    double seebeck[TC_BATCH_BLOCK_SIZE];
+    uint8_t valid[TC_BATCH_BLOCK_SIZE];
+    uint8_t step;
+    size_t i;
+
+    for (step = 0U; step < TC_NEWTON_STEPS; ++step)
+    {
+        (void)Voltage_EvaluateBlock(type, pForward, pTemperature, voltage, seebeck, valid, count);
+
+        for (i = 0U; i < count; ++i)
+        {
+            const uint8_t update = ((pSeedValid[i] != 0U) && (valid[i] != 0U) && (seebeck[i] != 0.0)) ? 1U : 0U;
+            pTemperature[i] -= (update != 0U) ? ((voltage[i] - pVoltage[i]) / seebeck[i]) : 0.0;
+        }
+    }
+}
+
+/**
+ * @brief Prepares the tables of a mV-to-°C batch conversion.
+ *
+ * @param[out] pConverter  Converter to initialize.
+ * @param[in]  type        Thermocouple type as defined in the @c ThermocoupleType enum.
+ * @param[in]  mode        Conversion mode as defined in the @c ConversionMode enum.
+ *
+ * @return 1 on success, or 0 if @p type is invalid.
+ */
+static uint8_t BlockConverter_Init(BlockConverter *pConverter, ThermocoupleType type, ConversionMode mode)
+{
+    const RangePoly *ranges  = NULL;
+    const RangePoly *forward = NULL;
+    size_t ranges_len        = 0U;
+    size_t forward_len       = 0U;
+    uint8_t result           = 0U;
+
+    ranges  = GetTemperatureRanges(type, &ranges_len);
+    forward = GetVoltageRanges(type, &forward_len);
+
+    if ((ranges != NULL) && (forward != NULL))
+    {
+        pConverter->type = type;
+        pConverter->mode = mode;
+        BlockTable_Init(&pConverter->inverse, ranges, ranges_len);
+        if (mode == TC_MODE_EXACT)
+        {
+            BlockTable_Init(&pConverter->forward, forward, forward_len);
+        }
+        result = 1U;
+    }
+
+    return result;
+}
+
+/**
+ * @brief Converts a block of voltages to temperatures.
+ *
+ * @param[in]  pConverter    Converter prepared by @ref BlockConverter_Init.
+ * @param[in]  pVoltage      Voltages in millivolts (mV); must not alias @p pTemperature.
+ * @param[out] pTemperature  Receives the temperatures, or @c TC_CONVERSION_FAILED.
+ * @param[in]  count         Number of elements; at most @c TC_BATCH_BLOCK_SIZE.
+ *
+ * @return Number of elements set to @c TC_CONVERSION_FAILED.
+ */
+static size_t BlockConverter_Convert(const BlockConverter *pConverter, const double *pVoltage, double *pTemperature, size_t count)
+{
+    uint8_t valid[TC_BATCH_BLOCK_SIZE];
+    size_t failed = Polynomial_EvaluateBlock(&pConverter->inverse, pVoltage, pTemperature, NULL, valid, count);
+
+    if (pConverter->mode == TC_MODE_EXACT)
+    {
+        Temperature_RefineBlock(pConverter->type, &pConverter->forward, pVoltage, pTemperature, valid, count);
+    }
+
+    return failed;
+}
+
+/**
+ * @brief Tells whether a batch conversion runs in the large-array mode.
+ *
+ * @param[in] pOutput  First f64 output.
+ * @param[in] count    Number of elements.
+ *
+ * @return 1 if the outputs are streamed and the inputs prefetched, otherwise 0.
+ */
+static uint8_t Stream_Selected(const double *pOutput, size_t count)
+{
+    /* Streaming stores need 8-byte aligned doubles to reach 16-byte alignment */
+    return ((TC_STREAMING != 0U) && (count >= TC_STREAM_THRESHOLD) &&
+            ((((uintptr_t)pOutput) & (sizeof(double) - 1U)) == 0U)) ? 1U : 0U;
+}
+
+/**
+ * @brief Prefetches the inputs of the block @c TC_PREFETCH_DISTANCE elements ahead.
+ *
+ * @param[in] pBase   First byte of element 0.
+ * @param[in] stride  Distance between consecutive elements in bytes.
+ * @param[in] offset  First element of the current block.
+ * @param[in] block   Elements in the current block.
+ * @param[in] count   Elements in the conversion; nothing past them is touched.
+ */
+static void Stream_Prefetch(const uint8_t *pBase, size_t stride, size_t offset, size_t block, size_t count)
+{
+#if (TC_STREAMING != 0U)
+    const size_t first = offset + TC_PREFETCH_DISTANCE;
+    const size_t last  = ((first + block) < count) ? (first + block) : count;
+    const size_t step  = ((stride != 0U) && (stride < TC_CACHE_LINE)) ? (TC_CACHE_LINE / stride) : 1U;
+    size_t i;
+
+    for (i = first; i < last; i += step)
+    {
+        _mm_prefetch((const char *)&pBase[i * stride], _MM_HINT_NTA);
+    }
+#else
+    (void)pBase;
+    (void)stride;
+    (void)offset;
+    (void)block;
+    (void)count;
+#endif
+}
+
+/**
+ * @brief Copies a block of outputs to memory with non-temporal stores.
+ *
+ * @param[out] pDestination  First output, 8-byte aligned.
+ * @param[in]  pSource       Converted block.
+ * @param[in]  count         Number of elements.
+ */
+static void Stream_Store(double *pDestination, const double *pSource, size_t count)
+{
+#if (TC_STREAMING != 0U)
+    size_t i = 0U;
+
+    /* One ordinary store brings an odd destination to 16-byte alignment */
+    if (((((uintptr_t)pDestination) & 15U) != 0U) && (count != 0U))
+    {
+        pDestination[0] = pSource[0];
+        i = 1U;
+    }
+    for (; (i + 1U) < count; i += 2U)
+    {
+        _mm_stream_pd(&pDestination[i], _mm_loadu_pd(&pSource[i]));
+    }
+    if (i < count)
+    {
+        pDestination[i] = pSource[i];
+    }
+#else
+    (void)memcpy(pDestination, pSource, count * sizeof(double));
+#endif
+}
+
+/**
+ * @brief Orders the streaming stores of a conversion before the caller's next stores.
+ */
+static void Stream_Fence(void)
+{
+#if (TC_STREAMING != 0U)
+    _mm_sfence();
+#endif
+}
+
+/**
+ * @brief  Calculates temperature from thermocouple voltage.
+ *
+ * @details
+ * Converts a voltage reading (in millivolts) from a specified thermocouple type
+ * into a temperature value (in degrees Celsius) using type-specific polynomial approximations.
+ *
+ * @param[in]  type     Thermocouple type (e.g., @c TC_TYPE_K, @c TC_TYPE_J) as defined in the @c ThermocoupleType enum.
+ * @param[in]  voltage  Measured voltage from the thermocouple in millivolts (mV).
+ * 
+ * @return Calculated temperature in degrees Celsius.
+ *         Returns @c TC_CONVERSION_FAILED if the voltage is out of range or if the thermocouple type is invalid.
+ *
+ * @note     The function uses polynomial approximations specific to each thermocouple type.
+ * @warning  Ensure the @p type is valid and the input voltage is within the supported range.
+ */
+double TC_CalculateTemperature(ThermocoupleType type, double voltage)
+{	
+    double temperature      = TC_CONVERSION_FAILED;    
+    const RangePoly *ranges = NULL;
+    const PolyCoeff *poly   = NULL;
+    size_t ranges_len       = 0U;
+
+    ranges = GetTemperatureRanges(type, &ranges_len);
+    
+    if (ranges != NULL)
+    {
+        poly = FindPolyCoeff(ranges, ranges_len, voltage);
+        if (poly != NULL)
+        {
+            temperature = Polynomial_Evaluate(poly->pCoefficients, poly->length, voltage);
+        }
+    }
+
+    return temperature;
+}
+
+/**
+ * @brief  Calculates thermocouple voltage from temperature.
+ *
+ * @details
+ * Converts a temperature value (in degrees Celsius) for a specified thermocouple type
+ * into the corresponding voltage (in millivolts) using type-specific polynomial approximations.
+ *
+ * @param[in]  type         Thermocouple type (e.g., @c TC_TYPE_K, @c TC_TYPE_J) as defined in the @c ThermocoupleType enum.
+ * @param[in]  temperature  Temperature in degrees Celsius (°C).
+ * 
+ * @return Calculated voltage in millivolts (mV).  
+ *         Returns @c TC_CONVERSION_FAILED if the temperature is out of range or the thermocouple type is invalid.
+ *
+ * @note     The function uses polynomial approximations specific to each thermocouple type.
+ * @warning  Ensure the @p type is valid and the input temperature is within the supported range.
+ */
+double TC_CalculateVoltage(ThermocoupleType type, double temperature)
+{
+    double voltage          = TC_CONVERSION_FAILED;    
+    const RangePoly *ranges = NULL;
+    const PolyCoeff *poly   = NULL;
+    size_t ranges_len       = 0U;
+
+    ranges = GetVoltageRanges(type, &ranges_len);
+       
+    if (ranges != NULL)
+    {
+        poly = FindPolyCoeff(ranges, ranges_len, temperature);
+        if (poly != NULL)
+        {
+            voltage = Polynomial_Evaluate(poly->pCoefficients, poly->length, temperature);
+
+            if (type == TC_TYPE_K)
+            {
+                voltage += KType_Correction(temperature, NULL);
+            }
+        }
+    }
+       
+    return voltage;
+}
+
+/**
+ * @brief  Calculates temperature and its derivative from thermocouple voltage.
+ *
+ * @details
+ * Returns the same temperature as @ref TC_CalculateTemperature and, from the same
+ * Horner pass, the slope dT/dV of the inverse reference polynomial.
+ *
+ * @param[in]  type         Thermocouple type as defined in the @c ThermocoupleType enum.
+ * @param[in]  voltage      Measured voltage from the thermocouple in millivolts (mV).
+ * @param[out] pDerivative  Receives dT/dV in °C/mV, or @c TC_CONVERSION_FAILED; may be @c NULL.
+ *
+ * @return Calculated temperature in degrees Celsius, or @c TC_CONVERSION_FAILED.
+ */
+double TC_CalculateTemperatureDerivative(ThermocoupleType type, double voltage, double *pDerivative)
+{
+    double temperature      = TC_CONVERSION_FAILED;
+    double derivative       = TC_CONVERSION_FAILED;
+    const RangePoly *ranges = NULL;
+    const PolyCoeff *poly   = NULL;
+    size_t ranges_len       = 0U;
+
+    ranges = GetTemperatureRanges(type, &ranges_len);
+
+    if (ranges != NULL)
+    {
+        poly = FindPolyCoeff(ranges, ranges_len, voltage);
+        if (poly != NULL)
+        {
+            temperature = Polynomial_EvaluateDerivative(poly->pCoefficients, poly->length, voltage, &derivative);
+        }
+    }
+
+    if (pDerivative != NULL)
+    {
+        *pDerivative = derivative;
+    }
+    return temperature;
+}
+
+/**
+ * @brief  Calculates thermocouple voltage and the Seebeck coefficient from temperature.
+ *
+ * @details
+ * Returns the same voltage as @ref TC_CalculateVoltage and, from the same Horner
+ * pass, the slope dV/dT of the reference function. For type K the exponential
+ * term is differentiated analytically.
+ *
+ * @param[in]  type         Thermocouple type as defined in the @c ThermocoupleType enum.
+ * @param[in]  temperature  Temperature in degrees Celsius (°C).
+ * @param[out] pSeebeck     Receives dV/dT in mV/°C, or @c TC_CONVERSION_FAILED; may be @c NULL.
+ *
+ * @return Calculated voltage in millivolts (mV), or @c TC_CONVERSION_FAILED.
+ */
+double TC_CalculateVoltageDerivative(ThermocoupleType type, double temperature, double *pSeebeck)
+{
+    double voltage          = TC_CONVERSION_FAILED;
+    double seebeck          = TC_CONVERSION_FAILED;
+    double slope            = 0;
+    const RangePoly *ranges = NULL;
+    const PolyCoeff *poly   = NULL;
+    size_t ranges_len       = 0U;
+
+    ranges = GetVoltageRanges(type, &ranges_len);
+
+    if (ranges != NULL)
+    {
+        poly = FindPolyCoeff(ranges, ranges_len, temperature);
+        if (poly != NULL)
+        {
+            voltage = Polynomial_EvaluateDerivative(poly->pCoefficients, poly->length, temperature, &seebeck);
+
+            if (type == TC_TYPE_K)
+            {
+                voltage += KType_Correction(temperature, &slope);
+                seebeck += slope;
+            }
+        }
+    }
+
+    if (pSeebeck != NULL)
+    {
+        *pSeebeck = seebeck;
+    }
+    return voltage;
+}
+
+/**
+ * @brief  Calculates temperatures and their derivatives for an array of voltages.
+ *
+ * @details
+ * Batch form of @ref TC_CalculateTemperatureDerivative. The type is resolved once
+ * and the array is processed in blocks of @c TC_BATCH_BLOCK_SIZE elements.
+ * Results are bit-identical to the scalar function.
+ *
+ * @param[in]  type          Thermocouple type as defined in the @c ThermocoupleType enum.
+ * @param[in]  pVoltage      Array of voltages in millivolts (mV).
+ * @param[out] pTemperature  Receives the temperatures in degrees Celsius.
+ * @param[out] pDerivative   Receives dT/dV in °C/mV; may be @c NULL.
+ * @param[in]  count         Number of elements.
+ *
+ * @return Number of elements set to @c TC_CONVERSION_FAILED.
+ *
+ * @note @p pTemperature may alias @p pVoltage for in-place conversion.
+ */
+size_t TC_CalculateTemperatureDerivativeArray(ThermocoupleType type, const double *pVoltage, double *pTemperature,
+                                              double *pDerivative, size_t count)
+{
+    uint8_t valid[TC_BATCH_BLOCK_SIZE];
+    BlockTable table;
+    const RangePoly *ranges = NULL;
+    size_t ranges_len       = 0U;
+    size_t failed           = 0U;
+    size_t offset;
+    size_t block;
+    size_t i;
+
+    ranges = GetTemperatureRanges(type, &ranges_len);
+
+    if ((pVoltage == NULL) || (pTemperature == NULL))
+    {
+        failed = count;
+    }
+    else if (ranges == NULL)
+    {
+        for (i = 0U; i < count; ++i)
+        {
+            pTemperature[i] = TC_CONVERSION_FAILED;
+            if (pDerivative != NULL)
+            {
+                pDerivative[i] = TC_CONVERSION_FAILED;
+            }
+        }
+        failed = count;
+    }
+    else
+    {
+        BlockTable_Init(&table, ranges, ranges_len);
+
+        for (offset = 0U; offset < count; offset += block)
+        {
+            block = ((count - offset) < TC_BATCH_BLOCK_SIZE) ? (count - offset) : TC_BATCH_BLOCK_SIZE;
+            failed += Polynomial_EvaluateBlock(&table, &pVoltage[offset], &pTemperature[offset],
+                                               (pDerivative != NULL) ? &pDerivative[offset] : NULL, valid, block);
+        }
+    }
+
+    return failed;
+}
+
+/**
+ * @brief  Calculates voltages and Seebeck coefficients for an array of temperatures.
+ *
+ * @details
+ * Batch form of @ref TC_CalculateVoltageDerivative. The type is resolved once
+ * and the array is processed in blocks of @c TC_BATCH_BLOCK_SIZE elements.
+ * Results are bit-identical to the scalar function.
+ *
+ * @param[in]  type          Thermocouple type as defined in the @c ThermocoupleType enum.
+ * @param[in]  pTemperature  Array of temperatures in degrees Celsius (°C).
+ * @param[out] pVoltage      Receives the voltages in millivolts (mV).
+ * @param[out] pSeebeck      Receives dV/dT in mV/°C; may be @c NULL.
+ * @param[in]  count         Number of elements.
+ *
+ * @return Number of elements set to @c TC_CONVERSION_FAILED.
+ *
+ * @note @p pVoltage may alias @p pTemperature for in-place conversion.
+ */
+size_t TC_CalculateVoltageDerivativeArray(ThermocoupleType type, const double *pTemperature, double *pVoltage,
+                                          double *pSeebeck, size_t count)
+{
+    uint8_t valid[TC_BATCH_BLOCK_SIZE];
+    double input[TC_BATCH_BLOCK_SIZE];
+    double seebeck[TC_BATCH_BLOCK_SIZE];
+    BlockTable table;
+    const RangePoly *ranges = NULL;
+    size_t ranges_len       = 0U;
+    size_t failed           = 0U;
+    size_t offset;
+    size_t block;
+    size_t i;
+
+    ranges = GetVoltageRanges(type, &ranges_len);
+
+    if ((pTemperature == NULL) || (pVoltage == NULL))
+    {
+        failed = count;
+    }
+    else if (ranges == NULL)
+    {
+        for (i = 0U; i < count; ++i)
+        {
+            pVoltage[i] = TC_CONVERSION_FAILED;
+            if (pSeebeck != NULL)
+            {
+                pSeebeck[i] = TC_CONVERSION_FAILED;
+            }
+        }
+        failed = count;
+    }
+    else
+    {
+        BlockTable_Init(&table, ranges, ranges_len);
+
+        for (offset = 0U; offset < count; offset += block)
+        {
+            block = ((count - offset) < TC_BATCH_BLOCK_SIZE) ? (count - offset) : TC_BATCH_BLOCK_SIZE;
+
+            /* Keep a copy of the inputs: the output may alias them and type K needs them afterwards */
+            for (i = 0U; i < block; ++i)
+            {
+                input[i] = pTemperature[offset + i];
+            }
+
+            failed += Voltage_EvaluateBlock(type, &table, input, &pVoltage[offset], seebeck, valid, block);
+
+            if (pSeebeck != NULL)
+            {
+                for (i = 0U; i < block; ++i)
+                {
+                    pSeebeck[offset + i] = seebeck[i];
+                }
+            }
+        }
+    }
+
+    return failed;
+}
+
+/**
+ * @brief  Calculates temperature from thermocouple voltage, consistent with the °C-to-mV function.
+ *
+ * @details
+ * Seeds from the inverse polynomial as @ref TC_CalculateTemperature does, then applies
+ * @c TC_NEWTON_STEPS Newton steps against the °C-to-mV reference function, so that
+ * @ref TC_CalculateVoltage of the result reproduces @p voltage.
+ *
+ * @param[in]  type     Thermocouple type as defined in the @c ThermocoupleType enum.
+ * @param[in]  voltage  Measured voltage from the thermocouple in millivolts (mV).
+ *
+ * @return Calculated temperature in degrees Celsius, or @c TC_CONVERSION_FAILED.
+ *
+ * @note Bit-identical to @ref TC_CalculateTemperatureArray in @c TC_MODE_EXACT.
+ */
+double TC_CalculateTemperatureExact(ThermocoupleType type, double voltage)
+{
+    double temperature = TC_CONVERSION_FAILED;
+
+    (void)TC_CalculateTemperatureArray(type, &voltage, &temperature, 1U, TC_MODE_EXACT);
+
+    return temperature;
+}
+
+/**
+ * @brief  Calculates temperatures for an array of thermocouple voltages.
+ *
+ * @details
+ * Batch form of @ref TC_CalculateTemperature (@c TC_MODE_FAST) and
+ * @ref TC_CalculateTemperatureExact (@c TC_MODE_EXACT). The type is resolved once
+ * and the array is processed in blocks of @c TC_BATCH_BLOCK_SIZE elements; in exact
+ * mode every block runs the same fixed number of Newton steps.
+ *
+ * @param[in]  type          Thermocouple type as defined in the @c ThermocoupleType enum.
+ * @param[in]  pVoltage      Array of voltages in millivolts (mV).
+ * @param[out] pTemperature  Receives the temperatures in degrees Celsius.
+ * @param[in]  count         Number of elements.
+ * @param[in]  mode          Conversion mode as defined in the @c ConversionMode enum.
+ *
+ * @return Number of elements set to @c TC_CONVERSION_FAILED.
+ *
+ * @note @p pTemperature may alias @p pVoltage for in-place conversion.
+ */
+size_t TC_CalculateTemperatureArray(ThermocoupleType type, const double *pVoltage, double *pTemperature,
+                                    size_t count, ConversionMode mode)
+{
+    double input[TC_BATCH_BLOCK_SIZE];
+    double output[TC_BATCH_BLOCK_SIZE];
+    BlockConverter converter;
+    const uint8_t stream = Stream_Selected(pTemperature, count);
+    size_t failed = 0U;
+    size_t offset;
+    size_t block;
+    size_t i;
+
+    if ((pVoltage == NULL) || (pTemperature == NULL))
+    {
+        failed = count;
+    }
+    else if (BlockConverter_Init(&converter, type, mode) == 0U)
+    {
+        for (i = 0U; i < count; ++i)
+        {
+            pTemperature[i] = TC_CONVERSION_FAILED;
+        }
+        failed = count;
+    }
+    else
+    {
+        for (offset = 0U; offset < count; offset += block)
+        {
+            block = ((count - offset) < TC_BATCH_BLOCK_SIZE) ? (count - offset) : TC_BATCH_BLOCK_SIZE;
+
+            /* Keep a copy of the inputs: the output may alias them and the Newton steps need them */
+            for (i = 0U; i < block; ++i)
+            {
+                input[i] = pVoltage[offset + i];
+            }
+
+            if (stream != 0U)
+            {
+                Stream_Prefetch((const uint8_t *)pVoltage, sizeof(double), offset, block, count);
+                failed += BlockConverter_Convert(&converter, input, output, block);
+                Stream_Store(&pTemperature[offset], output, block);
+            }
+            else
+            {
+                failed += BlockConverter_Convert(&converter, input, &pTemperature[offset], block);
+            }
+        }
+
+        if (stream != 0U)
+        {
+            Stream_Fence();
+        }
+    }
+
+    return failed;
+}
+
+/**
+ * @brief  Calculates temperatures for voltages laid out with an arbitrary stride.
+ *
+ * @details
+ * Strided form of @ref TC_CalculateTemperatureArray for interleaved channels and
+ * arrays of structures. Each block of @c TC_BATCH_BLOCK_SIZE elements is gathered
+ * into a local buffer, converted and scattered back, so conversion can run in place
+ * over an acquisition buffer without deinterleaving it first.
+ *
+ * @param[in]  type               Thermocouple type as defined in the @c ThermocoupleType enum.
+ * @param[in]  pVoltage           First voltage in millivolts (mV).
+ * @param[in]  voltageStride      Distance between consecutive voltages in bytes.
+ * @param[out] pTemperature       First temperature in degrees Celsius.
+ * @param[in]  temperatureStride  Distance between consecutive temperatures in bytes.
+ * @param[in]  count              Number of elements.
+ * @param[in]  mode               Conversion mode as defined in the @c ConversionMode enum.
+ *
+ * @return Number of elements set to @c TC_CONVERSION_FAILED.
+ *
+ * @note The output may alias the input when both use the same stride.
+ */
+size_t TC_CalculateTemperatureStrided(ThermocoupleType type, const double *pVoltage, size_t voltageStride,
+                                      double *pTemperature, size_t temperatureStride, size_t count, ConversionMode mode)
+{
+    double input[TC_BATCH_BLOCK_SIZE];
+    double output[TC_BATCH_BLOCK_SIZE];
+    BlockConverter converter;
+    const uint8_t *pIn = (const uint8_t *)pVoltage;
+    uint8_t *pOut      = (uint8_t *)pTemperature;
+    uint8_t valid      = 0U;
+    uint8_t prefetch   = 0U;
+    uint8_t stream     = 0U;
+    size_t failed      = 0U;
+    size_t offset;
+    size_t block;
+    size_t i;
+
+    if ((pVoltage == NULL) || (pTemperature == NULL))
+    {
+        failed = count;
+    }
+    else
+    {
+        valid    = BlockConverter_Init(&converter, type, mode);
+        prefetch = ((TC_STREAMING != 0U) && (count >= TC_STREAM_THRESHOLD)) ? 1U : 0U;
+        stream   = (temperatureStride == sizeof(double)) ? Stream_Selected(pTemperature, count) : 0U;
+
+        for (offset = 0U; offset < count; offset += block)
+        {
+            block = ((count - offset) < TC_BATCH_BLOCK_SIZE) ? (count - offset) : TC_BATCH_BLOCK_SIZE;
+
+            if (prefetch != 0U)
+            {
+                Stream_Prefetch(pIn, voltageStride, offset, block, count);
+            }
+
+            for (i = 0U; i < block; ++i)
+            {
+                (void)memcpy(&input[i], &pIn[(offset + i) * voltageStride], sizeof(double));
+                output[i] = TC_CONVERSION_FAILED;
+            }
+
+            failed += (valid != 0U) ? BlockConverter_Convert(&converter, input, output, block) : block;
+
+            if (stream != 0U)
+            {
+                Stream_Store(&pTemperature[offset], output, block);
+            }
+            else
+            {
+                for (i = 0U; i < block; ++i)
+                {
+                    (void)memcpy(&pOut[(offset + i) * temperatureStride], &output[i], sizeof(double));
+                }
+            }
+        }
+
+        if (stream != 0U)
+        {
+            Stream_Fence();
+        }
+    }
+
+    return failed;
+}
+
+/**
+ * @brief Converts raw ADC codes of either width to temperatures.
+ *
+ * @details
+ * Shared implementation of @ref TC_CalculateTemperatureInt16 and
+ * @ref TC_CalculateTemperatureInt32; exactly one of @p pRaw16 and @p pRaw32 is used.
+ * The cold-junction voltage is folded into the offset once, so each code costs one
+ * integer-to-double conversion and one multiply-add before the block conversion.
+ *
+ * @param[in]  type          Thermocouple type.
+ * @param[in]  pRaw16        16-bit codes, or @c NULL.
+ * @param[in]  pRaw32        32-bit codes, or @c NULL.
+ * @param[out] pTemperature  Receives the temperatures in degrees Celsius.
+ * @param[in]  count         Number of elements.
+ * @param[in]  pScaling      ADC scaling and cold-junction temperature.
+ * @param[in]  mode          Conversion mode.
+ *
+ * @return Number of elements set to @c TC_CONVERSION_FAILED.
+ */
+static size_t Adc_Convert(ThermocoupleType type, const int16_t *pRaw16, const int32_t *pRaw32, double *pTemperature,
+                          size_t count, const AdcScaling *pScaling, ConversionMode mode)
+{
+    double input[TC_BATCH_BLOCK_SIZE];
+    double output[TC_BATCH_BLOCK_SIZE];
+    BlockConverter converter;
+    const uint8_t stream = Stream_Selected(pTemperature, count);
+    double bias        = TC_CONVERSION_FAILED;
+    double gain        = 0;
+    uint8_t valid      = 0U;
+    size_t failed      = 0U;
+    size_t offset;
+    size_t block;
+    size_t i;
+
+    if (((pRaw16 == NULL) && (pRaw32 == NULL)) || (pTemperature == NULL) || (pScaling == NULL))
+    {
+        failed = count;
+    }
+    else
+    {
+        bias = TC_CalculateVoltage(type, pScaling->coldJunction);
+        gain = pScaling->gain;
+        valid = (bias != TC_CONVERSION_FAILED) ? BlockConverter_Init(&converter, type, mode) : 0U;
+        bias += pScaling->offset;
+
+        for (offset = 0U; offset < count; offset += block)
+        {
+            block = ((count - offset) < TC_BATCH_BLOCK_SIZE) ? (count - offset) : TC_BATCH_BLOCK_SIZE;
+
+            if (valid == 0U)
+            {
+                for (i = 0U; i < block; ++i)
+                {
+                    pTemperature[offset + i] = TC_CONVERSION_FAILED;
+                }
+                failed += block;
+            }
+            else
+            {
+                if (pRaw16 != NULL)
+                {
+                    if (stream != 0U)
+                    {
+                        Stream_Prefetch((const uint8_t *)pRaw16, sizeof(int16_t), offset, block, count);
+                    }
+                    for (i = 0U; i < block; ++i)
+                    {
+                        input[i] = ((double)pRaw16[offset + i] * gain) + bias;
+                    }
+                }
+                else
+                {
+                    if (stream != 0U)
+                    {
+                        Stream_Prefetch((const uint8_t *)pRaw32, sizeof(int32_t), offset, block, count);
+                    }
+                    for (i = 0U; i < block; ++i)
+                    {
+                        input[i] = ((double)pRaw32[offset + i] * gain) + bias;
+                    }
+                }
+
+                if (stream != 0U)
+                {
+                    failed += BlockConverter_Convert(&converter, input, output, block);
+                    Stream_Store(&pTemperature[offset], output, block);
+                }
+                else
+                {
+                    failed += BlockConverter_Convert(&converter, input, &pTemperature[offset], block);
+                }
+            }
+        }
+
+        if (stream != 0U)
+        {
+            Stream_Fence();
+        }
+    }
+
+    return failed;
+}
+
+/**
+ * @brief  Calculates temperatures directly from signed 16-bit ADC codes.
+ *
+ * @param[in]  type          Thermocouple type as defined in the @c ThermocoupleType enum.
+ * @param[in]  pRaw          Array of ADC codes.
+ * @param[out] pTemperature  Receives the temperatures in degrees Celsius.
+ * @param[in]  count         Number of elements.
+ * @param[in]  pScaling      ADC scaling and cold-junction temperature.
+ * @param[in]  mode          Conversion mode as defined in the @c ConversionMode enum.
+ *
+ * @return Number of elements set to @c TC_CONVERSION_FAILED.
+ */
+size_t TC_CalculateTemperatureInt16(ThermocoupleType type, const int16_t *pRaw, double *pTemperature, size_t count,
+                                    const AdcScaling *pScaling, ConversionMode mode)
+{
+    return Adc_Convert(type, pRaw, NULL, pTemperature, count, pScaling, mode);
+}
+
+/**
+ * @brief  Calculates temperatures directly from signed 32-bit ADC codes.
+ *
+ * @param[in]  type          Thermocouple type as defined in the @c ThermocoupleType enum.
+ * @param[in]  pRaw          Array of ADC codes.
+ * @param[out] pTemperature  Receives the temperatures in degrees Celsius.
+ * @param[in]  count         Number of elements.
+ * @param[in]  pScaling      ADC scaling and cold-junction temperature.
+ * @param[in]  mode          Conversion mode as defined in the @c ConversionMode enum.
+ *
+ * @return Number of elements set to @c TC_CONVERSION_FAILED.
+ */
+size_t TC_CalculateTemperatureInt32(ThermocoupleType type, const int32_t *pRaw, double *pTemperature, size_t count,
+                                    const AdcScaling *pScaling, ConversionMode mode)
+{
+    return Adc_Convert(type, NULL, pRaw, pTemperature, count, pScaling, mode);
+}
+
+/**
+ * @brief Rounds a block of scaled temperatures and saturates them.
+ *
+ * @details
+ * The rounding mode is resolved outside the loops, so each loop is a plain
+ * multiply, round and clamp that the compiler can vectorize.
+ *
+ * @param[in,out] pValue    Temperatures on input; rounded, saturated multiples of the unit on output.
+ * @param[in]     count     Number of elements; at most @c TC_BATCH_BLOCK_SIZE.
+ * @param[in]     scale     Units per degree Celsius.
+ * @param[in]     limit     Largest magnitude of the result.
+ * @param[in]     rounding  Rounding mode.
+ */
+static void Quantize_Block(double *pValue, size_t count, double scale, double limit, RoundingMode rounding)
+{
+    size_t i;
+
+    switch (rounding)
+    {
+        case TC_ROUND_FLOOR:
+            for (i = 0U; i < count; ++i)
+            {
+                pValue[i] = floor(pValue[i] * scale);
+            }
+        break;
+
+        case TC_ROUND_CEIL:
+            for (i = 0U; i < count; ++i)
+            {
+                pValue[i] = ceil(pValue[i] * scale);
+            }
+        break;
+
+        case TC_ROUND_TRUNCATE:
+            for (i = 0U; i < count; ++i)
+            {
+                pValue[i] = trunc(pValue[i] * scale);
+            }
+        break;
+
+        default:
+            for (i = 0U; i < count; ++i)
+            {
+                pValue[i] = round(pValue[i] * scale);
+            }
+    }
+
+    for (i = 0U; i < count; ++i)
+    {
+        pValue[i] = (pValue[i] > limit) ? limit : ((pValue[i] < -limit) ? -limit : pValue[i]);
+    }
+}
+
+/**
+ * @brief Converts voltages to quantized temperatures of either width.
+ *
+ * @details
+ * Shared implementation of @ref TC_CalculateTemperatureDeci16 and
+ * @ref TC_CalculateTemperatureMilli32; exactly one of @p pOut16 and @p pOut32 is used.
+ * Each block of inputs is copied before any output is written, and an output element
+ * is never wider than an input one, so the output may start at the input address.
+ *
+ * @param[in]  type      Thermocouple type.
+ * @param[in]  pVoltage  Voltages in millivolts (mV).
+ * @param[out] pOut16    Deci-°C outputs, or @c NULL.
+ * @param[out] pOut32    Milli-°C outputs, or @c NULL.
+ * @param[in]  count     Number of elements.
+ * @param[in]  mode      Conversion mode.
+ * @param[in]  rounding  Rounding mode.
+ *
+ * @return Number of elements set to the failure code.
+ */
+static size_t Quantize_Convert(ThermocoupleType type, const double *pVoltage, int16_t *pOut16, int32_t *pOut32,
+                               size_t count, ConversionMode mode, RoundingMode rounding)
+{
+    double input[TC_BATCH_BLOCK_SIZE];
+    double output[TC_BATCH_BLOCK_SIZE];
+    uint8_t failure[TC_BATCH_BLOCK_SIZE];
+    BlockConverter converter;
+    uint8_t valid = 0U;
+    size_t failed = 0U;
+    size_t offset;
+    size_t block;
+    size_t i;
+
+    if ((pVoltage == NULL) || ((pOut16 == NULL) && (pOut32 == NULL)))
+    {
+        failed = count;
+    }
+    else
+    {
+        valid = BlockConverter_Init(&converter, type, mode);
+
+        for (offset = 0U; offset < count; offset += block)
+        {
+            block = ((count - offset) < TC_BATCH_BLOCK_SIZE) ? (count - offset) : TC_BATCH_BLOCK_SIZE;
+
+            for (i = 0U; i < block; ++i)
+            {
+                input[i]  = pVoltage[offset + i];
+                output[i] = TC_CONVERSION_FAILED;
+            }
+
+            failed += (valid != 0U) ? BlockConverter_Convert(&converter, input, output, block) : block;
+
+            for (i = 0U; i < block; ++i)
+            {
+                failure[i] = (output[i] == TC_CONVERSION_FAILED) ? 1U : 0U;
+            }
+
+            if (pOut16 != NULL)
+            {
+                Quantize_Block(output, block, 10.0, (double)INT16_MAX, rounding);
+                for (i = 0U; i < block; ++i)
+                {
+                    pOut16[offset + i] = (failure[i] != 0U) ? (int16_t)TC_DECI_FAILED : (int16_t)output[i];
+                }
+            }
+            else
+            {
+                Quantize_Block(output, block, 1000.0, (double)INT32_MAX, rounding);
+                for (i = 0U; i < block; ++i)
+                {
+                    pOut32[offset + i] = (failure[i] != 0U) ? (int32_t)TC_MILLI_FAILED : (int32_t)output[i];
+                }
+            }
+        }
+    }
+
+    return failed;
+}
+
+/**
+ * @brief  Calculates temperatures as signed 16-bit tenths of a degree Celsius.
+ *
+ * @param[in]  type      Thermocouple type as defined in the @c ThermocoupleType enum.
+ * @param[in]  pVoltage  Array of voltages in millivolts (mV).
+ * @param[out] pDeci     Receives the temperatures in 0.1 °C.
+ * @param[in]  count     Number of elements.
+ * @param[in]  mode      Conversion mode as defined in the @c ConversionMode enum.
+ * @param[in]  rounding  Rounding mode as defined in the @c RoundingMode enum.
+ *
+ * @return Number of elements set to @c TC_DECI_FAILED.
+ */
+size_t TC_CalculateTemperatureDeci16(ThermocoupleType type, const double *pVoltage, int16_t *pDeci, size_t count,
+                                     ConversionMode mode, RoundingMode rounding)
+{
+    return Quantize_Convert(type, pVoltage, pDeci, NULL, count, mode, rounding);
+}
+
+/**
+ * @brief  Calculates temperatures as signed 32-bit thousandths of a degree Celsius.
+ *
+ * @param[in]  type      Thermocouple type as defined in the @c ThermocoupleType enum.
+ * @param[in]  pVoltage  Array of voltages in millivolts (mV).
+ * @param[out] pMilli    Receives the temperatures in 0.001 °C.
+ * @param[in]  count     Number of elements.
+ * @param[in]  mode      Conversion mode as defined in the @c ConversionMode enum.
+ * @param[in]  rounding  Rounding mode as defined in the @c RoundingMode enum.
+ *
+ * @return Number of elements set to @c TC_MILLI_FAILED.
+ */
+size_t TC_CalculateTemperatureMilli32(ThermocoupleType type, const double *pVoltage, int32_t *pMilli, size_t count,
+                                      ConversionMode mode, RoundingMode rounding)
+{
+    return Quantize_Convert(type, pVoltage, NULL, pMilli, count, mode, rounding);
+}
+
+/**
+ * @brief  Lists the voltages at which the mV-to-°C polynomial changes segment.
+ *
+ * @details
+ * The ranges of every table are contiguous, so the joins are the upper bounds of all
+ * ranges but the last.
+ *
+ * @param[in]  type   Thermocouple type as defined in the @c ThermocoupleType enum.
+ * @param[out] pJoin  Receives up to @c TC_MAX_INVERSE_JOINS join voltages in mV.
+ *
+ * @return Number of joins written, or 0 if @p type is invalid.
+ */
+size_t TC_GetInverseJoins(ThermocoupleType type, double *pJoin)
+{
+    size_t ranges_len       = 0U;
+    const RangePoly *ranges = GetTemperatureRanges(type, &ranges_len);
+    size_t joins            = 0U;
+    size_t i;
+
+    if ((ranges != NULL) && (pJoin != NULL))
+    {
+        for (i = 0U; ((i + 1U) < ranges_len) && (joins < TC_MAX_INVERSE_JOINS); ++i)
+        {
+            pJoin[joins] = ranges[i].max;
+            joins++;
+        }
+    }
+
+    return joins;
 }
 
 
@@ -40,6 +40,35 @@ extern "C" {
 /** @brief Return value indicating that the conversion has failed */
 #define  TC_CONVERSION_FAILED  -1.0e6   ///< Conversion failure return value
 
+/** @brief Reserved codes of the quantized outputs for a failed conversion; never produced by saturation */
+#define  TC_DECI_FAILED        INT16_MIN    ///< Failure code of int16 deci-°C outputs
+#define  TC_MILLI_FAILED       INT32_MIN    ///< Failure code of int32 milli-°C outputs
+
+/** @brief Largest number of joins between the mV-to-°C polynomial segments of any type */
+#define  TC_MAX_INVERSE_JOINS  3U       ///< Segment joins of the inverse polynomials
+
+/** @brief Number of elements the batch functions process per block (sizes their stack buffers) */
+#ifndef TC_BATCH_BLOCK_SIZE
+#define  TC_BATCH_BLOCK_SIZE   64U      ///< Batch block length
+#endif
+
+
+/** @brief Element count from which the f64 batch outputs bypass the cache (streaming stores) */
+#ifndef TC_STREAM_THRESHOLD
+#define  TC_STREAM_THRESHOLD   (2U * 1024U * 1024U)    ///< 16 MiB of f64 output
+#endif
+
+/** @brief Distance in elements at which large batch conversions prefetch their inputs */
+#ifndef TC_PREFETCH_DISTANCE
+#define  TC_PREFETCH_DISTANCE  512U     ///< Eight blocks ahead
+#endif
+
+
+/** @brief Number of Newton steps applied by @c TC_MODE_EXACT conversions */
+#ifndef TC_NEWTON_STEPS
+#define  TC_NEWTON_STEPS       2U       ///< Newton refinement steps
+#endif
+
 
 /* --------------------------------------- Types -------------------------------------- */
 
@@ -56,6 +85,30 @@ typedef enum
     TC_TYPE_N,
 } ThermocoupleType;
 
+/** @brief Enumeration of mV-to-°C conversion modes */
+typedef enum
+{
+    TC_MODE_FAST = 0U,    /**< Inverse polynomial only, as @c TC_CalculateTemperature */
+    TC_MODE_EXACT,        /**< Inverse polynomial refined by Newton steps on the °C-to-mV function */
+} ConversionMode;
+
+/** @brief Enumeration of rounding modes of the quantized outputs */
+typedef enum
+{
+    TC_ROUND_NEAREST = 0U,    /**< To nearest, halfway cases away from zero, as @c round */
+    TC_ROUND_FLOOR,           /**< Towards minus infinity, as @c floor */
+    TC_ROUND_CEIL,            /**< Towards plus infinity, as @c ceil */
+    TC_ROUND_TRUNCATE,        /**< Towards zero, as @c trunc */
+} RoundingMode;
+
+/** @brief Linear scaling of raw ADC codes to thermocouple voltage with cold-junction compensation */
+typedef struct
+{
+    double gain;            /**< Millivolts per ADC code (LSB) */
+    double offset;          /**< Offset in millivolts added after scaling */
+    double coldJunction;    /**< Cold-junction (reference) temperature in degrees Celsius */
+} AdcScaling;
+
 /** @brief Structure for storing polynomial coefficients */
 typedef struct
 {
@@ -110,6 +163,238 @@ double TC_CalculateTemperature(ThermocoupleType type, double voltage);
  */
 double TC_CalculateVoltage(ThermocoupleType type, double temperature);
 
+/**
+ * @brief  Calculates temperature and its derivative from thermocouple voltage.
+ *
+ * @details
+ * Returns the same temperature as @ref TC_CalculateTemperature together with the slope
+ * dT/dV, both taken from a single Horner pass over the inverse polynomial.
+ *
+ * @param[in]  type         Thermocouple type (e.g., @c TC_TYPE_K, @c TC_TYPE_J) as defined in the @c ThermocoupleType enum.
+ * @param[in]  voltage      Measured voltage from the thermocouple in millivolts (mV).
+ * @param[out] pDerivative  Receives dT/dV in °C/mV, or @c TC_CONVERSION_FAILED. May be @c NULL.
+ *
+ * @return Calculated temperature in degrees Celsius.
+ *         Returns @c TC_CONVERSION_FAILED if the voltage is out of range or if the thermocouple type is invalid.
+ */
+double TC_CalculateTemperatureDerivative(ThermocoupleType type, double voltage, double *pDerivative);
+
+/**
+ * @brief  Calculates thermocouple voltage and the Seebeck coefficient from temperature.
+ *
+ * @details
+ * Returns the same voltage as @ref TC_CalculateVoltage together with the Seebeck
+ * coefficient dV/dT, both taken from a single Horner pass. The exponential term of
+ * type K is differentiated analytically.
+ *
+ * @param[in]  type         Thermocouple type (e.g., @c TC_TYPE_K, @c TC_TYPE_J) as defined in the @c ThermocoupleType enum.
+ * @param[in]  temperature  Temperature in degrees Celsius (°C).
+ * @param[out] pSeebeck     Receives dV/dT in mV/°C, or @c TC_CONVERSION_FAILED. May be @c NULL.
+ *
+ * @return Calculated voltage in millivolts (mV).
+ *         Returns @c TC_CONVERSION_FAILED if the temperature is out of range or the thermocouple type is invalid.
+ */
+double TC_CalculateVoltageDerivative(ThermocoupleType type, double temperature, double *pSeebeck);
+
+/**
+ * @brief  Calculates temperatures and their derivatives for an array of voltages.
+ *
+ * @param[in]  type          Thermocouple type as defined in the @c ThermocoupleType enum.
+ * @param[in]  pVoltage      Array of @p count voltages in millivolts (mV).
+ * @param[out] pTemperature  Receives the temperatures in degrees Celsius. May alias @p pVoltage.
+ * @param[out] pDerivative   Receives dT/dV in °C/mV. May be @c NULL.
+ * @param[in]  count         Number of elements.
+ *
+ * @return Number of elements set to @c TC_CONVERSION_FAILED.
+ *
+ * @note Results are bit-identical to @ref TC_CalculateTemperatureDerivative.
+ */
+size_t TC_CalculateTemperatureDerivativeArray(ThermocoupleType type, const double *pVoltage, double *pTemperature,
+                                              double *pDerivative, size_t count);
+
+/**
+ * @brief  Calculates voltages and Seebeck coefficients for an array of temperatures.
+ *
+ * @param[in]  type          Thermocouple type as defined in the @c ThermocoupleType enum.
+ * @param[in]  pTemperature  Array of @p count temperatures in degrees Celsius (°C).
+ * @param[out] pVoltage      Receives the voltages in millivolts (mV). May alias @p pTemperature.
+ * @param[out] pSeebeck      Receives dV/dT in mV/°C. May be @c NULL.
+ * @param[in]  count         Number of elements.
+ *
+ * @return Number of elements set to @c TC_CONVERSION_FAILED.
+ *
+ * @note Results are bit-identical to @ref TC_CalculateVoltageDerivative.
+ */
+size_t TC_CalculateVoltageDerivativeArray(ThermocoupleType type, const double *pTemperature, double *pVoltage,
+                                          double *pSeebeck, size_t count);
+
+/**
+ * @brief  Calculates temperature from thermocouple voltage, consistent with @ref TC_CalculateVoltage.
+ *
+ * @details
+ * The inverse (mV-to-°C) polynomials approximate the IEC 60584 reference functions to
+ * within about ±0.05 °C. This function seeds from the inverse polynomial and applies
+ * @c TC_NEWTON_STEPS Newton steps against the °C-to-mV reference function, so a round
+ * trip through @ref TC_CalculateVoltage reproduces the input voltage.
+ *
+ * @param[in]  type     Thermocouple type (e.g., @c TC_TYPE_K, @c TC_TYPE_J) as defined in the @c ThermocoupleType enum.
+ * @param[in]  voltage  Measured voltage from the thermocouple in millivolts (mV).
+ *
+ * @return Calculated temperature in degrees Celsius.
+ *         Returns @c TC_CONVERSION_FAILED if the voltage is out of range or if the thermocouple type is invalid.
+ *
+ * @note  Each Newton step costs one evaluation of the °C-to-mV function and its slope.
+ */
+double TC_CalculateTemperatureExact(ThermocoupleType type, double voltage);
+
+/**
+ * @brief  Calculates temperatures for an array of thermocouple voltages.
+ *
+ * @details
+ * From @c TC_STREAM_THRESHOLD elements on, the output rarely fits in the last-level cache
+ * and is not read back by the conversion, so on SSE2 targets it is written with
+ * non-temporal stores and the input is prefetched @c TC_PREFETCH_DISTANCE elements ahead.
+ * Results do not depend on the mode; define @c TC_NO_STREAMING to disable it.
+ *
+ * @param[in]  type          Thermocouple type as defined in the @c ThermocoupleType enum.
+ * @param[in]  pVoltage      Array of @p count voltages in millivolts (mV).
+ * @param[out] pTemperature  Receives the temperatures in degrees Celsius. May alias @p pVoltage.
+ * @param[in]  count         Number of elements.
+ * @param[in]  mode          @c TC_MODE_FAST or @c TC_MODE_EXACT.
+ *
+ * @return Number of elements set to @c TC_CONVERSION_FAILED.
+ *
+ * @note Results are bit-identical to @ref TC_CalculateTemperature (@c TC_MODE_FAST)
+ *       or @ref TC_CalculateTemperatureExact (@c TC_MODE_EXACT).
+ */
+size_t TC_CalculateTemperatureArray(ThermocoupleType type, const double *pVoltage, double *pTemperature,
+                                    size_t count, ConversionMode mode);
+
+/**
+ * @brief  Calculates temperatures for voltages laid out with an arbitrary stride.
+ *
+ * @details
+ * Converts @p count voltages read every @p voltageStride bytes and writes the temperatures
+ * every @p temperatureStride bytes, e.g. one channel of an interleaved frame buffer or one
+ * field of an array of timestamped records, without copying them to contiguous arrays.
+ * Large conversions prefetch the input as @ref TC_CalculateTemperatureArray does, one
+ * cache line per element when the stride spans a line; the output is streamed only when
+ * it is contiguous.
+ *
+ * @param[in]  type               Thermocouple type as defined in the @c ThermocoupleType enum.
+ * @param[in]  pVoltage           First voltage in millivolts (mV).
+ * @param[in]  voltageStride      Distance between consecutive voltages in bytes.
+ * @param[out] pTemperature       First temperature in degrees Celsius.
+ * @param[in]  temperatureStride  Distance between consecutive temperatures in bytes.
+ * @param[in]  count              Number of elements.
+ * @param[in]  mode               @c TC_MODE_FAST or @c TC_MODE_EXACT.
+ *
+ * @return Number of elements set to @c TC_CONVERSION_FAILED.
+ *
+ * @note The output may alias the input when both use the same stride.
+ */
+size_t TC_CalculateTemperatureStrided(ThermocoupleType type, const double *pVoltage, size_t voltageStride,
+                                      double *pTemperature, size_t temperatureStride, size_t count, ConversionMode mode);
+
+/**
+ * @brief  Calculates temperatures directly from signed 16-bit ADC codes.
+ *
+ * @details
+ * Each code is scaled to the thermocouple voltage as
+ * @c code * gain + offset + E(coldJunction), where E is the °C-to-mV reference function
+ * evaluated once per call, and converted in the same pass. No intermediate array of
+ * voltages is written. Large outputs are streamed as in @ref TC_CalculateTemperatureArray.
+ *
+ * @param[in]  type          Thermocouple type as defined in the @c ThermocoupleType enum.
+ * @param[in]  pRaw          Array of @p count ADC codes.
+ * @param[out] pTemperature  Receives the temperatures in degrees Celsius.
+ * @param[in]  count         Number of elements.
+ * @param[in]  pScaling      ADC scaling and cold-junction temperature.
+ * @param[in]  mode          @c TC_MODE_FAST or @c TC_MODE_EXACT.
+ *
+ * @return Number of elements set to @c TC_CONVERSION_FAILED. All elements fail if the
+ *         cold-junction temperature is out of range.
+ */
+size_t TC_CalculateTemperatureInt16(ThermocoupleType type, const int16_t *pRaw, double *pTemperature, size_t count,
+                                    const AdcScaling *pScaling, ConversionMode mode);
+
+/**
+ * @brief  Calculates temperatures directly from signed 32-bit ADC codes.
+ *
+ * @details
+ * As @ref TC_CalculateTemperatureInt16. 24-bit converters are supported either with
+ * sign-extended codes or with left-justified codes and @c gain divided by 256.
+ *
+ * @param[in]  type          Thermocouple type as defined in the @c ThermocoupleType enum.
+ * @param[in]  pRaw          Array of @p count ADC codes.
+ * @param[out] pTemperature  Receives the temperatures in degrees Celsius.
+ * @param[in]  count         Number of elements.
+ * @param[in]  pScaling      ADC scaling and cold-junction temperature.
+ * @param[in]  mode          @c TC_MODE_FAST or @c TC_MODE_EXACT.
+ *
+ * @return Number of elements set to @c TC_CONVERSION_FAILED. All elements fail if the
+ *         cold-junction temperature is out of range.
+ */
+size_t TC_CalculateTemperatureInt32(ThermocoupleType type, const int32_t *pRaw, double *pTemperature, size_t count,
+                                    const AdcScaling *pScaling, ConversionMode mode);
+
+/**
+ * @brief  Calculates temperatures as signed 16-bit tenths of a degree Celsius.
+ *
+ * @details
+ * Each block is converted as by @ref TC_CalculateTemperatureArray, then scaled by 10,
+ * rounded with @p rounding and saturated to [-32767, 32767] (±3276.7 °C) in the same
+ * pass. Failed conversions are stored as @c TC_DECI_FAILED, which saturation never
+ * produces. The output takes a quarter of the bytes of the double array.
+ *
+ * @param[in]  type      Thermocouple type as defined in the @c ThermocoupleType enum.
+ * @param[in]  pVoltage  Array of @p count voltages in millivolts (mV).
+ * @param[out] pDeci     Receives the temperatures in 0.1 °C. May start at the address of @p pVoltage.
+ * @param[in]  count     Number of elements.
+ * @param[in]  mode      @c TC_MODE_FAST or @c TC_MODE_EXACT.
+ * @param[in]  rounding  Rounding mode as defined in the @c RoundingMode enum.
+ *
+ * @return Number of elements set to @c TC_DECI_FAILED.
+ */
+size_t TC_CalculateTemperatureDeci16(ThermocoupleType type, const double *pVoltage, int16_t *pDeci, size_t count,
+                                     ConversionMode mode, RoundingMode rounding);
+
+/**
+ * @brief  Calculates temperatures as signed 32-bit thousandths of a degree Celsius.
+ *
+ * @details
+ * As @ref TC_CalculateTemperatureDeci16, scaled by 1000 and saturated to
+ * [-2147483647, 2147483647]. Failed conversions are stored as @c TC_MILLI_FAILED.
+ *
+ * @param[in]  type      Thermocouple type as defined in the @c ThermocoupleType enum.
+ * @param[in]  pVoltage  Array of @p count voltages in millivolts (mV).
+ * @param[out] pMilli    Receives the temperatures in 0.001 °C. May start at the address of @p pVoltage.
+ * @param[in]  count     Number of elements.
+ * @param[in]  mode      @c TC_MODE_FAST or @c TC_MODE_EXACT.
+ * @param[in]  rounding  Rounding mode as defined in the @c RoundingMode enum.
+ *
+ * @return Number of elements set to @c TC_MILLI_FAILED.
+ */
+size_t TC_CalculateTemperatureMilli32(ThermocoupleType type, const double *pVoltage, int32_t *pMilli, size_t count,
+                                      ConversionMode mode, RoundingMode rounding);
+
+/**
+ * @brief  Lists the voltages at which the mV-to-°C polynomial changes segment.
+ *
+ * @details
+ * The inverse polynomials of neighbouring segments do not meet exactly, so
+ * @ref TC_CalculateTemperature steps at each join (e.g. by -0.067 °C for type J at
+ * 42.914 mV). A join voltage itself converts with the lower segment; the next larger
+ * double converts with the upper one.
+ *
+ * @param[in]  type   Thermocouple type as defined in the @c ThermocoupleType enum.
+ * @param[out] pJoin  Receives the join voltages in mV in increasing order; room for
+ *                    @c TC_MAX_INVERSE_JOINS values.
+ *
+ * @return Number of joins written, or 0 if @p type is invalid.
+ */
+size_t TC_GetInverseJoins(ThermocoupleType type, double *pJoin);
+
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,497 @@
+/**
+ * @file    thermocouple_sensor.hpp
+ * @author  Amirhossein Askari
+ * @version v1.0.0
+ * @date    2026-10-16
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Header-only C++17 interface for thermocouple temperature-voltage conversions.
+ *
+ * @details
+ * Exposes the coefficient tables of @c thermocouple_sensor.c as @c constexpr data and
+ * provides @c tc::Thermocouple<Type>, whose conversions select the range table and
+ * polynomial degree at compile time. Calls inline into the caller with no runtime
+ * type dispatch, and return values bit-identical to @c TC_CalculateTemperature and
+ * @c TC_CalculateVoltage.
+ *
+ * All conversions are @c constexpr, so thresholds, lookup tables and test vectors can be
+ * computed at compile time (see @c tc::to_celsius, @c tc::to_millivolts and
+ * @c tc::celsius_table). Only the type K °C-to-mV term needs @c exp: in constant
+ * evaluation it uses a @c constexpr implementation accurate to a few ulp, which
+ * requires @c std::is_constant_evaluated (C++20) or @c __builtin_is_constant_evaluated.
+ *
+ * @note
+ * Header-only: no need to link @c thermocouple_sensor.c for the functions in this file.
+ *
+ * @warning
+ * Bit-identity with the C functions requires @c thermocouple_sensor.c to be built without
+ * floating-point contraction: an ISO C mode such as @c -std=c11, or @c -ffp-contract=off
+ * (GNU C modes fuse multiply-adds by default once FMA is enabled, e.g. by @c -march=native).
+ * This header never fuses them where @ref TC_UNFUSED has a barrier (GCC 12, Clang 15);
+ * with older compilers the C++ code needs @c -ffp-contract=off as well.
+ */
+
+
+#ifndef _THERMOCOUPLE_SENSOR_HPP
+#define _THERMOCOUPLE_SENSOR_HPP
+
+/* ------------------------------------- Includes ------------------------------------- */
+
+#include <array>                    ///< std::array for compile-time tables
+#include <cmath>                    ///< std::exp and std::pow for the type K term
+#include <cstddef>                  ///< std::size_t
+#include <type_traits>              ///< std::is_constant_evaluated
+#include "thermocouple_sensor.h"    ///< C types: ThermocoupleType, RangePoly, PolyCoeff
+
+
+/* -------------------------------------- Defines ------------------------------------- */
+
+/** @brief Nonzero if constant evaluation can be detected, making type K °C-to-mV @c constexpr */
+#if defined(__cpp_lib_is_constant_evaluated)
+#define  TC_CONSTEXPR_EXP   1    ///< std::is_constant_evaluated is available
+#elif defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+#define  TC_CONSTEXPR_EXP   1    ///< __builtin_is_constant_evaluated is available
+#endif
+#endif
+#ifndef TC_CONSTEXPR_EXP
+#define  TC_CONSTEXPR_EXP   0    ///< Type K °C-to-mV is not usable in constant expressions
+#endif
+
+/**
+ * @brief Rounds a product before it is added, so it is never fused into a multiply-add.
+ *
+ * @details
+ * g++ contracts across expressions by default (@c -ffp-contract=fast, also in ISO modes) and
+ * clang++ within them, while the C library built in ISO C mode rounds every product.
+ * @c __builtin_assoc_barrier (GCC 12, Clang 15) keeps the product separate without
+ * stopping inlining; other compilers need @c -ffp-contract=off.
+ */
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_assoc_barrier)
+#define  TC_UNFUSED(product)   __builtin_assoc_barrier(product)    ///< Barrier available
+#endif
+#endif
+#ifndef TC_UNFUSED
+#define  TC_UNFUSED(product)   (product)                           ///< Relies on -ffp-contract=off
+#endif
+
+
+namespace tc
+{
+
+/* -------------------------------------- Tables -------------------------------------- */
+
+namespace detail
+{
+#include "thermocouple_tables.h"
+} // namespace detail
+
+
+/* --------------------------------------- Types -------------------------------------- */
+
+/** @brief Thermocouple types, with the values of the C @c ThermocoupleType enum */
+enum class Type
+{
+    R = TC_TYPE_R,
+    S = TC_TYPE_S,
+    B = TC_TYPE_B,
+    J = TC_TYPE_J,
+    T = TC_TYPE_T,
+    E = TC_TYPE_E,
+    K = TC_TYPE_K,
+    N = TC_TYPE_N,
+};
+
+/** @brief Return value indicating that the conversion has failed, as @c TC_CONVERSION_FAILED */
+inline constexpr double conversion_failed = TC_CONVERSION_FAILED;
+
+
+namespace detail
+{
+
+/** @brief Range tables of one thermocouple type, selected at compile time */
+template <Type T> struct Tables;
+
+template <> struct Tables<Type::R>
+{
+    static constexpr const auto &inverse = TC_R_mVToTemp;
+    static constexpr const auto &forward = TC_R_TempToMV;
+};
+
+template <> struct Tables<Type::S>
+{
+    static constexpr const auto &inverse = TC_S_mVToTemp;
+    static constexpr const auto &forward = TC_S_TempToMV;
+};
+
+template <> struct Tables<Type::B>
+{
+    static constexpr const auto &inverse = TC_B_mVToTemp;
+    static constexpr const auto &forward = TC_B_TempToMV;
+};
+
+template <> struct Tables<Type::J>
+{
+    static constexpr const auto &inverse = TC_J_mVToTemp;
+    static constexpr const auto &forward = TC_J_TempToMV;
+};
+
+template <> struct Tables<Type::T>
+{
+    static constexpr const auto &inverse = TC_T_mVToTemp;
+    static constexpr const auto &forward = TC_T_TempToMV;
+};
+
+template <> struct Tables<Type::E>
+{
+    static constexpr const auto &inverse = TC_E_mVToTemp;
+    static constexpr const auto &forward = TC_E_TempToMV;
+};
+
+template <> struct Tables<Type::K>
+{
+    static constexpr const auto &inverse = TC_K_mVToTemp;
+    static constexpr const auto &forward = TC_K_TempToMV;
+};
+
+template <> struct Tables<Type::N>
+{
+    static constexpr const auto &inverse = TC_N_mVToTemp;
+    static constexpr const auto &forward = TC_N_TempToMV;
+};
+
+/**
+ * @brief Returns the common number of coefficients of a range table, or 0 if they differ.
+ *
+ * @param[in] ranges  Range table.
+ */
+template <std::size_t N>
+constexpr std::size_t common_length(const RangePoly (&ranges)[N]) noexcept
+{
+    std::size_t length = ranges[0].poly.length;
+    for (std::size_t i = 1; i < N; ++i)
+    {
+        length = (ranges[i].poly.length == length) ? length : 0U;
+    }
+    return length;
+}
+
+/**
+ * @brief Evaluates a polynomial with Horner's method, as @c Polynomial_Evaluate in C.
+ *
+ * @tparam    Length        Number of coefficients, known at compile time.
+ * @param[in] pCoefficient  Pointer to the coefficients.
+ * @param[in] input         The input value at which to evaluate the polynomial.
+ */
+template <std::size_t Length>
+constexpr double evaluate(const double *pCoefficient, double input) noexcept
+{
+    double result = 0;
+    for (std::size_t i = Length; i > 0U; --i)
+    {
+        result = TC_UNFUSED(result * input) + pCoefficient[i - 1U];
+    }
+    return result;
+}
+
+/**
+ * @brief Evaluates a polynomial with Horner's method, with a runtime number of coefficients.
+ *
+ * @param[in] poly   Polynomial coefficients.
+ * @param[in] input  The input value at which to evaluate the polynomial.
+ */
+constexpr double evaluate(const PolyCoeff &poly, double input) noexcept
+{
+    double result = 0;
+    for (std::size_t i = poly.length; i > 0U; --i)
+    {
+        result = TC_UNFUSED(result * input) + poly.pCoefficients[i - 1U];
+    }
+    return result;
+}
+
+/**
+ * @brief Finds the range containing a value, as @c FindPolyCoeff in C.
+ *
+ * @param[in] ranges  Range table.
+ * @param[in] value   Input value to locate.
+ *
+ * @return Pointer to the matching range, or @c nullptr if @p value is out of range.
+ */
+template <std::size_t N>
+constexpr const RangePoly *find_range(const RangePoly (&ranges)[N], double value) noexcept
+{
+    const RangePoly *result = nullptr;
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        if ((value >= ranges[i].min) && (value <= ranges[i].max))
+        {
+            result = &ranges[i];
+            break;
+        }
+    }
+    return result;
+}
+
+/** @brief Returns true during constant evaluation, where supported */
+constexpr bool is_constant_evaluated() noexcept
+{
+#if defined(__cpp_lib_is_constant_evaluated)
+    return std::is_constant_evaluated();
+#elif TC_CONSTEXPR_EXP
+    return __builtin_is_constant_evaluated();
+#else
+    return false;
+#endif
+}
+
+/**
+ * @brief Computes exp(x) in constant expressions.
+ *
+ * @details
+ * Reduces @p x to k * ln2 + r with |r| <= ln2 / 2 (ln2 split in two parts as in fdlibm),
+ * sums the Taylor series of exp(r) and scales by 2^k. Accurate to a few ulp over the
+ * range used by the type K term (-200 <= x <= 0).
+ *
+ * @param[in] x  Exponent.
+ */
+constexpr double constexpr_exp(double x) noexcept
+{
+    constexpr double ln2_hi  = 6.93147180369123816490e-01;
+    constexpr double ln2_lo  = 1.90821492927058770002e-10;
+    constexpr double inv_ln2 = 1.44269504088896338700e+00;
+
+    const double scaled = x * inv_ln2;
+    const long k        = static_cast<long>((scaled < 0.0) ? (scaled - 0.5) : (scaled + 0.5));
+    const double r      = (x - (static_cast<double>(k) * ln2_hi)) - (static_cast<double>(k) * ln2_lo);
+
+    double term   = 1.0;
+    double result = 1.0;
+    for (int n = 1; n < 24; ++n)
+    {
+        term *= r / n;
+        result += term;
+    }
+
+    for (long i = 0; i < k; ++i)
+    {
+        result *= 2.0;
+    }
+    for (long i = 0; i > k; --i)
+    {
+        result *= 0.5;
+    }
+    return result;
+}
+
+/**
+ * @brief Computes the exponential term of the type K °C-to-mV function.
+ *
+ * @details
+ * At run time evaluates the same expression as @c KType_Correction in C; in constant
+ * evaluation uses @ref constexpr_exp.
+ *
+ * @param[in] celsius  Temperature in degrees Celsius (°C), above 0 °C.
+ */
+constexpr double k_type_correction(double celsius) noexcept
+{
+    const double delta = celsius - TC_Coeff_K_TempToMV_A2;
+    double correction  = 0;
+
+    if (is_constant_evaluated())
+    {
+        correction = TC_Coeff_K_TempToMV_A0 * constexpr_exp(TC_Coeff_K_TempToMV_A1 * (delta * delta));
+    }
+    else
+    {
+        correction = TC_Coeff_K_TempToMV_A0 * std::exp(TC_Coeff_K_TempToMV_A1 * std::pow(delta, 2.0));
+    }
+    return correction;
+}
+
+} // namespace detail
+
+
+/* ------------------------------------- Interface ------------------------------------- */
+
+/**
+ * @brief Conversions of one thermocouple type, resolved at compile time.
+ *
+ * @tparam T  Thermocouple type.
+ */
+template <Type T>
+struct Thermocouple
+{
+    /** @brief Thermocouple type of this specialization */
+    static constexpr Type type = T;
+
+    /** @brief Number of coefficients of every mV-to-°C polynomial of this type */
+    static constexpr std::size_t inverse_length = detail::common_length(detail::Tables<T>::inverse);
+
+    static_assert(inverse_length > 0U, "mV-to-degC polynomials of one type must have equal length");
+
+    /**
+     * @brief  Calculates temperature from thermocouple voltage.
+     *
+     * @param[in] millivolts  Measured voltage from the thermocouple in millivolts (mV).
+     *
+     * @return Temperature in degrees Celsius, or @c tc::conversion_failed if out of range.
+     *         Bit-identical to @c TC_CalculateTemperature.
+     */
+    static constexpr double to_celsius(double millivolts) noexcept
+    {
+        const RangePoly *range = detail::find_range(detail::Tables<T>::inverse, millivolts);
+        return (range != nullptr) ? detail::evaluate<inverse_length>(range->poly.pCoefficients, millivolts)
+                                  : conversion_failed;
+    }
+
+    /**
+     * @brief  Calculates thermocouple voltage from temperature.
+     *
+     * @param[in] celsius  Temperature in degrees Celsius (°C).
+     *
+     * @return Voltage in millivolts (mV), or @c tc::conversion_failed if out of range.
+     *         Bit-identical to @c TC_CalculateVoltage at run time.
+     *
+     * @note For type K, usable in constant expressions only if @c TC_CONSTEXPR_EXP is nonzero.
+     */
+    static constexpr double to_millivolts(double celsius) noexcept
+    {
+        const RangePoly *range = detail::find_range(detail::Tables<T>::forward, celsius);
+        double voltage = conversion_failed;
+
+        if (range != nullptr)
+        {
+            voltage = detail::evaluate(range->poly, celsius);
+
+            if constexpr (T == Type::K)
+            {
+                if (celsius > 0.0)
+                {
+                    voltage += TC_UNFUSED(detail::k_type_correction(celsius));
+                }
+            }
+        }
+
+        return voltage;
+    }
+};
+
+/**
+ * @brief  Calculates temperature from thermocouple voltage, with the type chosen at run time.
+ *
+ * @param[in] type        Thermocouple type.
+ * @param[in] millivolts  Measured voltage from the thermocouple in millivolts (mV).
+ *
+ * @return Temperature in degrees Celsius, or @c tc::conversion_failed.
+ *         Bit-identical to @c TC_CalculateTemperature.
+ */
+constexpr double to_celsius(Type type, double millivolts) noexcept
+{
+    double result = conversion_failed;
+    switch (type)
+    {
+        case Type::R: result = Thermocouple<Type::R>::to_celsius(millivolts); break;
+        case Type::S: result = Thermocouple<Type::S>::to_celsius(millivolts); break;
+        case Type::B: result = Thermocouple<Type::B>::to_celsius(millivolts); break;
+        case Type::J: result = Thermocouple<Type::J>::to_celsius(millivolts); break;
+        case Type::T: result = Thermocouple<Type::T>::to_celsius(millivolts); break;
+        case Type::E: result = Thermocouple<Type::E>::to_celsius(millivolts); break;
+        case Type::K: result = Thermocouple<Type::K>::to_celsius(millivolts); break;
+        case Type::N: result = Thermocouple<Type::N>::to_celsius(millivolts); break;
+        default:      result = conversion_failed; break;
+    }
+    return result;
+}
+
+/**
+ * @brief  Calculates thermocouple voltage from temperature, with the type chosen at run time.
+ *
+ * @param[in] type     Thermocouple type.
+ * @param[in] celsius  Temperature in degrees Celsius (°C).
+ *
+ * @return Voltage in millivolts (mV), or @c tc::conversion_failed.
+ *         Bit-identical to @c TC_CalculateVoltage at run time.
+ */
+constexpr double to_millivolts(Type type, double celsius) noexcept
+{
+    double result = conversion_failed;
+    switch (type)
+    {
+        case Type::R: result = Thermocouple<Type::R>::to_millivolts(celsius); break;
+        case Type::S: result = Thermocouple<Type::S>::to_millivolts(celsius); break;
+        case Type::B: result = Thermocouple<Type::B>::to_millivolts(celsius); break;
+        case Type::J: result = Thermocouple<Type::J>::to_millivolts(celsius); break;
+        case Type::T: result = Thermocouple<Type::T>::to_millivolts(celsius); break;
+        case Type::E: result = Thermocouple<Type::E>::to_millivolts(celsius); break;
+        case Type::K: result = Thermocouple<Type::K>::to_millivolts(celsius); break;
+        case Type::N: result = Thermocouple<Type::N>::to_millivolts(celsius); break;
+        default:      result = conversion_failed; break;
+    }
+    return result;
+}
+
+/**
+ * @brief  Builds a voltage-to-temperature lookup table.
+ *
+ * @details
+ * Entry @c i holds the temperature at @p first + @c i * @p step millivolts.
+ * Intended for @c constexpr tables generated at compile time.
+ *
+ * @tparam    T      Thermocouple type.
+ * @tparam    N      Number of entries.
+ * @param[in] first  Voltage of the first entry in millivolts (mV).
+ * @param[in] step   Voltage increment between entries in millivolts (mV).
+ */
+template <Type T, std::size_t N>
+constexpr std::array<double, N> celsius_table(double first, double step) noexcept
+{
+    std::array<double, N> table{};
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        table[i] = Thermocouple<T>::to_celsius(first + (static_cast<double>(i) * step));
+    }
+    return table;
+}
+
+/**
+ * @brief  Builds a temperature-to-voltage lookup table.
+ *
+ * @details
+ * Entry @c i holds the voltage at @p first + @c i * @p step degrees Celsius.
+ *
+ * @tparam    T      Thermocouple type.
+ * @tparam    N      Number of entries.
+ * @param[in] first  Temperature of the first entry in degrees Celsius (°C).
+ * @param[in] step   Temperature increment between entries in degrees Celsius (°C).
+ */
+template <Type T, std::size_t N>
+constexpr std::array<double, N> millivolt_table(double first, double step) noexcept
+{
+    std::array<double, N> table{};
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        table[i] = Thermocouple<T>::to_millivolts(first + (static_cast<double>(i) * step));
+    }
+    return table;
+}
+
+
+/* ------------------------------------ Self-checks ------------------------------------ */
+
+/* Reference values produced by the C functions (TC_CalculateTemperature/TC_CalculateVoltage) */
+static_assert(to_celsius(Type::K, 17.85) == 0x1.b250a6c5ededcp+8, "type K mV-to-degC differs from the C path");
+static_assert(to_celsius(Type::R, 10.0) == 0x1.e0c257664354fp+9, "type R mV-to-degC differs from the C path");
+static_assert(to_millivolts(Type::J, 100.0) == 0x1.5135ebcddc606p+2, "type J degC-to-mV differs from the C path");
+static_assert(to_millivolts(Type::K, -156.0) == -0x1.434ecb4aa8872p+2, "type K degC-to-mV differs from the C path");
+static_assert(to_celsius(Type::K, 60.0) == conversion_failed, "out-of-range voltage must fail");
+#if TC_CONSTEXPR_EXP
+static_assert((to_millivolts(Type::K, 1000.0) - 0x1.4a347128637aap+5) < 1.0e-12, "type K degC-to-mV differs from the C path");
+static_assert((to_millivolts(Type::K, 1000.0) - 0x1.4a347128637aap+5) > -1.0e-12, "type K degC-to-mV differs from the C path");
+#endif
+
+} // namespace tc
+
+
+#endif /* thermocouple_sensor.hpp */
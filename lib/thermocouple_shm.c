@@ -0,0 +1,396 @@
+/**
+ * @file    thermocouple_shm.c
+ * @author  Amirhossein Askari
+ * @version v1.0.0
+ * @date    2026-10-16
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Source file for the shared-memory ring of converted frames.
+ *
+ * @details
+ * Layout of the shared object: the @c ShmRingHeader, then @c slotCount slots of
+ * @c slotStride bytes, each an @c ShmSlotHeader followed one cache line later by the
+ * frame samples. Frame @c n lives in slot @c n & (slotCount - 1).
+ */
+
+
+/* ------------------------------------- Includes -------------------------------------- */
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE               ///< shm_open, ftruncate
+#endif
+#include "thermocouple_shm.h"    ///< Header file for the shared ring
+#include <fcntl.h>               ///< O_* flags
+#include <string.h>              ///< memcpy
+#include <sys/mman.h>            ///< shm_open, mmap
+#include <sys/stat.h>            ///< fstat
+#include <unistd.h>              ///< ftruncate, close
+
+#if (ATOMIC_LLONG_LOCK_FREE != 2)
+#error "thermocouple_shm requires lock-free 64-bit atomics"
+#endif
+
+
+
+/* -------------------------------------- Defines -------------------------------------- */
+
+/** @brief Rounds @p bytes up to a whole number of cache lines */
+#define  SHM_ALIGN(bytes)    ((((bytes) + TC_CACHE_LINE_SIZE) - 1U) & ~((size_t)TC_CACHE_LINE_SIZE - 1U))
+
+
+
+/* ------------------------------------- Functions ------------------------------------- */
+
+/**
+ * @brief  Returns the header of the slot holding a frame.
+ *
+ * @param[in] pRing  Ring handle.
+ * @param[in] frame  Frame number.
+ *
+ * @return Slot header.
+ */
+static ShmSlotHeader *ShmRing_Slot(const ShmRing *pRing, uint64_t frame)
+{
+    const ShmRingHeader *pHeader = pRing->pHeader;
+    uint8_t *pBase = (uint8_t *)pRing->pHeader + SHM_ALIGN(sizeof(ShmRingHeader));
+
+    return (ShmSlotHeader *)&pBase[(size_t)(frame & (pHeader->slotCount - 1U)) * (size_t)pHeader->slotStride];
+}
+
+/**
+ * @brief  Returns the samples of a slot.
+ *
+ * @param[in] pSlot  Slot header.
+ *
+ * @return First sample of the slot.
+ */
+static double *ShmRing_Data(ShmSlotHeader *pSlot)
+{
+    return (double *)((uint8_t *)pSlot + TC_CACHE_LINE_SIZE);
+}
+
+/**
+ * @brief  Creates (or replaces) a shared ring and opens it for writing.
+ *
+ * @param[out] pRing          Handle to initialize.
+ * @param[in]  pName          Shared-memory object name, e.g. "/tc-frames".
+ * @param[in]  slotCount      Number of frames kept; must be a power of two.
+ * @param[in]  frameCapacity  Maximum samples per frame.
+ *
+ * @return 1 on success, otherwise 0.
+ */
+uint8_t TC_ShmRing_Create(ShmRing *pRing, const char *pName, size_t slotCount, size_t frameCapacity)
+{
+    const size_t stride = SHM_ALIGN(TC_CACHE_LINE_SIZE + (frameCapacity * sizeof(double)));
+    const size_t size   = SHM_ALIGN(sizeof(ShmRingHeader)) + (slotCount * stride);
+    uint8_t result = 0U;
+    void *pMap     = MAP_FAILED;
+    size_t i;
+    int fd = -1;
+
+    if ((pRing != NULL) && (pName != NULL) && (slotCount != 0U) && ((slotCount & (slotCount - 1U)) == 0U) &&
+        (frameCapacity != 0U))
+    {
+        fd = shm_open(pName, O_CREAT | O_RDWR | O_TRUNC, 0644);
+    }
+
+    if ((fd >= 0) && (ftruncate(fd, (off_t)size) == 0))
+    {
+        pMap = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+    if (fd >= 0)
+    {
+        (void)close(fd);
+    }
+
+    if (pMap != MAP_FAILED)
+    {
+        ShmRingHeader *pHeader = (ShmRingHeader *)pMap;
+
+        pRing->pHeader = pHeader;
+        pRing->mapSize = size;
+        pRing->cursor  = 0U;
+
+        pHeader->reserved      = 0U;
+        pHeader->slotCount     = (uint64_t)slotCount;
+        pHeader->frameCapacity = (uint64_t)frameCapacity;
+        pHeader->slotStride    = (uint64_t)stride;
+        atomic_init(&pHeader->head, 0U);
+        for (i = 0U; i < slotCount; ++i)
+        {
+            ShmSlotHeader *pSlot = ShmRing_Slot(pRing, (uint64_t)i);
+            atomic_init(&pSlot->sequence, 0U);
+            pSlot->count = 0U;
+        }
+
+        /* Readers accept the object only once the magic is visible */
+        atomic_thread_fence(memory_order_release);
+        pHeader->magic = TC_SHM_MAGIC;
+        result = 1U;
+    }
+
+    return result;
+}
+
+/**
+ * @brief  Opens an existing shared ring for reading.
+ *
+ * @param[out] pRing  Handle to initialize.
+ * @param[in]  pName  Shared-memory object name.
+ *
+ * @return 1 on success, or 0 if the object does not exist or is not a ring.
+ */
+uint8_t TC_ShmRing_Open(ShmRing *pRing, const char *pName)
+{
+    struct stat info;
+    uint8_t result = 0U;
+    void *pMap     = MAP_FAILED;
+    int fd         = -1;
+
+    if ((pRing != NULL) && (pName != NULL))
+    {
+        fd = shm_open(pName, O_RDONLY, 0);
+    }
+
+    if ((fd >= 0) && (fstat(fd, &info) == 0) && ((size_t)info.st_size >= SHM_ALIGN(sizeof(ShmRingHeader))))
+    {
+        pMap = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    }
+    if (fd >= 0)
+    {
+        (void)close(fd);
+    }
+
+    if (pMap != MAP_FAILED)
+    {
+        ShmRingHeader *pHeader = (ShmRingHeader *)pMap;
+        const uint32_t magic   = pHeader->magic;
+
+        atomic_thread_fence(memory_order_acquire);
+        if ((magic == TC_SHM_MAGIC) && (pHeader->slotCount != 0U) &&
+            ((SHM_ALIGN(sizeof(ShmRingHeader)) + (pHeader->slotCount * pHeader->slotStride)) <= (uint64_t)info.st_size))
+        {
+            pRing->pHeader = pHeader;
+            pRing->mapSize = (size_t)info.st_size;
+            pRing->cursor  = atomic_load_explicit(&pHeader->head, memory_order_acquire);
+            result = 1U;
+        }
+        else
+        {
+            (void)munmap(pMap, (size_t)info.st_size);
+        }
+    }
+
+    return result;
+}
+
+/**
+ * @brief  Unmaps a ring handle.
+ *
+ * @param[in] pRing  Handle.
+ */
+void TC_ShmRing_Close(ShmRing *pRing)
+{
+    if ((pRing != NULL) && (pRing->pHeader != NULL))
+    {
+        (void)munmap(pRing->pHeader, pRing->mapSize);
+        pRing->pHeader = NULL;
+    }
+}
+
+/**
+ * @brief  Removes the shared-memory object; mapped handles stay valid.
+ *
+ * @param[in] pName  Shared-memory object name.
+ */
+void TC_ShmRing_Unlink(const char *pName)
+{
+    (void)shm_unlink(pName);
+}
+
+/**
+ * @brief  Returns the next slot for the writer to fill, marking it invalid for readers.
+ *
+ * @param[in] pRing  Writer handle.
+ *
+ * @return Slot of @c frameCapacity samples.
+ */
+double *TC_ShmRing_Begin(ShmRing *pRing)
+{
+    ShmSlotHeader *pSlot = ShmRing_Slot(pRing, pRing->cursor);
+
+    atomic_store_explicit(&pSlot->sequence, 0U, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+
+    return ShmRing_Data(pSlot);
+}
+
+/**
+ * @brief  Publishes the slot returned by @ref TC_ShmRing_Begin.
+ *
+ * @param[in] pRing  Writer handle.
+ * @param[in] count  Number of samples in the frame; clamped to @c frameCapacity.
+ */
+void TC_ShmRing_Commit(ShmRing *pRing, size_t count)
+{
+    ShmRingHeader *pHeader = pRing->pHeader;
+    ShmSlotHeader *pSlot   = ShmRing_Slot(pRing, pRing->cursor);
+
+    pSlot->count = ((uint64_t)count < pHeader->frameCapacity) ? (uint64_t)count : pHeader->frameCapacity;
+    pRing->cursor++;
+    atomic_store_explicit(&pSlot->sequence, pRing->cursor, memory_order_release);
+    atomic_store_explicit(&pHeader->head, pRing->cursor, memory_order_release);
+}
+
+/**
+ * @brief  Converts voltages straight into the next slot and publishes it.
+ *
+ * @param[in] pRing     Writer handle.
+ * @param[in] type      Thermocouple type.
+ * @param[in] mode      Conversion mode as defined in the @c ConversionMode enum.
+ * @param[in] pVoltage  Voltages in millivolts (mV).
+ * @param[in] count     Number of samples; at most @c frameCapacity are published.
+ *
+ * @return Number of samples set to @c TC_CONVERSION_FAILED.
+ */
+size_t TC_ShmRing_PublishVoltages(ShmRing *pRing, ThermocoupleType type, ConversionMode mode,
+                                  const double *pVoltage, size_t count)
+{
+    const size_t capacity = (size_t)pRing->pHeader->frameCapacity;
+    const size_t n        = (count < capacity) ? count : capacity;
+    double *pFrame        = TC_ShmRing_Begin(pRing);
+    const size_t failed   = TC_CalculateTemperatureArray(type, pVoltage, pFrame, n, mode);
+
+    TC_ShmRing_Commit(pRing, n);
+
+    return failed;
+}
+
+/**
+ * @brief  Returns the reader's next frame in place.
+ *
+ * @details
+ * Skips the frames the writer has already overwritten, counting them in @p pLost.
+ *
+ * @param[in]  pRing   Reader handle.
+ * @param[out] pCount  Receives the number of samples in the frame.
+ * @param[out] pLost   Optional; incremented by the number of frames lost.
+ *
+ * @return Frame, or NULL if no new frame has been published.
+ */
+const double *TC_ShmRing_Peek(ShmRing *pRing, size_t *pCount, uint64_t *pLost)
+{
+    const ShmRingHeader *pHeader = pRing->pHeader;
+    const double *pFrame = NULL;
+    uint64_t lost  = 0U;
+    uint8_t search = 1U;
+
+    while (search != 0U)
+    {
+        const uint64_t head = atomic_load_explicit(&pRing->pHeader->head, memory_order_acquire);
+
+        if ((pRing->cursor + pHeader->slotCount) < head)
+        {
+            lost += head - pHeader->slotCount - pRing->cursor;
+            pRing->cursor = head - pHeader->slotCount;
+        }
+
+        if (pRing->cursor >= head)
+        {
+            search = 0U;
+        }
+        else
+        {
+            ShmSlotHeader *pSlot = ShmRing_Slot(pRing, pRing->cursor);
+
+            if (atomic_load_explicit(&pSlot->sequence, memory_order_acquire) == (pRing->cursor + 1U))
+            {
+                const uint64_t count = pSlot->count;
+                *pCount = (size_t)((count < pHeader->frameCapacity) ? count : pHeader->frameCapacity);
+                pFrame  = ShmRing_Data(pSlot);
+                search  = 0U;
+            }
+            else
+            {
+                /* Lapped by the writer while looking */
+                lost++;
+                pRing->cursor++;
+            }
+        }
+    }
+
+    if (pLost != NULL)
+    {
+        *pLost += lost;
+    }
+
+    return pFrame;
+}
+
+/**
+ * @brief  Finishes reading the frame returned by @ref TC_ShmRing_Peek and moves to the next.
+ *
+ * @param[in] pRing  Reader handle.
+ *
+ * @return 1 if the frame was intact, or 0 if the writer overwrote it during the read.
+ */
+uint8_t TC_ShmRing_Release(ShmRing *pRing)
+{
+    ShmSlotHeader *pSlot = ShmRing_Slot(pRing, pRing->cursor);
+    uint8_t intact;
+
+    atomic_thread_fence(memory_order_acquire);
+    intact = (atomic_load_explicit(&pSlot->sequence, memory_order_relaxed) == (pRing->cursor + 1U)) ? 1U : 0U;
+    pRing->cursor++;
+
+    return intact;
+}
+
+/**
+ * @brief  Copies the reader's next intact frame out of the ring.
+ *
+ * @param[in]  pRing         Reader handle.
+ * @param[out] pTemperature  Receives the frame.
+ * @param[in]  capacity      Length of @p pTemperature; longer frames are truncated.
+ * @param[out] pLost         Optional; incremented by the number of frames lost.
+ *
+ * @return Number of samples copied, or 0 if no new frame is available.
+ */
+size_t TC_ShmRing_Read(ShmRing *pRing, double *pTemperature, size_t capacity, uint64_t *pLost)
+{
+    size_t copied = 0U;
+    uint8_t done  = 0U;
+
+    while (done == 0U)
+    {
+        size_t count;
+        const double *pFrame = TC_ShmRing_Peek(pRing, &count, pLost);
+
+        if (pFrame == NULL)
+        {
+            done = 1U;
+        }
+        else
+        {
+            copied = (count < capacity) ? count : capacity;
+            (void)memcpy(pTemperature, pFrame, copied * sizeof(double));
+            if (TC_ShmRing_Release(pRing) != 0U)
+            {
+                done = 1U;
+            }
+            else
+            {
+                copied = 0U;
+                if (pLost != NULL)
+                {
+                    (*pLost)++;
+                }
+            }
+        }
+    }
+
+    return copied;
+}
+
+
+/* thermocouple_shm.c */
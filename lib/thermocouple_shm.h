@@ -0,0 +1,187 @@
+/**
+ * @file    thermocouple_shm.h
+ * @author  Amirhossein Askari
+ * @version v1.0.0
+ * @date    2026-10-16
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Header file for the shared-memory ring of converted frames.
+ *
+ * @details
+ * A POSIX shared-memory ring with one writer process and any number of reader processes.
+ * The writer converts each frame once, straight into a ring slot, and publishes it. Every
+ * reader keeps its own cursor and reads the frames in place, without copying. Readers
+ * never block the writer. A reader that falls more than a ring's length behind loses the
+ * oldest frames, and the per-slot sequence numbers report exactly how many.
+ *
+ * @note
+ * Slots use a sequence-lock scheme: the writer invalidates a slot's sequence number before
+ * rewriting it, and a reader validates the number again after using the frame. A frame
+ * torn by a concurrent rewrite is therefore detected (@ref TC_ShmRing_Release returns 0)
+ * rather than silently consumed. Requires POSIX shared memory (@c shm_open, link @c -lrt
+ * on older glibc) and lock-free 64-bit atomics.
+ */
+
+
+#ifndef _THERMOCOUPLE_SHM_H
+#define _THERMOCOUPLE_SHM_H
+
+/* ------------------------------------- Includes ------------------------------------- */
+
+#include "thermocouple_atomic.h"    ///< Atomic members and cache-line alignment
+#include "thermocouple_sensor.h"    ///< Thermocouple types and batch conversions
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/* -------------------------------------- Defines ------------------------------------- */
+
+/** @brief Layout identifier stored at the start of the shared object, "TCR1" */
+#define  TC_SHM_MAGIC    0x31524354U    ///< Shared ring magic
+
+
+/* --------------------------------------- Types -------------------------------------- */
+
+/** @brief Header at the start of the shared object */
+typedef struct
+{
+    uint32_t magic;                                 /**< @c TC_SHM_MAGIC */
+    uint32_t reserved;                              /**< Zero */
+    uint64_t slotCount;                             /**< Number of slots, a power of two */
+    uint64_t frameCapacity;                         /**< Samples per slot */
+    uint64_t slotStride;                            /**< Bytes between consecutive slots */
+    TC_CACHE_ALIGNED TC_ATOMIC(uint64_t) head;      /**< Number of frames published so far */
+} ShmRingHeader;
+
+/** @brief Header of each slot; the frame samples follow on the next cache line */
+typedef struct
+{
+    TC_ATOMIC(uint64_t) sequence;    /**< Frame number + 1 when complete, 0 while being written */
+    uint64_t count;                  /**< Number of samples in the frame */
+} ShmSlotHeader;
+
+/** @brief Process-local handle of a shared ring, for the writer or for one reader */
+typedef struct
+{
+    ShmRingHeader *pHeader;    /**< Mapped shared object */
+    size_t mapSize;            /**< Size of the mapping in bytes */
+    uint64_t cursor;           /**< Writer: frame being written; reader: next frame to read */
+} ShmRing;
+
+
+/* ------------------------------------- Prototype ------------------------------------- */
+
+/**
+ * @brief  Creates (or replaces) a shared ring and opens it for writing.
+ *
+ * @param[out] pRing          Handle to initialize.
+ * @param[in]  pName          Shared-memory object name, e.g. "/tc-frames".
+ * @param[in]  slotCount      Number of frames kept; must be a power of two.
+ * @param[in]  frameCapacity  Maximum samples per frame.
+ *
+ * @return 1 on success, otherwise 0.
+ */
+uint8_t TC_ShmRing_Create(ShmRing *pRing, const char *pName, size_t slotCount, size_t frameCapacity);
+
+/**
+ * @brief  Opens an existing shared ring for reading.
+ *
+ * @details
+ * The reader starts at the next frame to be published.
+ *
+ * @param[out] pRing  Handle to initialize.
+ * @param[in]  pName  Shared-memory object name.
+ *
+ * @return 1 on success, or 0 if the object does not exist or is not a ring.
+ */
+uint8_t TC_ShmRing_Open(ShmRing *pRing, const char *pName);
+
+/**
+ * @brief  Unmaps a ring handle.
+ *
+ * @param[in] pRing  Handle.
+ */
+void TC_ShmRing_Close(ShmRing *pRing);
+
+/**
+ * @brief  Removes the shared-memory object; mapped handles stay valid.
+ *
+ * @param[in] pName  Shared-memory object name.
+ */
+void TC_ShmRing_Unlink(const char *pName);
+
+/**
+ * @brief  Returns the next slot for the writer to fill, marking it invalid for readers.
+ *
+ * @param[in] pRing  Writer handle.
+ *
+ * @return Slot of @c frameCapacity samples.
+ */
+double *TC_ShmRing_Begin(ShmRing *pRing);
+
+/**
+ * @brief  Publishes the slot returned by @ref TC_ShmRing_Begin.
+ *
+ * @param[in] pRing  Writer handle.
+ * @param[in] count  Number of samples in the frame; clamped to @c frameCapacity.
+ */
+void TC_ShmRing_Commit(ShmRing *pRing, size_t count);
+
+/**
+ * @brief  Converts voltages straight into the next slot and publishes it.
+ *
+ * @param[in] pRing     Writer handle.
+ * @param[in] type      Thermocouple type.
+ * @param[in] mode      @c TC_MODE_FAST or @c TC_MODE_EXACT.
+ * @param[in] pVoltage  Voltages in millivolts (mV).
+ * @param[in] count     Number of samples; at most @c frameCapacity are published.
+ *
+ * @return Number of samples set to @c TC_CONVERSION_FAILED.
+ */
+size_t TC_ShmRing_PublishVoltages(ShmRing *pRing, ThermocoupleType type, ConversionMode mode,
+                                  const double *pVoltage, size_t count);
+
+/**
+ * @brief  Returns the reader's next frame in place.
+ *
+ * @param[in]  pRing   Reader handle.
+ * @param[out] pCount  Receives the number of samples in the frame.
+ * @param[out] pLost   Optional; incremented by the number of frames overwritten before
+ *                     this reader got to them.
+ *
+ * @return Frame in degrees Celsius, or NULL if no new frame has been published. Call
+ *         @ref TC_ShmRing_Release once done with it.
+ */
+const double *TC_ShmRing_Peek(ShmRing *pRing, size_t *pCount, uint64_t *pLost);
+
+/**
+ * @brief  Finishes reading the frame returned by @ref TC_ShmRing_Peek and moves to the next.
+ *
+ * @param[in] pRing  Reader handle.
+ *
+ * @return 1 if the frame was intact, or 0 if the writer overwrote it during the read
+ *         (the data must then be discarded).
+ */
+uint8_t TC_ShmRing_Release(ShmRing *pRing);
+
+/**
+ * @brief  Copies the reader's next intact frame out of the ring.
+ *
+ * @param[in]  pRing         Reader handle.
+ * @param[out] pTemperature  Receives the frame.
+ * @param[in]  capacity      Length of @p pTemperature; longer frames are truncated.
+ * @param[out] pLost         Optional; incremented by the number of frames lost.
+ *
+ * @return Number of samples copied, or 0 if no new frame is available.
+ */
+size_t TC_ShmRing_Read(ShmRing *pRing, double *pTemperature, size_t capacity, uint64_t *pLost);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* thermocouple_shm.h */
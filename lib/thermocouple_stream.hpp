@@ -0,0 +1,257 @@
+/**
+ * @file    thermocouple_stream.hpp
+ * @author  Amirhossein Askari
+ * @version v1.0.0
+ * @date    2026-10-16
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   C++20 coroutine interface for streaming conversions from an async source.
+ *
+ * @details
+ * @c tc::stream_to_celsius is a lazy asynchronous generator: each @c co_await on
+ * @c next() reads one block from the source, converts it in place with
+ * @c TC_CalculateTemperatureArray and hands the temperatures back to the consumer.
+ *
+ * @code
+ * tc::memory_source source(millivolts);
+ * auto stream = tc::stream_to_celsius(source, tc::Type::K);
+ * for (auto block = co_await stream.next(); !block.empty(); block = co_await stream.next()) { ... }
+ * @endcode
+ *
+ * A source is any object whose @c read(std::span<double>) returns an awaitable yielding
+ * the number of samples written, with 0 marking the end of the data. While a read is
+ * pending, the stream is suspended and the reactor thread is free. Conversion runs on
+ * whichever thread resumes the read. The stream reads nothing until the consumer asks
+ * for the next block, which is what gives it backpressure.
+ *
+ * @note
+ * Requires C++20 and linking @c thermocouple_sensor.c. The source must outlive the stream,
+ * and each yielded block stays valid only until the next call to @c next().
+ */
+
+
+#ifndef _THERMOCOUPLE_STREAM_HPP
+#define _THERMOCOUPLE_STREAM_HPP
+
+/* ------------------------------------- Includes ------------------------------------- */
+
+#include <algorithm>                  ///< std::min, std::copy_n
+#include <coroutine>                  ///< Coroutine machinery
+#include <cstddef>                    ///< std::size_t
+#include <exception>                  ///< std::exception_ptr
+#include <span>                       ///< std::span
+#include <utility>                    ///< std::exchange
+#include <vector>                     ///< Block buffer
+#include "thermocouple_sensor.hpp"    ///< tc::Type
+
+
+namespace tc
+{
+
+/* -------------------------------------- Defines ------------------------------------- */
+
+/** @brief Default number of samples read and converted per stream block */
+inline constexpr std::size_t stream_block_size = 16U * TC_BATCH_BLOCK_SIZE;
+
+
+/* --------------------------------------- Types -------------------------------------- */
+
+/** @brief Source whose @c read(std::span<double>) is awaitable and yields a sample count */
+template <class Source>
+concept async_sample_source = requires(Source &source, std::span<double> buffer) {
+    { source.read(buffer).await_resume() } -> std::convertible_to<std::size_t>;
+};
+
+/**
+ * @brief Asynchronous generator of converted temperature blocks.
+ *
+ * @details
+ * Move-only; destroying the stream destroys the suspended coroutine.
+ */
+class temperature_stream
+{
+public:
+    struct promise_type;
+    using handle_type = std::coroutine_handle<promise_type>;
+
+    /** @brief Transfers control from the stream back to the consumer waiting in @c next() */
+    struct resume_consumer
+    {
+        bool await_ready() const noexcept { return false; }
+        std::coroutine_handle<> await_suspend(handle_type handle) const noexcept { return handle.promise().consumer; }
+        void await_resume() const noexcept {}
+    };
+
+    struct promise_type
+    {
+        std::span<const double> block;                           /**< Last yielded block */
+        std::coroutine_handle<> consumer = std::noop_coroutine(); /**< Coroutine waiting in next() */
+        std::exception_ptr error;                                /**< Exception raised by the source */
+
+        temperature_stream get_return_object() noexcept { return temperature_stream{handle_type::from_promise(*this)}; }
+        std::suspend_always initial_suspend() const noexcept { return {}; }
+
+        resume_consumer yield_value(std::span<const double> converted) noexcept
+        {
+            block = converted;
+            return {};
+        }
+
+        resume_consumer final_suspend() noexcept
+        {
+            block = {};
+            return {};
+        }
+
+        void return_void() const noexcept {}
+        void unhandled_exception() noexcept { error = std::current_exception(); }
+    };
+
+    /** @brief Awaitable returned by @c next() */
+    struct next_awaiter
+    {
+        handle_type handle;
+
+        bool await_ready() const noexcept { return (!handle) || handle.done(); }
+
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<> consumer) const noexcept
+        {
+            handle.promise().consumer = consumer;
+            return handle;
+        }
+
+        /** @brief Returns the converted block, or an empty span at the end of the stream */
+        std::span<const double> await_resume() const
+        {
+            if (!handle)
+            {
+                return {};
+            }
+            if (handle.promise().error)
+            {
+                std::rethrow_exception(std::exchange(handle.promise().error, nullptr));
+            }
+            return handle.promise().block;
+        }
+    };
+
+    temperature_stream() noexcept = default;
+    explicit temperature_stream(handle_type handle) noexcept : handle_(handle) {}
+    temperature_stream(temperature_stream &&other) noexcept : handle_(std::exchange(other.handle_, {})) {}
+
+    temperature_stream &operator=(temperature_stream &&other) noexcept
+    {
+        if (this != &other)
+        {
+            reset();
+            handle_ = std::exchange(other.handle_, {});
+        }
+        return *this;
+    }
+
+    temperature_stream(const temperature_stream &) = delete;
+    temperature_stream &operator=(const temperature_stream &) = delete;
+
+    ~temperature_stream() { reset(); }
+
+    /**
+     * @brief Reads and converts the next block.
+     *
+     * @return Awaitable yielding the temperatures in degrees Celsius (failed samples hold
+     *         @c tc::conversion_failed), or an empty span once the source is exhausted.
+     */
+    next_awaiter next() const noexcept { return next_awaiter{handle_}; }
+
+private:
+    void reset() noexcept
+    {
+        if (handle_)
+        {
+            handle_.destroy();
+            handle_ = {};
+        }
+    }
+
+    handle_type handle_;
+};
+
+/**
+ * @brief In-memory source that completes every read immediately.
+ *
+ * @details
+ * Serves a span of voltages in reads of at most @c chunk samples; useful for tests and
+ * for replaying captured data through a coroutine pipeline.
+ */
+class memory_source
+{
+public:
+    /** @brief Awaitable returned by @c read(); never suspends */
+    struct read_awaiter
+    {
+        std::size_t count;
+
+        bool await_ready() const noexcept { return true; }
+        void await_suspend(std::coroutine_handle<>) const noexcept {}
+        std::size_t await_resume() const noexcept { return count; }
+    };
+
+    /**
+     * @param[in] samples  Voltages in millivolts (mV); must outlive the source.
+     * @param[in] chunk    Maximum number of samples returned per read.
+     */
+    explicit memory_source(std::span<const double> samples, std::size_t chunk = stream_block_size) noexcept
+        : samples_(samples), chunk_((chunk > 0U) ? chunk : 1U)
+    {
+    }
+
+    /** @brief Copies the next samples into @p buffer and returns how many were copied */
+    read_awaiter read(std::span<double> buffer) noexcept
+    {
+        const std::size_t count = std::min({buffer.size(), chunk_, samples_.size() - position_});
+        std::copy_n(samples_.begin() + static_cast<std::ptrdiff_t>(position_), count, buffer.begin());
+        position_ += count;
+        return read_awaiter{count};
+    }
+
+private:
+    std::span<const double> samples_;
+    std::size_t chunk_;
+    std::size_t position_ = 0U;
+};
+
+
+/* ------------------------------------- Interface ------------------------------------- */
+
+/**
+ * @brief  Streams temperatures converted from the voltages read from @p source.
+ *
+ * @param[in] source     Asynchronous source of voltages in millivolts (mV); must outlive the stream.
+ * @param[in] type       Thermocouple type.
+ * @param[in] mode       @c TC_MODE_FAST or @c TC_MODE_EXACT.
+ * @param[in] blockSize  Maximum number of samples per read and per yielded block.
+ *
+ * @return Lazy stream; nothing is read until the first @c next() is awaited. The block
+ *         buffer is allocated once with the coroutine and reused for every block.
+ */
+template <async_sample_source Source>
+temperature_stream stream_to_celsius(Source &source, Type type, ConversionMode mode = TC_MODE_FAST,
+                                     std::size_t blockSize = stream_block_size)
+{
+    std::vector<double> buffer((blockSize > 0U) ? blockSize : 1U);
+
+    for (;;)
+    {
+        const std::size_t count = std::min<std::size_t>(co_await source.read(std::span<double>(buffer)), buffer.size());
+        if (count == 0U)
+        {
+            break;
+        }
+        (void)TC_CalculateTemperatureArray(static_cast<ThermocoupleType>(type), buffer.data(), buffer.data(), count, mode);
+        co_yield std::span<const double>(buffer.data(), count);
+    }
+}
+
+} // namespace tc
+
+
+#endif /* thermocouple_stream.hpp */
@@ -0,0 +1,202 @@
+/**
+ * @file    thermocouple_views.hpp
+ * @author  Amirhossein Askari
+ * @version v1.0.0
+ * @date    2026-10-16
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   C++20 ranges view adaptor for lazy conversions.
+ *
+ * @details
+ * Provides @c tc::views::to_celsius, a lazy view over any input range of voltages that
+ * yields temperatures:
+ *
+ * @code
+ * for (double t : samples | std::views::filter(valid) | tc::views::to_celsius(tc::Type::N)) { ... }
+ * @endcode
+ *
+ * The view pulls @c TC_BATCH_BLOCK_SIZE samples at a time from the underlying range into
+ * a buffer it owns and converts them with @c TC_CalculateTemperatureArray, so it keeps
+ * the batch kernel without allocating intermediate containers.
+ *
+ * @note
+ * Like @c std::ranges::istream_view, the view is a single-pass input range whose iterators
+ * refer to the buffer in the view: call @c begin() once and do not move the view while
+ * iterating. Requires C++20 and linking @c thermocouple_sensor.c.
+ */
+
+
+#ifndef _THERMOCOUPLE_VIEWS_HPP
+#define _THERMOCOUPLE_VIEWS_HPP
+
+/* ------------------------------------- Includes ------------------------------------- */
+
+#include <concepts>                   ///< std::convertible_to
+#include <cstddef>                    ///< std::size_t, std::ptrdiff_t
+#include <iterator>                   ///< std::default_sentinel_t
+#include <optional>                   ///< Position in the underlying range
+#include <ranges>                     ///< View machinery
+#include <utility>                    ///< std::move
+#include "thermocouple_sensor.hpp"    ///< tc::Type
+
+
+namespace tc
+{
+
+/* --------------------------------------- Types -------------------------------------- */
+
+/**
+ * @brief Lazy view converting a range of voltages (mV) to temperatures (°C) in blocks.
+ *
+ * @tparam V  Underlying view; its elements must be convertible to @c double.
+ */
+template <std::ranges::input_range V>
+    requires std::ranges::view<V> && std::convertible_to<std::ranges::range_reference_t<V>, double>
+class to_celsius_view : public std::ranges::view_interface<to_celsius_view<V>>
+{
+public:
+    /** @brief Input iterator over the converted samples */
+    class iterator
+    {
+    public:
+        using iterator_concept = std::input_iterator_tag;
+        using value_type       = double;
+        using difference_type  = std::ptrdiff_t;
+
+        iterator() = default;
+        explicit iterator(to_celsius_view *pParent) noexcept : pParent_(pParent) {}
+
+        /** @brief Returns the current temperature in degrees Celsius, or @c tc::conversion_failed */
+        double operator*() const noexcept { return pParent_->buffer_[pParent_->position_]; }
+
+        iterator &operator++()
+        {
+            pParent_->advance();
+            return *this;
+        }
+
+        void operator++(int) { ++*this; }
+
+        friend bool operator==(const iterator &it, std::default_sentinel_t) noexcept { return it.at_end(); }
+
+    private:
+        bool at_end() const noexcept { return pParent_->position_ == pParent_->size_; }
+
+        to_celsius_view *pParent_ = nullptr;
+    };
+
+    to_celsius_view() requires std::default_initializable<V> = default;
+
+    /**
+     * @brief Creates the view.
+     *
+     * @param[in] base  Range of voltages in millivolts (mV).
+     * @param[in] type  Thermocouple type.
+     * @param[in] mode  @c TC_MODE_FAST or @c TC_MODE_EXACT.
+     */
+    to_celsius_view(V base, Type type, ConversionMode mode = TC_MODE_FAST)
+        : base_(std::move(base)), type_(type), mode_(mode)
+    {
+    }
+
+    /** @brief Converts the first block and returns an iterator to its first sample */
+    iterator begin()
+    {
+        current_.emplace(std::ranges::begin(base_));
+        fill();
+        return iterator{this};
+    }
+
+    std::default_sentinel_t end() const noexcept { return std::default_sentinel; }
+
+    /** @brief Returns the underlying view */
+    V base() const & requires std::copy_constructible<V> { return base_; }
+    V base() && { return std::move(base_); }
+
+private:
+    /** @brief Pulls up to one block from the underlying range and converts it in place */
+    void fill()
+    {
+        size_     = 0U;
+        position_ = 0U;
+        while ((size_ < TC_BATCH_BLOCK_SIZE) && (*current_ != std::ranges::end(base_)))
+        {
+            buffer_[size_] = static_cast<double>(**current_);
+            ++size_;
+            ++*current_;
+        }
+        if (size_ > 0U)
+        {
+            (void)TC_CalculateTemperatureArray(static_cast<ThermocoupleType>(type_), buffer_, buffer_, size_, mode_);
+        }
+    }
+
+    /** @brief Moves to the next sample, refilling the buffer when it is exhausted */
+    void advance()
+    {
+        ++position_;
+        if (position_ == size_)
+        {
+            fill();
+        }
+    }
+
+    V base_ = V();
+    Type type_ = Type::K;
+    ConversionMode mode_ = TC_MODE_FAST;
+    std::optional<std::ranges::iterator_t<V>> current_;
+    double buffer_[TC_BATCH_BLOCK_SIZE] = {};
+    std::size_t size_ = 0U;
+    std::size_t position_ = 0U;
+};
+
+template <class R>
+to_celsius_view(R &&, Type, ConversionMode = TC_MODE_FAST) -> to_celsius_view<std::views::all_t<R>>;
+
+
+namespace views
+{
+
+/** @brief Range adaptor closure produced by @c tc::views::to_celsius(type) */
+struct to_celsius_closure
+{
+    Type type;              /**< Thermocouple type */
+    ConversionMode mode;    /**< Conversion mode */
+
+    template <std::ranges::viewable_range R>
+    friend auto operator|(R &&range, const to_celsius_closure &closure)
+    {
+        return to_celsius_view(std::views::all(std::forward<R>(range)), closure.type, closure.mode);
+    }
+};
+
+/**
+ * @brief Returns an adaptor converting a range of voltages (mV) to temperatures (°C).
+ *
+ * @param[in] type  Thermocouple type.
+ * @param[in] mode  @c TC_MODE_FAST or @c TC_MODE_EXACT.
+ */
+constexpr to_celsius_closure to_celsius(Type type, ConversionMode mode = TC_MODE_FAST) noexcept
+{
+    return to_celsius_closure{type, mode};
+}
+
+/**
+ * @brief Returns a view converting @p range of voltages (mV) to temperatures (°C).
+ *
+ * @param[in] range  Range of voltages in millivolts (mV).
+ * @param[in] type   Thermocouple type.
+ * @param[in] mode   @c TC_MODE_FAST or @c TC_MODE_EXACT.
+ */
+template <std::ranges::viewable_range R>
+auto to_celsius(R &&range, Type type, ConversionMode mode = TC_MODE_FAST)
+{
+    return to_celsius_view(std::views::all(std::forward<R>(range)), type, mode);
+}
+
+} // namespace views
+
+} // namespace tc
+
+
+#endif /* thermocouple_views.hpp */
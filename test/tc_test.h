@@ -0,0 +1,103 @@
+/**
+ * @file    tc_test.h
+ * @author  Amirhossein Askari
+ * @version v1.0.0
+ * @date    2026-10-16
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Minimal helpers shared by the test programs.
+ *
+ * @details
+ * Every test program is a plain executable that exits with 0 when all of its checks
+ * pass. @ref TEST_CHECK counts and reports failures, and a fixed-seed xorshift generator
+ * keeps every run reproducible.
+ */
+
+
+#ifndef _TC_TEST_H
+#define _TC_TEST_H
+
+/* ------------------------------------- Includes ------------------------------------- */
+
+#include <stdint.h>                 ///< uint64_t
+#include <stdio.h>                  ///< fprintf
+#include <string.h>                 ///< memcmp
+#include "thermocouple_sensor.h"    ///< Thermocouple types
+
+
+/* -------------------------------------- Defines ------------------------------------- */
+
+/** @brief Records a failed check with its location; the test carries on */
+#define  TEST_CHECK(condition)      Test_Check((condition) ? 1U : 0U, #condition, __FILE__, __LINE__)
+
+/** @brief Nonzero if two doubles have the same bit pattern */
+#define  TEST_SAME(a, b)            Test_Same((a), (b))
+
+#define  TEST_MAX_REPORTS           20U    ///< Failures printed before the rest are only counted
+
+
+/* ------------------------------------- Variables ------------------------------------- */
+
+static unsigned long testChecks   = 0UL;    ///< Checks run
+static unsigned long testFailures = 0UL;    ///< Checks failed
+static uint64_t testState         = 0x9E3779B97F4A7C15U;    ///< xorshift64* state
+
+
+/* ------------------------------------- Functions ------------------------------------- */
+
+/** @brief Counts a check and prints the first failures */
+static inline void Test_Check(uint8_t passed, const char *pWhat, const char *pFile, int line)
+{
+    testChecks++;
+    if (passed == 0U)
+    {
+        testFailures++;
+        if (testFailures <= TEST_MAX_REPORTS)
+        {
+            (void)fprintf(stderr, "%s:%d: check failed: %s\n", pFile, line, pWhat);
+        }
+    }
+}
+
+/** @brief Nonzero if @p a and @p b are bit-identical */
+static inline uint8_t Test_Same(double a, double b)
+{
+    return (memcmp(&a, &b, sizeof(double)) == 0) ? 1U : 0U;
+}
+
+/** @brief Next pseudo-random 64-bit value */
+static inline uint64_t Test_Next(void)
+{
+    testState ^= testState >> 12;
+    testState ^= testState << 25;
+    testState ^= testState >> 27;
+    return testState * 0x2545F4914F6CDD1DU;
+}
+
+/** @brief Pseudo-random double in [@p low, @p high) */
+static inline double Test_Uniform(double low, double high)
+{
+    return low + ((high - low) * ((double)(Test_Next() >> 11) * 0x1.0p-53));
+}
+
+/** @brief Pseudo-random index in [0, @p count) */
+static inline size_t Test_Index(size_t count)
+{
+    return (size_t)(Test_Next() % (uint64_t)count);
+}
+
+/**
+ * @brief  Prints the summary line of a test program.
+ *
+ * @param[in] pName  Program name.
+ *
+ * @return Exit status: 0 if every check passed, otherwise 1.
+ */
+static inline int Test_Finish(const char *pName)
+{
+    (void)printf("%s: %lu checks, %lu failed\n", pName, testChecks, testFailures);
+    return (testFailures == 0UL) ? 0 : 1;
+}
+
+
+#endif /* tc_test.h */
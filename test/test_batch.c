@@ -0,0 +1,402 @@
+/**
+ * @file    test_batch.c
+ * @author  Amirhossein Askari
+ * @version v1.0.0
+ * @date    2026-10-16
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Checks the batch conversions against the scalar functions.
+ *
+ * @details
+ * Every batch entry point documents results bit-identical to @c TC_CalculateTemperature
+ * (or @c TC_CalculateTemperatureExact in @c TC_MODE_EXACT). Each one is compared sample
+ * by sample with the scalar oracle over random voltages, voltages on both sides of every
+ * segment join and out-of-range voltages, for every type and mode: plain, in-place and
+ * streamed arrays, derivatives, strided channels, ADC codes, mixed-type frames and the
+ * quantized outputs.
+ */
+
+
+/* ------------------------------------- Includes -------------------------------------- */
+
+#include <math.h>                    ///< floor, ceil, round, trunc, nextafter
+#include <stdlib.h>                  ///< malloc
+#include "thermocouple_frame.h"      ///< Frame conversions
+#include "tc_test.h"                 ///< Checks and random numbers
+
+
+
+/* -------------------------------------- Defines -------------------------------------- */
+
+#define  BATCH_COUNT         4099U     ///< Samples per array check; not a multiple of the block
+#define  BATCH_FRAMES        1000U     ///< Frames per frame check
+#define  BATCH_CHANNELS      7U        ///< Channels per frame
+#define  BATCH_FRAME_STRIDE  9U        ///< Doubles between input frames
+
+
+
+/* ------------------------------------- Variables ------------------------------------- */
+
+static double voltage[BATCH_COUNT];
+static double output[BATCH_COUNT];
+static double expected[BATCH_COUNT];
+
+
+
+/* ------------------------------------- Functions ------------------------------------- */
+
+/**
+ * @brief  Fills voltages that exercise every segment of a type and the range limits.
+ *
+ * @param[in]  type      Thermocouple type.
+ * @param[out] pVoltage  Receives @p count voltages in mV.
+ * @param[in]  count     Number of voltages.
+ */
+static void Batch_Fill(ThermocoupleType type, double *pVoltage, size_t count)
+{
+    double join[TC_MAX_INVERSE_JOINS];
+    const size_t joins = TC_GetInverseJoins(type, join);
+    size_t i;
+
+    for (i = 0U; i < count; ++i)
+    {
+        const size_t pick = Test_Index(8U);
+
+        if ((pick == 0U) && (joins != 0U))
+        {
+            const double at = join[Test_Index(joins)];
+            const size_t side = Test_Index(3U);
+            pVoltage[i] = (side == 0U) ? at : nextafter(at, (side == 1U) ? -HUGE_VAL : HUGE_VAL);
+        }
+        else if (pick == 1U)
+        {
+            pVoltage[i] = Test_Uniform(-15.0, 90.0);
+        }
+        else
+        {
+            pVoltage[i] = Test_Uniform(-10.0, 77.0);
+        }
+    }
+}
+
+/** @brief Scalar oracle of one mode */
+static double Batch_Scalar(ThermocoupleType type, double millivolts, ConversionMode mode)
+{
+    return (mode == TC_MODE_EXACT) ? TC_CalculateTemperatureExact(type, millivolts)
+                                   : TC_CalculateTemperature(type, millivolts);
+}
+
+/** @brief Fills @c expected from @c voltage and counts the failures */
+static size_t Batch_Expect(ThermocoupleType type, size_t count, ConversionMode mode)
+{
+    size_t failed = 0U;
+    size_t i;
+
+    for (i = 0U; i < count; ++i)
+    {
+        expected[i] = Batch_Scalar(type, voltage[i], mode);
+        failed += (expected[i] == TC_CONVERSION_FAILED) ? 1U : 0U;
+    }
+
+    return failed;
+}
+
+/** @brief Nonzero if @p count outputs equal @c expected bit for bit */
+static uint8_t Batch_Same(const double *pOutput, size_t count)
+{
+    return (memcmp(pOutput, expected, count * sizeof(double)) == 0) ? 1U : 0U;
+}
+
+/** @brief Arrays of every length up to two blocks, then a long one, out of place and in place */
+static void Batch_TestArray(ThermocoupleType type, ConversionMode mode)
+{
+    size_t failed;
+    size_t count;
+
+    for (count = 0U; count <= (2U * TC_BATCH_BLOCK_SIZE) + 1U; ++count)
+    {
+        Batch_Fill(type, voltage, count);
+        failed = Batch_Expect(type, count, mode);
+        TEST_CHECK(TC_CalculateTemperatureArray(type, voltage, output, count, mode) == failed);
+        TEST_CHECK(Batch_Same(output, count) != 0U);
+    }
+
+    Batch_Fill(type, voltage, BATCH_COUNT);
+    failed = Batch_Expect(type, BATCH_COUNT, mode);
+    TEST_CHECK(TC_CalculateTemperatureArray(type, voltage, output, BATCH_COUNT, mode) == failed);
+    TEST_CHECK(Batch_Same(output, BATCH_COUNT) != 0U);
+    TEST_CHECK(TC_CalculateTemperatureArray(type, voltage, voltage, BATCH_COUNT, mode) == failed);
+    TEST_CHECK(Batch_Same(voltage, BATCH_COUNT) != 0U);
+}
+
+/** @brief An array past @c TC_STREAM_THRESHOLD, written with non-temporal stores where supported */
+static void Batch_TestStreamed(ThermocoupleType type)
+{
+    const size_t count = TC_STREAM_THRESHOLD + 37U;
+    double *pVoltage   = (double *)malloc(count * sizeof(double));
+    double *pOutput    = (double *)malloc((count + 1U) * sizeof(double));
+    size_t failed      = 0U;
+    size_t same        = 1U;
+    size_t i;
+
+    TEST_CHECK((pVoltage != NULL) && (pOutput != NULL));
+    if ((pVoltage != NULL) && (pOutput != NULL))
+    {
+        Batch_Fill(type, pVoltage, count);
+        for (i = 0U; i < count; ++i)
+        {
+            failed += (TC_CalculateTemperature(type, pVoltage[i]) == TC_CONVERSION_FAILED) ? 1U : 0U;
+        }
+
+        /* Misaligned by one element, so the store path has a head to align */
+        TEST_CHECK(TC_CalculateTemperatureArray(type, pVoltage, &pOutput[1], count, TC_MODE_FAST) == failed);
+        for (i = 0U; i < count; ++i)
+        {
+            same &= Test_Same(pOutput[i + 1U], TC_CalculateTemperature(type, pVoltage[i]));
+        }
+        TEST_CHECK(same != 0U);
+    }
+
+    free(pOutput);
+    free(pVoltage);
+}
+
+/** @brief Derivative arrays against the scalar derivative functions */
+static void Batch_TestDerivative(ThermocoupleType type)
+{
+    static double slope[BATCH_COUNT];
+    static double celsius[BATCH_COUNT];
+    double scalarSlope;
+    size_t same = 1U;
+    size_t i;
+
+    Batch_Fill(type, voltage, BATCH_COUNT);
+    (void)TC_CalculateTemperatureDerivativeArray(type, voltage, output, slope, BATCH_COUNT);
+    for (i = 0U; i < BATCH_COUNT; ++i)
+    {
+        same &= Test_Same(output[i], TC_CalculateTemperatureDerivative(type, voltage[i], &scalarSlope));
+        same &= Test_Same(slope[i], scalarSlope);
+    }
+    TEST_CHECK(same != 0U);
+
+    for (i = 0U; i < BATCH_COUNT; ++i)
+    {
+        celsius[i] = Test_Uniform(-300.0, 1900.0);
+    }
+    (void)TC_CalculateVoltageDerivativeArray(type, celsius, output, slope, BATCH_COUNT);
+    for (i = 0U; i < BATCH_COUNT; ++i)
+    {
+        same &= Test_Same(output[i], TC_CalculateVoltageDerivative(type, celsius[i], &scalarSlope));
+        same &= Test_Same(slope[i], scalarSlope);
+    }
+    TEST_CHECK(same != 0U);
+}
+
+/** @brief One field of three-double records into every other output element, then in place */
+static void Batch_TestStrided(ThermocoupleType type, ConversionMode mode)
+{
+    static double records[3U * BATCH_COUNT];
+    static double spread[2U * BATCH_COUNT];
+    size_t failed;
+    size_t same = 1U;
+    size_t i;
+
+    Batch_Fill(type, voltage, BATCH_COUNT);
+    failed = Batch_Expect(type, BATCH_COUNT, mode);
+    for (i = 0U; i < BATCH_COUNT; ++i)
+    {
+        records[(3U * i) + 1U] = voltage[i];
+    }
+
+    TEST_CHECK(TC_CalculateTemperatureStrided(type, &records[1], 3U * sizeof(double), spread, 2U * sizeof(double),
+                                              BATCH_COUNT, mode) == failed);
+    for (i = 0U; i < BATCH_COUNT; ++i)
+    {
+        same &= Test_Same(spread[2U * i], expected[i]);
+    }
+    TEST_CHECK(same != 0U);
+
+    TEST_CHECK(TC_CalculateTemperatureStrided(type, &records[1], 3U * sizeof(double), &records[1],
+                                              3U * sizeof(double), BATCH_COUNT, mode) == failed);
+    for (i = 0U; i < BATCH_COUNT; ++i)
+    {
+        same &= Test_Same(records[(3U * i) + 1U], expected[i]);
+    }
+    TEST_CHECK(same != 0U);
+}
+
+/** @brief ADC codes against the scalar conversion of the scaled voltage */
+static void Batch_TestAdc(ThermocoupleType type, ConversionMode mode)
+{
+    static int16_t raw16[BATCH_COUNT];
+    static int32_t raw32[BATCH_COUNT];
+    const AdcScaling scaling16 = { 0.0025, 0.0125, 23.5 };
+    const AdcScaling scaling32 = { 1.0e-5 / 256.0, -0.003, 21.0 };
+    const double bias16 = TC_CalculateVoltage(type, scaling16.coldJunction) + scaling16.offset;
+    const double bias32 = TC_CalculateVoltage(type, scaling32.coldJunction) + scaling32.offset;
+    const AdcScaling cold = { 0.001, 0.0, 5000.0 };
+    size_t same = 1U;
+    size_t i;
+
+    for (i = 0U; i < BATCH_COUNT; ++i)
+    {
+        raw16[i] = (int16_t)(int32_t)(Test_Next() & 0xFFFFU);
+        raw32[i] = (int32_t)(uint32_t)Test_Next();
+    }
+
+    (void)TC_CalculateTemperatureInt16(type, raw16, output, BATCH_COUNT, &scaling16, mode);
+    for (i = 0U; i < BATCH_COUNT; ++i)
+    {
+        same &= Test_Same(output[i], Batch_Scalar(type, ((double)raw16[i] * scaling16.gain) + bias16, mode));
+    }
+    TEST_CHECK(same != 0U);
+
+    (void)TC_CalculateTemperatureInt32(type, raw32, output, BATCH_COUNT, &scaling32, mode);
+    for (i = 0U; i < BATCH_COUNT; ++i)
+    {
+        same &= Test_Same(output[i], Batch_Scalar(type, ((double)raw32[i] * scaling32.gain) + bias32, mode));
+    }
+    TEST_CHECK(same != 0U);
+
+    /* An out-of-range cold junction fails every sample */
+    TEST_CHECK(TC_CalculateTemperatureInt16(type, raw16, output, BATCH_COUNT, &cold, mode) == BATCH_COUNT);
+}
+
+/** @brief Rounds and saturates one temperature as the quantized outputs document */
+static double Batch_Quantize(double celsius, double scale, double limit, RoundingMode rounding)
+{
+    double value;
+
+    switch (rounding)
+    {
+        case TC_ROUND_FLOOR:
+            value = floor(celsius * scale);
+        break;
+
+        case TC_ROUND_CEIL:
+            value = ceil(celsius * scale);
+        break;
+
+        case TC_ROUND_TRUNCATE:
+            value = trunc(celsius * scale);
+        break;
+
+        default:
+            value = round(celsius * scale);
+    }
+
+    return (value > limit) ? limit : ((value < -limit) ? -limit : value);
+}
+
+/** @brief Deci-°C and milli-°C outputs for every rounding mode, out of place and in place */
+static void Batch_TestQuantized(ThermocoupleType type, ConversionMode mode)
+{
+    static int16_t deci[BATCH_COUNT];
+    static int32_t milli[BATCH_COUNT];
+    RoundingMode rounding;
+    size_t failed;
+    size_t same = 1U;
+    size_t i;
+
+    for (rounding = TC_ROUND_NEAREST; rounding <= TC_ROUND_TRUNCATE; rounding = (RoundingMode)(rounding + 1U))
+    {
+        Batch_Fill(type, voltage, BATCH_COUNT);
+        failed = Batch_Expect(type, BATCH_COUNT, mode);
+
+        TEST_CHECK(TC_CalculateTemperatureDeci16(type, voltage, deci, BATCH_COUNT, mode, rounding) == failed);
+        TEST_CHECK(TC_CalculateTemperatureMilli32(type, voltage, milli, BATCH_COUNT, mode, rounding) == failed);
+        for (i = 0U; i < BATCH_COUNT; ++i)
+        {
+            const uint8_t bad = (expected[i] == TC_CONVERSION_FAILED) ? 1U : 0U;
+            const int16_t d = (bad != 0U) ? (int16_t)TC_DECI_FAILED
+                                          : (int16_t)Batch_Quantize(expected[i], 10.0, (double)INT16_MAX, rounding);
+            const int32_t m = (bad != 0U) ? (int32_t)TC_MILLI_FAILED
+                                          : (int32_t)Batch_Quantize(expected[i], 1000.0, (double)INT32_MAX, rounding);
+
+            same &= ((deci[i] == d) && (milli[i] == m)) ? 1U : 0U;
+        }
+        TEST_CHECK(same != 0U);
+
+        /* In place: the narrower output starts at the input address */
+        (void)memcpy(output, voltage, sizeof(voltage));
+        (void)TC_CalculateTemperatureMilli32(type, output, (int32_t *)(void *)output, BATCH_COUNT, mode, rounding);
+        TEST_CHECK(memcmp(output, milli, sizeof(milli)) == 0);
+        (void)memcpy(output, voltage, sizeof(voltage));
+        (void)TC_CalculateTemperatureDeci16(type, output, (int16_t *)(void *)output, BATCH_COUNT, mode, rounding);
+        TEST_CHECK(memcmp(output, deci, sizeof(deci)) == 0);
+    }
+}
+
+/** @brief Mixed-type frames through both frame entry points, with padded and aliased buffers */
+static void Batch_TestFrames(ConversionMode mode)
+{
+    static const ThermocoupleType types[BATCH_CHANNELS] = { TC_TYPE_K, TC_TYPE_J, TC_TYPE_K, TC_TYPE_T,
+                                                            TC_TYPE_N, TC_TYPE_B, TC_TYPE_J };
+    static double frames[BATCH_FRAMES * BATCH_FRAME_STRIDE];
+    static double result[BATCH_FRAMES * BATCH_CHANNELS];
+    static double scalar[BATCH_FRAMES * BATCH_CHANNELS];
+    FrameConverter converter;
+    size_t failed = 0U;
+    size_t f;
+    size_t c;
+
+    for (f = 0U; f < BATCH_FRAMES; ++f)
+    {
+        for (c = 0U; c < BATCH_CHANNELS; ++c)
+        {
+            Batch_Fill(types[c], &frames[(f * BATCH_FRAME_STRIDE) + c], 1U);
+            scalar[(f * BATCH_CHANNELS) + c] = Batch_Scalar(types[c], frames[(f * BATCH_FRAME_STRIDE) + c], mode);
+            failed += (scalar[(f * BATCH_CHANNELS) + c] == TC_CONVERSION_FAILED) ? 1U : 0U;
+        }
+    }
+
+    TEST_CHECK(TC_CalculateTemperatureFrames(types, BATCH_CHANNELS, frames, BATCH_FRAME_STRIDE * sizeof(double),
+                                             result, BATCH_CHANNELS * sizeof(double), BATCH_FRAMES, mode) == failed);
+    TEST_CHECK(memcmp(result, scalar, sizeof(scalar)) == 0);
+
+    (void)memset(result, 0, sizeof(result));
+    TEST_CHECK(TC_FrameConverter_Init(&converter, types, BATCH_CHANNELS, mode) != 0U);
+    TEST_CHECK(TC_FrameConverter_Convert(&converter, frames, BATCH_FRAME_STRIDE * sizeof(double), result,
+                                         BATCH_CHANNELS * sizeof(double), BATCH_FRAMES) == failed);
+    TEST_CHECK(memcmp(result, scalar, sizeof(scalar)) == 0);
+
+    TEST_CHECK(TC_FrameConverter_Convert(&converter, frames, BATCH_FRAME_STRIDE * sizeof(double), frames,
+                                         BATCH_FRAME_STRIDE * sizeof(double), BATCH_FRAMES) == failed);
+    for (f = 0U; f < BATCH_FRAMES; ++f)
+    {
+        TEST_CHECK(memcmp(&frames[f * BATCH_FRAME_STRIDE], &scalar[f * BATCH_CHANNELS],
+                          BATCH_CHANNELS * sizeof(double)) == 0);
+    }
+}
+
+int main(void)
+{
+    ThermocoupleType type;
+    ConversionMode mode;
+
+    for (type = TC_TYPE_R; type <= TC_TYPE_N; type = (ThermocoupleType)(type + 1U))
+    {
+        for (mode = TC_MODE_FAST; mode <= TC_MODE_EXACT; mode = (ConversionMode)(mode + 1U))
+        {
+            Batch_TestArray(type, mode);
+            Batch_TestStrided(type, mode);
+            Batch_TestAdc(type, mode);
+            Batch_TestQuantized(type, mode);
+        }
+        Batch_TestDerivative(type);
+        Batch_TestStreamed(type);
+    }
+
+    Batch_TestFrames(TC_MODE_FAST);
+    Batch_TestFrames(TC_MODE_EXACT);
+
+    /* Invalid type fails everything */
+    Batch_Fill(TC_TYPE_K, voltage, BATCH_COUNT);
+    TEST_CHECK(TC_CalculateTemperatureArray((ThermocoupleType)8, voltage, output, BATCH_COUNT, TC_MODE_FAST) ==
+               BATCH_COUNT);
+
+    return Test_Finish("test_batch");
+}
+
+
+/* test_batch.c */
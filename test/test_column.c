@@ -0,0 +1,313 @@
+/**
+ * @file    test_column.c
+ * @author  Amirhossein Askari
+ * @version v1.0.0
+ * @date    2026-10-16
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Checks the columnar format: round trip, range queries and damaged files.
+ *
+ * @details
+ * A multi-channel recording is written, read back column by column and queried; every
+ * query must return exactly the rows of a full scan with @c TC_CalculateTemperature.
+ * Then copies of the file with random bytes overwritten (mostly in the file and block
+ * headers) or cut short are opened. A damaged file must either be rejected or be fully
+ * readable within its mapping; build with @c -fsanitize=address to catch stray reads.
+ */
+
+
+/* ------------------------------------- Includes -------------------------------------- */
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE                  ///< mkstemp
+#endif
+#include <stdlib.h>                  ///< mkstemp, malloc
+#include <unistd.h>                  ///< close, unlink
+#include "thermocouple_column.h"     ///< Columnar files
+#include "tc_test.h"                 ///< Checks and random numbers
+
+
+
+/* -------------------------------------- Defines -------------------------------------- */
+
+#define  COLUMN_CHANNELS   3U        ///< Channels in the recording
+#define  COLUMN_ROWS       10000U    ///< Rows in the recording
+#define  COLUMN_BLOCK      256U      ///< Rows per block; the last block is partial
+#define  COLUMN_QUERIES    100U      ///< Range queries per channel
+#define  COLUMN_DAMAGED    3000U     ///< Damaged copies opened
+
+
+
+/* --------------------------------------- Types --------------------------------------- */
+
+/** @brief State of one query */
+typedef struct
+{
+    const double *pTemperature;    /**< Scan result of every row of the channel */
+    uint64_t nextRow;              /**< Rows must arrive in increasing order */
+    size_t matches;                /**< Callbacks received */
+    size_t wrong;                  /**< Callbacks out of order or with another temperature */
+} ColumnQuery;
+
+
+
+/* ------------------------------------- Variables ------------------------------------- */
+
+static const ThermocoupleType types[COLUMN_CHANNELS] = { TC_TYPE_K, TC_TYPE_J, TC_TYPE_B };
+static double frames[COLUMN_ROWS * COLUMN_CHANNELS];
+static double temperature[COLUMN_CHANNELS][COLUMN_ROWS];
+
+
+
+/* ------------------------------------- Functions ------------------------------------- */
+
+/** @brief Records one matching sample reported by the reader */
+static void Column_Match(void *pContext, uint64_t row, double celsius)
+{
+    ColumnQuery *pQuery = (ColumnQuery *)pContext;
+
+    pQuery->matches++;
+    if ((row < pQuery->nextRow) || (row >= COLUMN_ROWS) || (Test_Same(celsius, pQuery->pTemperature[row]) == 0U))
+    {
+        pQuery->wrong++;
+    }
+    pQuery->nextRow = row + 1U;
+}
+
+/** @brief Writes the recording to @p pPath */
+static uint8_t Column_Write(const char *pPath)
+{
+    ColumnWriter writer;
+    uint8_t ok = TC_ColumnWriter_Open(&writer, pPath, COLUMN_CHANNELS, types, COLUMN_BLOCK);
+    size_t appended;
+    size_t part;
+
+    /* Uneven appends cross the block boundaries at every offset */
+    for (appended = 0U; (ok != 0U) && (appended < COLUMN_ROWS); appended += part)
+    {
+        part = 1U + Test_Index(700U);
+        part = ((COLUMN_ROWS - appended) < part) ? (COLUMN_ROWS - appended) : part;
+        ok   = TC_ColumnWriter_Append(&writer, &frames[appended * COLUMN_CHANNELS], part);
+    }
+
+    return ((TC_ColumnWriter_Close(&writer) != 0U) && (ok != 0U)) ? 1U : 0U;
+}
+
+/** @brief Reads every column back and checks the statistics and queries */
+static void Column_TestRead(const char *pPath)
+{
+    ColumnReader reader;
+    size_t c;
+    size_t b;
+    size_t q;
+    size_t i;
+
+    TEST_CHECK(TC_ColumnReader_Open(&reader, pPath) != 0U);
+    TEST_CHECK(reader.blockCount == ((COLUMN_ROWS + COLUMN_BLOCK - 1U) / COLUMN_BLOCK));
+
+    for (c = 0U; c < COLUMN_CHANNELS; ++c)
+    {
+        size_t same = 1U;
+
+        for (b = 0U; b < reader.blockCount; ++b)
+        {
+            uint64_t first;
+            size_t rows;
+            size_t columnRows;
+            const ColumnStats *pStats = TC_ColumnReader_Stats(&reader, b, c, &first, &rows);
+            const double *pColumn     = TC_ColumnReader_Voltages(&reader, b, c, &columnRows);
+
+            TEST_CHECK((first == (b * COLUMN_BLOCK)) && (rows == columnRows) && ((first + rows) <= COLUMN_ROWS));
+            for (i = 0U; i < rows; ++i)
+            {
+                const double t = temperature[c][first + i];
+
+                same &= Test_Same(pColumn[i], frames[((first + i) * COLUMN_CHANNELS) + c]);
+                same &= ((pColumn[i] >= pStats->minVoltage) && (pColumn[i] <= pStats->maxVoltage)) ? 1U : 0U;
+                same &= ((t == TC_CONVERSION_FAILED) ||
+                         ((t >= pStats->minTemperature) && (t <= pStats->maxTemperature))) ? 1U : 0U;
+            }
+        }
+        TEST_CHECK(same != 0U);
+
+        for (q = 0U; q < COLUMN_QUERIES; ++q)
+        {
+            const double low  = Test_Uniform(-300.0, 1900.0);
+            const double high = low + Test_Uniform(0.0, ((q % 4U) == 0U) ? 2.0 : 500.0);
+            ColumnQuery query = { temperature[c], 0U, 0U, 0U };
+            size_t expected   = 0U;
+            size_t found;
+
+            for (i = 0U; i < COLUMN_ROWS; ++i)
+            {
+                const double t = temperature[c][i];
+                expected += ((t != TC_CONVERSION_FAILED) && (t >= low) && (t <= high)) ? 1U : 0U;
+            }
+
+            found = TC_ColumnReader_Query(&reader, c, low, high, Column_Match, &query, NULL);
+            TEST_CHECK(found == expected);
+            TEST_CHECK((query.matches == found) && (query.wrong == 0U));
+        }
+    }
+
+    TC_ColumnReader_Close(&reader);
+}
+
+/**
+ * @brief  Opens damaged copies of a valid file.
+ *
+ * @details
+ * An accepted copy is walked completely: every block's statistics and columns are read
+ * and every column is queried, which would overrun the mapping or the reader's scratch
+ * if a stored row count were trusted beyond the file header.
+ */
+static void Column_TestDamaged(const uint8_t *pFile, size_t size, const char *pPath)
+{
+    uint8_t *pCopy = (uint8_t *)malloc(size);
+    size_t accepted = 0U;
+    size_t n;
+
+    TEST_CHECK(pCopy != NULL);
+    for (n = 0U; (pCopy != NULL) && (n < COLUMN_DAMAGED); ++n)
+    {
+        const size_t blockBytes = sizeof(ColumnBlockHeader) +
+                                  (COLUMN_CHANNELS * (sizeof(ColumnStats) + (COLUMN_BLOCK * sizeof(double))));
+        size_t length = size;
+        size_t edits  = 1U + Test_Index(4U);
+        ColumnReader reader;
+        FILE *pOut;
+
+        (void)memcpy(pCopy, pFile, size);
+        while (edits-- != 0U)
+        {
+            const size_t pick = Test_Index(4U);
+            size_t at;
+
+            if (pick == 0U)
+            {
+                at = Test_Index(sizeof(ColumnFileHeader));
+            }
+            else if (pick == 1U)
+            {
+                at = sizeof(ColumnFileHeader) + (Test_Index(size / blockBytes) * blockBytes) +
+                     Test_Index(sizeof(ColumnBlockHeader));
+            }
+            else if (pick == 2U)
+            {
+                at = Test_Index(size);
+            }
+            else
+            {
+                at     = size;
+                length = Test_Index(size);
+            }
+            if (at < length)
+            {
+                pCopy[at] = (uint8_t)Test_Next();
+            }
+        }
+
+        pOut = fopen(pPath, "wb");
+        TEST_CHECK((pOut != NULL) && (fwrite(pCopy, 1U, length, pOut) == length));
+        if (pOut != NULL)
+        {
+            (void)fclose(pOut);
+        }
+
+        if (TC_ColumnReader_Open(&reader, pPath) != 0U)
+        {
+            const size_t channels = reader.pHeader->channelCount;
+            const size_t capacity = reader.pHeader->blockRows;
+            uint64_t total = 0U;
+            volatile double sink = 0.0;
+            size_t b;
+            size_t c;
+            size_t i;
+
+            accepted++;
+            for (b = 0U; b < reader.blockCount; ++b)
+            {
+                for (c = 0U; c < channels; ++c)
+                {
+                    size_t rows;
+                    const ColumnStats *pStats = TC_ColumnReader_Stats(&reader, b, c, NULL, NULL);
+                    const double *pColumn     = TC_ColumnReader_Voltages(&reader, b, c, &rows);
+
+                    TEST_CHECK(rows <= capacity);
+                    sink += pStats->minVoltage;
+                    for (i = 0U; i < rows; ++i)
+                    {
+                        sink += pColumn[i];
+                    }
+                    total += (c == 0U) ? rows : 0U;
+                }
+            }
+            TEST_CHECK(total == reader.pHeader->rowCount);
+
+            for (c = 0U; c < channels; ++c)
+            {
+                (void)TC_ColumnReader_Query(&reader, c, -1.0e9, 1.0e9, NULL, NULL, NULL);
+            }
+            TC_ColumnReader_Close(&reader);
+        }
+    }
+
+    /* Most edits land in the samples or statistics, which the reader cannot validate */
+    TEST_CHECK(accepted != 0U);
+    free(pCopy);
+}
+
+int main(void)
+{
+    char path[] = "/tmp/tc_test_column_XXXXXX";
+    const int fd = mkstemp(path);
+    uint8_t *pFile = NULL;
+    size_t size    = 0U;
+    FILE *pIn;
+    size_t c;
+    size_t i;
+
+    TEST_CHECK(fd >= 0);
+    if (fd >= 0)
+    {
+        (void)close(fd);
+
+        for (i = 0U; i < COLUMN_ROWS; ++i)
+        {
+            for (c = 0U; c < COLUMN_CHANNELS; ++c)
+            {
+                frames[(i * COLUMN_CHANNELS) + c] = Test_Uniform(-12.0, 80.0);
+                temperature[c][i] = TC_CalculateTemperature(types[c], frames[(i * COLUMN_CHANNELS) + c]);
+            }
+        }
+
+        TEST_CHECK(Column_Write(path) != 0U);
+        Column_TestRead(path);
+
+        pIn = fopen(path, "rb");
+        if ((pIn != NULL) && (fseek(pIn, 0L, SEEK_END) == 0))
+        {
+            size  = (size_t)ftell(pIn);
+            pFile = (uint8_t *)malloc(size);
+            rewind(pIn);
+            TEST_CHECK((pFile != NULL) && (fread(pFile, 1U, size, pIn) == size));
+        }
+        if (pIn != NULL)
+        {
+            (void)fclose(pIn);
+        }
+
+        if (pFile != NULL)
+        {
+            Column_TestDamaged(pFile, size, path);
+        }
+
+        free(pFile);
+        (void)unlink(path);
+    }
+
+    return Test_Finish("test_column");
+}
+
+
+/* test_column.c */
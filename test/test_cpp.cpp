@@ -0,0 +1,115 @@
+/**
+ * @file    test_cpp.cpp
+ * @author  Amirhossein Askari
+ * @version v1.0.0
+ * @date    2026-10-16
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Checks the C++ interface against the C functions.
+ *
+ * @details
+ * @c tc::Thermocouple<T> re-evaluates the C coefficient tables inline, so nothing but
+ * this test ties its results to @c TC_CalculateTemperature and @c TC_CalculateVoltage.
+ * Build it with the flags of real users (e.g. @c -O2 @c -march=native, where g++ would
+ * fuse multiply-adds) and the C source in ISO C mode. The lazy view and a compile-time
+ * table are checked against the same C functions.
+ */
+
+
+/* ------------------------------------- Includes -------------------------------------- */
+
+#include <cmath>                       ///< std::nextafter
+#include <vector>                      ///< std::vector
+#include "thermocouple_views.hpp"      ///< tc::views::to_celsius, tc::Thermocouple
+#include "tc_test.h"                   ///< Checks and random numbers
+
+
+
+/* -------------------------------------- Defines -------------------------------------- */
+
+#define  CPP_SAMPLES    20000U    ///< Random inputs per type and direction
+
+
+
+/* ------------------------------------- Functions ------------------------------------- */
+
+/** @brief Runtime conversions of every type in both directions */
+static void Cpp_TestScalar()
+{
+    for (unsigned t = 0U; t < 8U; ++t)
+    {
+        const auto cType   = static_cast<ThermocoupleType>(t);
+        const auto cppType = static_cast<tc::Type>(t);
+        double join[TC_MAX_INVERSE_JOINS];
+        const std::size_t joins = TC_GetInverseJoins(cType, join);
+        std::size_t same = 1U;
+
+        for (std::size_t i = 0U; i < CPP_SAMPLES; ++i)
+        {
+            const double mv = ((joins != 0U) && ((i % 16U) == 0U))
+                                  ? std::nextafter(join[i % joins], ((i % 32U) == 0U) ? -HUGE_VAL : HUGE_VAL)
+                                  : Test_Uniform(-12.0, 80.0);
+            const double celsius = Test_Uniform(-300.0, 1900.0);
+
+            same &= Test_Same(tc::to_celsius(cppType, mv), TC_CalculateTemperature(cType, mv));
+            same &= Test_Same(tc::to_millivolts(cppType, celsius), TC_CalculateVoltage(cType, celsius));
+        }
+        TEST_CHECK(same != 0U);
+    }
+
+    /* The compile-time type selects the same tables as the runtime dispatch */
+    TEST_CHECK(Test_Same(tc::Thermocouple<tc::Type::K>::to_celsius(17.85), TC_CalculateTemperature(TC_TYPE_K, 17.85)));
+    TEST_CHECK(Test_Same(tc::Thermocouple<tc::Type::K>::to_millivolts(812.5), TC_CalculateVoltage(TC_TYPE_K, 812.5)));
+}
+
+/** @brief A table generated at compile time */
+static void Cpp_TestTable()
+{
+    constexpr auto table = tc::celsius_table<tc::Type::N, 256>(0.0, 0.2);
+    std::size_t same = 1U;
+
+    for (std::size_t i = 0U; i < table.size(); ++i)
+    {
+        same &= Test_Same(table[i], TC_CalculateTemperature(TC_TYPE_N, 0.0 + (static_cast<double>(i) * 0.2)));
+    }
+    TEST_CHECK(same != 0U);
+}
+
+/** @brief The lazy view, in both modes, over a range that is not a whole number of blocks */
+static void Cpp_TestView()
+{
+    std::vector<double> millivolts(1000U);
+    std::size_t same = 1U;
+
+    for (double &mv : millivolts)
+    {
+        mv = Test_Uniform(-10.0, 60.0);
+    }
+
+    for (ConversionMode mode : {TC_MODE_FAST, TC_MODE_EXACT})
+    {
+        std::size_t i = 0U;
+
+        for (double celsius : millivolts | tc::views::to_celsius(tc::Type::K, mode))
+        {
+            const double expected = (mode == TC_MODE_EXACT) ? TC_CalculateTemperatureExact(TC_TYPE_K, millivolts[i])
+                                                            : TC_CalculateTemperature(TC_TYPE_K, millivolts[i]);
+            same &= Test_Same(celsius, expected);
+            ++i;
+        }
+        TEST_CHECK(i == millivolts.size());
+    }
+    TEST_CHECK(same != 0U);
+}
+
+int main()
+{
+    Cpp_TestScalar();
+    Cpp_TestTable();
+    Cpp_TestView();
+
+    return Test_Finish("test_cpp");
+}
+
+
+/* test_cpp.cpp */
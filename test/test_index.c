@@ -0,0 +1,150 @@
+/**
+ * @file    test_index.c
+ * @author  Amirhossein Askari
+ * @version v1.0.0
+ * @date    2026-10-16
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Checks voltage-index queries against a full scan.
+ *
+ * @details
+ * @c TC_Index_Query documents that it returns exactly the samples a full scan with
+ * @c TC_CalculateTemperature would. For every type, random recordings that include
+ * out-of-range voltages and voltages on both sides of each segment join are indexed,
+ * and random temperature ranges are answered both ways; the matched rows and their
+ * temperatures must agree.
+ */
+
+
+/* ------------------------------------- Includes -------------------------------------- */
+
+#include <math.h>                    ///< nextafter, HUGE_VAL
+#include <stdlib.h>                  ///< malloc
+#include "thermocouple_index.h"      ///< Voltage index
+#include "tc_test.h"                 ///< Checks and random numbers
+
+
+
+/* -------------------------------------- Defines -------------------------------------- */
+
+#define  INDEX_COUNT      100000U    ///< Samples per recording
+#define  INDEX_QUERIES    200U       ///< Queries per type
+#define  INDEX_FIRST_ROW  1000U      ///< Row of the first sample
+
+
+
+/* --------------------------------------- Types --------------------------------------- */
+
+/** @brief State of one query */
+typedef struct
+{
+    const double *pTemperature;    /**< Scan result of every row */
+    uint8_t *pSeen;                /**< Rows reported by the index */
+    size_t matches;                /**< Callbacks received */
+    size_t wrong;                  /**< Callbacks with a bad row, a repeat or another temperature */
+} IndexQuery;
+
+
+
+/* ------------------------------------- Functions ------------------------------------- */
+
+/** @brief Records one matching sample reported by the index */
+static void Index_Match(void *pContext, uint64_t row, double voltage, double temperature)
+{
+    IndexQuery *pQuery = (IndexQuery *)pContext;
+    const uint64_t at  = row - INDEX_FIRST_ROW;
+
+    (void)voltage;
+    pQuery->matches++;
+    if ((row < INDEX_FIRST_ROW) || (at >= INDEX_COUNT) || (pQuery->pSeen[at] != 0U) ||
+        (Test_Same(temperature, pQuery->pTemperature[at]) == 0U))
+    {
+        pQuery->wrong++;
+    }
+    else
+    {
+        pQuery->pSeen[at] = 1U;
+    }
+}
+
+/** @brief Indexes one recording of a type and compares random queries with a scan */
+static void Index_TestType(ThermocoupleType type, double *pVoltage, double *pTemperature, uint8_t *pSeen)
+{
+    double join[TC_MAX_INVERSE_JOINS];
+    const size_t joins = TC_GetInverseJoins(type, join);
+    VoltageIndex index;
+    size_t q;
+    size_t i;
+
+    for (i = 0U; i < INDEX_COUNT; ++i)
+    {
+        if ((joins != 0U) && ((i % 10U) == 0U))
+        {
+            pVoltage[i] = nextafter(join[Test_Index(joins)], ((i % 20U) == 0U) ? -HUGE_VAL : HUGE_VAL);
+        }
+        else
+        {
+            pVoltage[i] = Test_Uniform(-12.0, 80.0);
+        }
+        pTemperature[i] = TC_CalculateTemperature(type, pVoltage[i]);
+    }
+
+    TEST_CHECK(TC_Index_Build(&index, type, pVoltage, INDEX_COUNT, INDEX_FIRST_ROW) != 0U);
+
+    for (q = 0U; q < INDEX_QUERIES; ++q)
+    {
+        /* Every tenth query is narrow around a join, where the conversion steps */
+        const double centre = ((joins != 0U) && ((q % 10U) == 0U)) ? TC_CalculateTemperature(type, join[q % joins])
+                                                                   : Test_Uniform(-300.0, 1900.0);
+        const double width  = ((q % 10U) == 0U) ? Test_Uniform(0.0, 0.2) : Test_Uniform(0.0, 400.0);
+        IndexQuery query    = { pTemperature, pSeen, 0U, 0U };
+        size_t expected     = 0U;
+        size_t missing      = 0U;
+        size_t found;
+
+        (void)memset(pSeen, 0, INDEX_COUNT);
+        found = TC_Index_Query(&index, centre - width, centre + width, Index_Match, &query, NULL);
+
+        for (i = 0U; i < INDEX_COUNT; ++i)
+        {
+            const double t = pTemperature[i];
+            const uint8_t match = ((t != TC_CONVERSION_FAILED) && (t >= (centre - width)) && (t <= (centre + width)))
+                                      ? 1U : 0U;
+            expected += match;
+            missing  += (match != pSeen[i]) ? 1U : 0U;
+        }
+
+        TEST_CHECK(found == expected);
+        TEST_CHECK(query.matches == found);
+        TEST_CHECK(query.wrong == 0U);
+        TEST_CHECK(missing == 0U);
+    }
+
+    TC_Index_Destroy(&index);
+}
+
+int main(void)
+{
+    double *pVoltage     = (double *)malloc(INDEX_COUNT * sizeof(double));
+    double *pTemperature = (double *)malloc(INDEX_COUNT * sizeof(double));
+    uint8_t *pSeen       = (uint8_t *)malloc(INDEX_COUNT);
+    ThermocoupleType type;
+
+    TEST_CHECK((pVoltage != NULL) && (pTemperature != NULL) && (pSeen != NULL));
+    if ((pVoltage != NULL) && (pTemperature != NULL) && (pSeen != NULL))
+    {
+        for (type = TC_TYPE_R; type <= TC_TYPE_N; type = (ThermocoupleType)(type + 1U))
+        {
+            Index_TestType(type, pVoltage, pTemperature, pSeen);
+        }
+    }
+
+    free(pSeen);
+    free(pTemperature);
+    free(pVoltage);
+
+    return Test_Finish("test_index");
+}
+
+
+/* test_index.c */
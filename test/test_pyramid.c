@@ -0,0 +1,164 @@
+/**
+ * @file    test_pyramid.c
+ * @author  Amirhossein Askari
+ * @version v1.0.0
+ * @date    2026-10-16
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Checks that pyramid columns bound every converted sample.
+ *
+ * @details
+ * Random walks that keep crossing the segment joins of each type are appended in
+ * uneven chunks, and random windows are rendered at random widths while the pyramid
+ * grows. Each column is recomputed by brute force over the samples it covers: every
+ * converted sample must lie within the column's bounds, and the bounds may exceed the
+ * sample extrema only by the largest step at a join.
+ */
+
+
+/* ------------------------------------- Includes -------------------------------------- */
+
+#include <math.h>                    ///< HUGE_VAL
+#include "thermocouple_pyramid.h"    ///< Decimation pyramid
+#include "tc_test.h"                 ///< Checks and random numbers
+
+
+
+/* -------------------------------------- Defines -------------------------------------- */
+
+#define  PYRAMID_SAMPLES    300000U    ///< Samples appended per type
+#define  PYRAMID_RENDERS    60U        ///< Renders after each append
+#define  PYRAMID_PIXELS     600U       ///< Widest render
+#define  PYRAMID_STEP       0.068      ///< Largest step of the conversion at a join, in °C
+
+
+
+/* ------------------------------------- Variables ------------------------------------- */
+
+static double voltage[PYRAMID_SAMPLES];
+static double temperature[PYRAMID_SAMPLES];
+static double low[PYRAMID_PIXELS];
+static double high[PYRAMID_PIXELS];
+
+
+
+/* ------------------------------------- Functions ------------------------------------- */
+
+/** @brief Samples covered by one bucket of level @p k, as the renderer chooses them */
+static uint64_t Pyramid_TestSpan(size_t k)
+{
+    uint64_t span = TC_PYRAMID_FANOUT;
+
+    while (k-- != 0U)
+    {
+        span *= TC_PYRAMID_FANOUT;
+    }
+
+    return span;
+}
+
+/** @brief Renders one window and checks every column against its samples */
+static void Pyramid_TestRender(const TemperaturePyramid *pPyramid, uint64_t first, uint64_t count, size_t pixels)
+{
+    const size_t columns = TC_Pyramid_Render(pPyramid, first, count, pixels, low, high);
+    const uint64_t end   = ((pPyramid->samples - first) < count) ? pPyramid->samples : (first + count);
+    const uint64_t per   = (end - first) / pixels;
+    size_t k = 0U;
+    uint64_t span;
+    uint64_t begin;
+    uint64_t buckets;
+    size_t c;
+
+    /* Same level and column split as TC_Pyramid_Render */
+    while (((k + 1U) < TC_PYRAMID_LEVELS) && (Pyramid_TestSpan(k + 1U) <= per))
+    {
+        k++;
+    }
+    span    = Pyramid_TestSpan(k);
+    begin   = first / span;
+    buckets = ((end + span - 1U) / span) - begin;
+    TEST_CHECK(columns == ((buckets < pixels) ? buckets : pixels));
+
+    for (c = 0U; c < columns; ++c)
+    {
+        const uint64_t b0 = begin + ((c * buckets) / columns);
+        const uint64_t b1 = begin + (((c + 1U) * buckets) / columns);
+        const uint64_t s1 = ((b1 * span) < pPyramid->samples) ? (b1 * span) : pPyramid->samples;
+        double minimum = HUGE_VAL;
+        double maximum = -HUGE_VAL;
+        uint8_t failed = 0U;
+        uint64_t s;
+
+        for (s = b0 * span; s < s1; ++s)
+        {
+            failed |= (temperature[s] == TC_CONVERSION_FAILED) ? 1U : 0U;
+            minimum = (temperature[s] < minimum) ? temperature[s] : minimum;
+            maximum = (temperature[s] > maximum) ? temperature[s] : maximum;
+        }
+
+        if (failed == 0U)
+        {
+            TEST_CHECK((low[c] <= minimum) && (high[c] >= maximum));
+            TEST_CHECK((low[c] >= (minimum - PYRAMID_STEP)) && (high[c] <= (maximum + PYRAMID_STEP)));
+        }
+    }
+}
+
+/** @brief Grows a pyramid of one type and renders it as it grows */
+static void Pyramid_TestType(ThermocoupleType type)
+{
+    double join[TC_MAX_INVERSE_JOINS];
+    const size_t joins = TC_GetInverseJoins(type, join);
+    const double centre = (joins != 0U) ? join[0] : 5.0;
+    TemperaturePyramid pyramid;
+    double level = centre;
+    size_t appended = 0U;
+    size_t part;
+    size_t r;
+    size_t i;
+
+    for (i = 0U; i < PYRAMID_SAMPLES; ++i)
+    {
+        /* A walk held within 1.5 mV of a join, with rare out-of-range spikes */
+        level += Test_Uniform(-0.01, 0.01);
+        level  = ((level - centre) > 1.5) ? (centre + 1.5) : (((centre - level) > 1.5) ? (centre - 1.5) : level);
+        if ((joins != 0U) && ((i % 97U) == 0U))
+        {
+            level = join[Test_Index(joins)];
+        }
+        voltage[i]     = ((i % 50021U) == 50020U) ? 250.0 : level;
+        temperature[i] = TC_CalculateTemperature(type, voltage[i]);
+    }
+
+    TC_Pyramid_Init(&pyramid, type);
+    for (; appended < PYRAMID_SAMPLES; appended += part)
+    {
+        part = 1U + Test_Index(40000U);
+        part = ((PYRAMID_SAMPLES - appended) < part) ? (PYRAMID_SAMPLES - appended) : part;
+        TEST_CHECK(TC_Pyramid_Append(&pyramid, &voltage[appended], part) != 0U);
+        TEST_CHECK(pyramid.samples == (appended + part));
+
+        for (r = 0U; r < PYRAMID_RENDERS; ++r)
+        {
+            const uint64_t first = Test_Index((size_t)pyramid.samples);
+            const uint64_t count = 1U + Test_Index((size_t)pyramid.samples);
+            Pyramid_TestRender(&pyramid, first, count, 1U + Test_Index(PYRAMID_PIXELS));
+        }
+    }
+    TC_Pyramid_Destroy(&pyramid);
+}
+
+int main(void)
+{
+    ThermocoupleType type;
+
+    for (type = TC_TYPE_R; type <= TC_TYPE_N; type = (ThermocoupleType)(type + 1U))
+    {
+        Pyramid_TestType(type);
+    }
+
+    return Test_Finish("test_pyramid");
+}
+
+
+/* test_pyramid.c */
@@ -0,0 +1,180 @@
+/**
+ * @file    test_ring.c
+ * @author  Amirhossein Askari
+ * @version v1.0.0
+ * @date    2026-10-16
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Stresses the single-producer/single-consumer sample ring.
+ *
+ * @details
+ * A producer thread commits blocks of random length into a small ring while the main
+ * thread drains them. The sample sequence is a function of its position, so the
+ * consumer knows every value it should receive. The first pass reads raw blocks with
+ * @c TC_Ring_AcquireRead; the second converts them with @c TC_Ring_Drain into buffers
+ * of random size, which must match @c TC_CalculateTemperature sample for sample. Build
+ * with @c -fsanitize=thread to check the memory ordering as well.
+ */
+
+
+/* ------------------------------------- Includes -------------------------------------- */
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE                  ///< sched_yield
+#endif
+#include <pthread.h>                 ///< pthread_create, pthread_join
+#include <sched.h>                   ///< sched_yield
+#include "thermocouple_ring.h"       ///< Sample ring
+#include "tc_test.h"                 ///< Checks and random numbers
+
+
+
+/* -------------------------------------- Defines -------------------------------------- */
+
+#define  RING_SLOTS      16U          ///< Slots in the ring
+#define  RING_BLOCK      100U         ///< Samples per slot
+#define  RING_SAMPLES    3000000U     ///< Samples sent per pass
+#define  RING_DRAIN      250U         ///< Largest drain buffer
+
+
+
+/* --------------------------------------- Types --------------------------------------- */
+
+/** @brief Producer thread state */
+typedef struct
+{
+    SampleRing *pRing;    /**< Ring to fill */
+    uint64_t state;       /**< Private xorshift state; the helpers in tc_test.h are not thread-safe */
+} RingProducer;
+
+
+
+/* ------------------------------------- Variables ------------------------------------- */
+
+static double storage[RING_SLOTS * RING_BLOCK];
+static size_t counts[RING_SLOTS];
+
+
+
+/* ------------------------------------- Functions ------------------------------------- */
+
+/** @brief Voltage of sample @p n of a pass, covering the range of type K and beyond */
+static double Ring_Voltage(size_t n)
+{
+    return ((double)((n * 7919U) % 60000U) * 0.001) - 7.0;
+}
+
+/** @brief Producer: commits every sample of a pass in blocks of random length */
+static void *Ring_Produce(void *pArgument)
+{
+    RingProducer *pProducer = (RingProducer *)pArgument;
+    size_t sent = 0U;
+
+    while (sent < RING_SAMPLES)
+    {
+        double *pSlot = TC_Ring_AcquireWrite(pProducer->pRing);
+
+        if (pSlot == NULL)
+        {
+            (void)sched_yield();
+        }
+        else
+        {
+            size_t count;
+            size_t i;
+
+            pProducer->state ^= pProducer->state >> 12;
+            pProducer->state ^= pProducer->state << 25;
+            pProducer->state ^= pProducer->state >> 27;
+            count = 1U + (size_t)((pProducer->state * 0x2545F4914F6CDD1DU) % RING_BLOCK);
+            count = ((RING_SAMPLES - sent) < count) ? (RING_SAMPLES - sent) : count;
+
+            for (i = 0U; i < count; ++i)
+            {
+                pSlot[i] = Ring_Voltage(sent + i);
+            }
+            TC_Ring_CommitWrite(pProducer->pRing, count);
+            sent += count;
+        }
+    }
+
+    return NULL;
+}
+
+/** @brief Runs one pass; @p convert selects TC_Ring_Drain over raw reads */
+static void Ring_TestPass(uint8_t convert)
+{
+    double temperature[RING_DRAIN];
+    RingProducer producer;
+    SampleRing ring;
+    pthread_t thread;
+    size_t received = 0U;
+    size_t wrong    = 0U;
+    size_t i;
+
+    TEST_CHECK(TC_Ring_Init(&ring, storage, counts, RING_SLOTS, RING_BLOCK) != 0U);
+    producer.pRing = &ring;
+    producer.state = Test_Next() | 1U;
+    TEST_CHECK(pthread_create(&thread, NULL, Ring_Produce, &producer) == 0);
+
+    while (received < RING_SAMPLES)
+    {
+        size_t count = 0U;
+
+        if (convert != 0U)
+        {
+            size_t failed   = 0U;
+            size_t expected = 0U;
+
+            count = TC_Ring_Drain(&ring, TC_TYPE_K, TC_MODE_FAST, temperature, 1U + Test_Index(RING_DRAIN), &failed);
+            for (i = 0U; i < count; ++i)
+            {
+                const double t = TC_CalculateTemperature(TC_TYPE_K, Ring_Voltage(received + i));
+
+                wrong    += Test_Same(temperature[i], t) ? 0U : 1U;
+                expected += (t == TC_CONVERSION_FAILED) ? 1U : 0U;
+            }
+            wrong += (failed == expected) ? 0U : 1U;
+        }
+        else
+        {
+            const double *pBlock = TC_Ring_AcquireRead(&ring, &count);
+
+            if (pBlock != NULL)
+            {
+                wrong += ((count != 0U) && (count <= RING_BLOCK)) ? 0U : 1U;
+                for (i = 0U; i < count; ++i)
+                {
+                    wrong += Test_Same(pBlock[i], Ring_Voltage(received + i)) ? 0U : 1U;
+                }
+                TC_Ring_Release(&ring);
+            }
+            else
+            {
+                count = 0U;
+            }
+        }
+
+        if (count == 0U)
+        {
+            (void)sched_yield();
+        }
+        received += count;
+    }
+
+    TEST_CHECK(pthread_join(thread, NULL) == 0);
+    TEST_CHECK(received == RING_SAMPLES);
+    TEST_CHECK(wrong == 0U);
+    TEST_CHECK(TC_Ring_AcquireRead(&ring, &i) == NULL);
+}
+
+int main(void)
+{
+    Ring_TestPass(0U);
+    Ring_TestPass(1U);
+
+    return Test_Finish("test_ring");
+}
+
+
+/* test_ring.c */
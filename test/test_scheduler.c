@@ -0,0 +1,206 @@
+/**
+ * @file    test_scheduler.c
+ * @author  Amirhossein Askari
+ * @version v1.0.0
+ * @date    2026-10-16
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Stresses the work-stealing scheduler against the scalar conversion.
+ *
+ * @details
+ * Rounds of jobs with random sizes (most large enough to be split and stolen), types
+ * and modes, some of them converting in place, are submitted to a pool of workers. Two
+ * threads submit at once in every second round. Every output must match
+ * @c TC_CalculateTemperature or @c TC_CalculateTemperatureExact sample for sample, and
+ * every failed count must match the oracle.
+ */
+
+
+/* ------------------------------------- Includes -------------------------------------- */
+
+#include <stdlib.h>                     ///< malloc
+#include "thermocouple_scheduler.h"     ///< Work-stealing scheduler
+#include "tc_test.h"                    ///< Checks and random numbers
+
+
+
+/* -------------------------------------- Defines -------------------------------------- */
+
+#define  SCHED_WORKERS    4U          ///< Worker threads, more than the test machine may have CPUs
+#define  SCHED_ROUNDS     12U         ///< Rounds of jobs
+#define  SCHED_JOBS       32U         ///< Jobs per round
+#define  SCHED_LARGEST    200000U     ///< Largest job in samples
+
+
+
+/* --------------------------------------- Types --------------------------------------- */
+
+/** @brief One job of a round with its own buffers */
+typedef struct
+{
+    ConversionJob job;      /**< Job handed to the scheduler */
+    double *pVoltage;       /**< Input, kept to compare against */
+    double *pOutput;        /**< Output, or the input copy converted in place */
+} SchedTask;
+
+/** @brief Second submitting thread */
+typedef struct
+{
+    Scheduler *pScheduler;    /**< Scheduler */
+    SchedTask *pTasks;        /**< Tasks to submit */
+    size_t count;             /**< Number of tasks */
+    size_t rejected;          /**< Submissions refused */
+} SchedSubmitter;
+
+
+
+/* ------------------------------------- Variables ------------------------------------- */
+
+static SchedTask tasks[SCHED_JOBS];
+
+
+
+/* ------------------------------------- Functions ------------------------------------- */
+
+/** @brief Submits tasks from a second thread */
+static void *Sched_Submit(void *pArgument)
+{
+    SchedSubmitter *pSubmitter = (SchedSubmitter *)pArgument;
+    size_t i;
+
+    for (i = 0U; i < pSubmitter->count; ++i)
+    {
+        pSubmitter->rejected += (TC_Scheduler_Submit(pSubmitter->pScheduler, &pSubmitter->pTasks[i].job) != 0U) ? 0U : 1U;
+    }
+
+    return NULL;
+}
+
+/** @brief Fills the tasks of one round with random jobs */
+static uint8_t Sched_Prepare(void)
+{
+    uint8_t ok = 1U;
+    size_t j;
+    size_t i;
+
+    for (j = 0U; (ok != 0U) && (j < SCHED_JOBS); ++j)
+    {
+        SchedTask *pTask   = &tasks[j];
+        const size_t count = ((j % 4U) == 0U) ? (1U + Test_Index(TC_SCHED_CHUNK_SIZE)) : (1U + Test_Index(SCHED_LARGEST));
+
+        pTask->pVoltage = (double *)malloc(count * sizeof(double));
+        pTask->pOutput  = (double *)malloc(count * sizeof(double));
+        ok = ((pTask->pVoltage != NULL) && (pTask->pOutput != NULL)) ? 1U : 0U;
+
+        for (i = 0U; (ok != 0U) && (i < count); ++i)
+        {
+            pTask->pVoltage[i] = Test_Uniform(-12.0, 80.0);
+        }
+
+        pTask->job.type         = (ThermocoupleType)Test_Index(8U);
+        pTask->job.mode         = ((j % 3U) == 0U) ? TC_MODE_EXACT : TC_MODE_FAST;
+        pTask->job.count        = count;
+        pTask->job.pTemperature = pTask->pOutput;
+        if ((ok != 0U) && ((j % 5U) == 0U))
+        {
+            /* In place: the output buffer starts as a copy of the input */
+            (void)memcpy(pTask->pOutput, pTask->pVoltage, count * sizeof(double));
+            pTask->job.pVoltage = pTask->pOutput;
+        }
+        else
+        {
+            pTask->job.pVoltage = pTask->pVoltage;
+        }
+    }
+
+    return ok;
+}
+
+/** @brief Compares every task of a round with the scalar conversion and frees it */
+static void Sched_Check(void)
+{
+    size_t j;
+    size_t i;
+
+    for (j = 0U; j < SCHED_JOBS; ++j)
+    {
+        SchedTask *pTask = &tasks[j];
+        size_t failed    = 0U;
+        size_t expected  = 0U;
+        size_t same      = 1U;
+
+        TEST_CHECK(TC_Scheduler_JobDone(&pTask->job, &failed) != 0U);
+        for (i = 0U; i < pTask->job.count; ++i)
+        {
+            const double t = (pTask->job.mode == TC_MODE_EXACT) ? TC_CalculateTemperatureExact(pTask->job.type, pTask->pVoltage[i])
+                                                                : TC_CalculateTemperature(pTask->job.type, pTask->pVoltage[i]);
+            same     &= Test_Same(pTask->pOutput[i], t);
+            expected += (t == TC_CONVERSION_FAILED) ? 1U : 0U;
+        }
+        TEST_CHECK(same != 0U);
+        TEST_CHECK(failed == expected);
+
+        free(pTask->pOutput);
+        free(pTask->pVoltage);
+        pTask->pOutput  = NULL;
+        pTask->pVoltage = NULL;
+    }
+}
+
+int main(void)
+{
+    Scheduler scheduler;
+    size_t round;
+    size_t j;
+
+    TEST_CHECK(TC_Scheduler_Init(&scheduler, SCHED_WORKERS) != 0U);
+
+    for (round = 0U; round < SCHED_ROUNDS; ++round)
+    {
+        TEST_CHECK(Sched_Prepare() != 0U);
+
+        if ((round % 2U) == 0U)
+        {
+            /* Submit one at a time and poll the first job while the rest queue up */
+            for (j = 0U; j < SCHED_JOBS; ++j)
+            {
+                TEST_CHECK(TC_Scheduler_Submit(&scheduler, &tasks[j].job) != 0U);
+            }
+            while (TC_Scheduler_JobDone(&tasks[0].job, NULL) == 0U)
+            {
+                /* Spin */
+            }
+        }
+        else
+        {
+            /* Half of the jobs come from a second thread at the same time */
+            SchedSubmitter submitter = { &scheduler, &tasks[SCHED_JOBS / 2U], SCHED_JOBS / 2U, 0U };
+            pthread_t thread;
+
+            TEST_CHECK(pthread_create(&thread, NULL, Sched_Submit, &submitter) == 0);
+            for (j = 0U; j < (SCHED_JOBS / 2U); ++j)
+            {
+                TEST_CHECK(TC_Scheduler_Submit(&scheduler, &tasks[j].job) != 0U);
+            }
+            TEST_CHECK(pthread_join(thread, NULL) == 0);
+            TEST_CHECK(submitter.rejected == 0U);
+        }
+
+        TC_Scheduler_Wait(&scheduler);
+        Sched_Check();
+    }
+
+    /* Jobs still pending at shutdown are completed by Destroy */
+    TEST_CHECK(Sched_Prepare() != 0U);
+    for (j = 0U; j < SCHED_JOBS; ++j)
+    {
+        TEST_CHECK(TC_Scheduler_Submit(&scheduler, &tasks[j].job) != 0U);
+    }
+    TC_Scheduler_Destroy(&scheduler);
+    Sched_Check();
+
+    return Test_Finish("test_scheduler");
+}
+
+
+/* test_scheduler.c */
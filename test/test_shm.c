@@ -0,0 +1,246 @@
+/**
+ * @file    test_shm.c
+ * @author  Amirhossein Askari
+ * @version v1.0.0
+ * @date    2026-10-16
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Stresses the shared-memory ring with a writer and two reader processes.
+ *
+ * @details
+ * The writer publishes numbered frames into a small ring as fast as it can, so the
+ * readers are lapped constantly. Every frame holds values derived from its number, and
+ * its length varies. One reader uses @c TC_ShmRing_Peek / @c TC_ShmRing_Release, the
+ * other @c TC_ShmRing_Read. For both, every frame accepted as intact must be complete
+ * and untorn, frame numbers must only increase, and frames read plus frames reported
+ * lost must add up to exactly the frames published.
+ */
+
+
+/* ------------------------------------- Includes -------------------------------------- */
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE                  ///< fork, pipe
+#endif
+#include <sched.h>                   ///< sched_yield
+#include <sys/wait.h>                ///< waitpid
+#include <unistd.h>                  ///< fork, pipe, getpid
+#include "thermocouple_shm.h"        ///< Shared-memory ring
+#include "tc_test.h"                 ///< Checks and random numbers
+
+
+
+/* -------------------------------------- Defines -------------------------------------- */
+
+#define  SHM_SLOTS      8U          ///< Slots in the ring; small, so readers get lapped
+#define  SHM_CAPACITY   64U         ///< Samples per slot
+#define  SHM_FRAMES     400000U     ///< Frames published by the writer
+
+
+
+/* ------------------------------------- Functions ------------------------------------- */
+
+/** @brief Number of samples in frame @p frame */
+static size_t Shm_Length(uint64_t frame)
+{
+    return 1U + (size_t)(frame % SHM_CAPACITY);
+}
+
+/** @brief Sample @p i of frame @p frame; exact in a double */
+static double Shm_Value(uint64_t frame, size_t i)
+{
+    return (double)((frame * SHM_CAPACITY) + i);
+}
+
+/** @brief Nonzero if @p pFrame holds exactly frame @p frame */
+static uint8_t Shm_Intact(const double *pFrame, size_t count, uint64_t frame)
+{
+    uint8_t ok = (count == Shm_Length(frame)) ? 1U : 0U;
+    size_t i;
+
+    for (i = 0U; (ok != 0U) && (i < count); ++i)
+    {
+        ok = (pFrame[i] == Shm_Value(frame, i)) ? 1U : 0U;
+    }
+
+    return ok;
+}
+
+/** @brief Reader process body using Peek/Release; returns the exit status */
+static int Shm_PeekReader(const char *pName, int ready)
+{
+    double copy[SHM_CAPACITY];
+    ShmRing ring;
+    uint64_t lost = 0U;
+    uint64_t read = 0U;
+    uint64_t torn = 0U;
+    size_t count;
+
+    TEST_CHECK(TC_ShmRing_Open(&ring, pName) != 0U);
+    TEST_CHECK(write(ready, "r", 1U) == 1);
+
+    while (ring.cursor < SHM_FRAMES)
+    {
+        const uint64_t frame = ring.cursor;
+        const double *pFrame = TC_ShmRing_Peek(&ring, &count, &lost);
+
+        if (pFrame != NULL)
+        {
+            /* Peek may skip lost frames; the frame returned is the one now at the cursor */
+            const uint64_t at = ring.cursor;
+
+            TEST_CHECK(at >= frame);
+            TEST_CHECK(count <= SHM_CAPACITY);
+            (void)memcpy(copy, pFrame, count * sizeof(double));
+            if (TC_ShmRing_Release(&ring) != 0U)
+            {
+                TEST_CHECK(Shm_Intact(copy, count, at) != 0U);
+                read++;
+            }
+            else
+            {
+                torn++;
+            }
+        }
+    }
+
+    TEST_CHECK((read + torn + lost) == SHM_FRAMES);
+    TEST_CHECK(read != 0U);
+    TC_ShmRing_Close(&ring);
+
+    return Test_Finish("test_shm peek reader");
+}
+
+/** @brief Reader process body using Read; returns the exit status */
+static int Shm_CopyReader(const char *pName, int ready)
+{
+    double copy[SHM_CAPACITY];
+    ShmRing ring;
+    uint64_t lost = 0U;
+    uint64_t read = 0U;
+    uint64_t next = 0U;
+
+    TEST_CHECK(TC_ShmRing_Open(&ring, pName) != 0U);
+    TEST_CHECK(write(ready, "r", 1U) == 1);
+
+    while (ring.cursor < SHM_FRAMES)
+    {
+        const uint64_t before = lost;
+        const size_t count    = TC_ShmRing_Read(&ring, copy, SHM_CAPACITY, &lost);
+
+        if (count != 0U)
+        {
+            /* The frame number is the first sample divided by the capacity */
+            const uint64_t frame = (uint64_t)copy[0] / SHM_CAPACITY;
+
+            TEST_CHECK(frame == (next + (lost - before)));
+            TEST_CHECK(Shm_Intact(copy, count, frame) != 0U);
+            next = frame + 1U;
+            read++;
+        }
+    }
+
+    TEST_CHECK((read + lost) == SHM_FRAMES);
+    TEST_CHECK(read != 0U);
+    TC_ShmRing_Close(&ring);
+
+    return Test_Finish("test_shm copy reader");
+}
+
+/** @brief Frames published with voltages are the batch conversion of those voltages */
+static void Shm_TestPublish(const char *pName)
+{
+    double voltage[SHM_CAPACITY];
+    double expected[SHM_CAPACITY];
+    double frame[SHM_CAPACITY];
+    ShmRing writer;
+    ShmRing reader;
+    uint64_t lost = 0U;
+    size_t failed;
+    size_t i;
+
+    for (i = 0U; i < SHM_CAPACITY; ++i)
+    {
+        voltage[i] = Test_Uniform(-8.0, 60.0);
+    }
+    failed = TC_CalculateTemperatureArray(TC_TYPE_K, voltage, expected, SHM_CAPACITY, TC_MODE_FAST);
+
+    TEST_CHECK(TC_ShmRing_Create(&writer, pName, SHM_SLOTS, SHM_CAPACITY) != 0U);
+    TEST_CHECK(TC_ShmRing_Open(&reader, pName) != 0U);
+    TEST_CHECK(TC_ShmRing_Read(&reader, frame, SHM_CAPACITY, &lost) == 0U);
+    TEST_CHECK(TC_ShmRing_PublishVoltages(&writer, TC_TYPE_K, TC_MODE_FAST, voltage, SHM_CAPACITY) == failed);
+    TEST_CHECK(TC_ShmRing_Read(&reader, frame, SHM_CAPACITY, &lost) == SHM_CAPACITY);
+    TEST_CHECK((lost == 0U) && (memcmp(frame, expected, sizeof(frame)) == 0));
+
+    TC_ShmRing_Close(&reader);
+    TC_ShmRing_Close(&writer);
+    TC_ShmRing_Unlink(pName);
+}
+
+int main(void)
+{
+    char name[64];
+    ShmRing writer;
+    pid_t readers[2];
+    int ready[2];
+    int status;
+    uint64_t frame;
+    size_t r;
+    size_t i;
+    char byte;
+
+    (void)snprintf(name, sizeof(name), "/tc_test_shm_%ld", (long)getpid());
+    Shm_TestPublish(name);
+
+    TEST_CHECK(TC_ShmRing_Create(&writer, name, SHM_SLOTS, SHM_CAPACITY) != 0U);
+    TEST_CHECK(pipe(ready) == 0);
+
+    for (r = 0U; r < 2U; ++r)
+    {
+        readers[r] = fork();
+        if (readers[r] == 0)
+        {
+            status = (r == 0U) ? Shm_PeekReader(name, ready[1]) : Shm_CopyReader(name, ready[1]);
+            (void)fflush(stdout);
+            _exit(status);
+        }
+        TEST_CHECK(readers[r] > 0);
+    }
+
+    /* Start publishing once both readers are attached at frame 0 */
+    for (r = 0U; r < 2U; ++r)
+    {
+        TEST_CHECK(read(ready[0], &byte, 1U) == 1);
+    }
+
+    for (frame = 0U; frame < SHM_FRAMES; ++frame)
+    {
+        double *pSlot = TC_ShmRing_Begin(&writer);
+
+        for (i = 0U; i < Shm_Length(frame); ++i)
+        {
+            pSlot[i] = Shm_Value(frame, i);
+        }
+        TC_ShmRing_Commit(&writer, Shm_Length(frame));
+
+        /* Let the readers in now and then, so they overlap the writer on one CPU too */
+        if ((frame % 256U) == 255U)
+        {
+            (void)sched_yield();
+        }
+    }
+
+    for (r = 0U; r < 2U; ++r)
+    {
+        TEST_CHECK((readers[r] > 0) && (waitpid(readers[r], &status, 0) == readers[r]) && WIFEXITED(status) &&
+                   (WEXITSTATUS(status) == 0));
+    }
+
+    TC_ShmRing_Close(&writer);
+    TC_ShmRing_Unlink(name);
+
+    return Test_Finish("test_shm");
+}
+
+
+/* test_shm.c */
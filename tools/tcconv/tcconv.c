@@ -0,0 +1,523 @@
+/**
+ * @file    tcconv.c
+ * @author  Amirhossein Askari
+ * @version v1.0.0
+ * @date    2026-10-16
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Bulk conversion of raw binary recordings.
+ *
+ * @details
+ * By default (@c -m mmap) memory-maps a raw recording of native-endian samples and a
+ * preallocated output file of doubles (°C), splits the samples into one contiguous range
+ * per thread and converts each range with the batch functions. Nothing passes through
+ * read()/write(): the threads read the page cache directly and write the output pages in
+ * place. For archives on fast storage, where read latency rather than conversion is the
+ * limit, @c -m uring streams the file through io_uring with @c -q chunks in flight, and
+ * @c -m pread through synchronous pread/pwrite (see @c tcconv_io.h).
+ *
+ * Input formats:
+ *  - @c f64: voltages in mV, converted straight from the input map into the output map.
+ *  - @c f32: voltages in mV, widened block by block into the output map and converted in place.
+ *  - @c i16 / @c i32: ADC codes, scaled by @c -g mV per code and @c -z mV offset with the
+ *    cold junction at @c -c °C (see @c AdcScaling). The defaults read integer microvolts.
+ *
+ * With @c -o columnar the output is a columnar block file instead (see
+ * @c thermocouple_column.h): the input holds frames of @c -n interleaved mV channels,
+ * @c -t gives one type letter for all channels or one per channel, and the file keeps the
+ * voltages with per-block mV/°C statistics for range queries (@c tcquery).
+ *
+ * With @c -N, the mmap threads are spread over the NUMA nodes and pinned there, and each
+ * range starts on a page boundary of both files, so the pages a thread faults in, for
+ * reading and for writing, are allocated on its own node (see @c tcconv_numa.h).
+ *
+ * Usage: tcconv -t type(s) [-f f64|f32|i16|i32] [-e] [-j threads] [-N] [-m mmap|pread|uring] [-q depth]
+ *               [-g gain] [-z offset] [-c cold] [-o celsius|columnar] [-n channels] input output
+ */
+
+
+/* ------------------------------------- Includes -------------------------------------- */
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE                  ///< madvise, posix_fallocate
+#endif
+#include <fcntl.h>                  ///< open, posix_fallocate
+#include <pthread.h>                ///< Worker threads
+#include <stdio.h>                  ///< fprintf
+#include <stdlib.h>                 ///< strtoul, strtod
+#include <string.h>                 ///< strcmp, strchr
+#include <sys/mman.h>               ///< mmap, madvise
+#include <sys/stat.h>               ///< fstat
+#include <time.h>                   ///< clock_gettime
+#include <unistd.h>                 ///< getopt, sysconf
+#include "tcconv_io.h"              ///< Formats and chunked engines
+#include "tcconv_numa.h"            ///< Node-local partitioning
+#include "thermocouple_column.h"    ///< Columnar output
+
+
+
+/* -------------------------------------- Defines -------------------------------------- */
+
+#define  CONV_MAX_THREADS    256U    ///< Upper bound on @c -j
+#define  CONV_ENGINE_MMAP    2U      ///< @c -m mmap, next to the @c IoEngine values
+#define  CONV_COLUMN_FRAMES  4096U   ///< f32 frames widened per columnar append
+
+
+
+/* --------------------------------------- Types --------------------------------------- */
+
+/** @brief Range of samples converted by one thread */
+typedef struct
+{
+    const ConvSettings *pSettings;    /**< Conversion settings */
+    const uint8_t *pInput;            /**< Mapped input file */
+    double *pOutput;                  /**< Mapped output file */
+    size_t first;                     /**< First sample of the range */
+    size_t count;                     /**< Number of samples */
+    size_t failed;                    /**< Receives the failed sample count */
+    const NumaTopology *pTopology;    /**< Topology to pin to, or NULL */
+    size_t node;                      /**< Home node in @c pTopology */
+} ConvTask;
+
+
+
+/* ------------------------------------- Functions ------------------------------------- */
+
+/** @brief Monotonic time in ns */
+static uint64_t Conv_Now(void)
+{
+    struct timespec ts;
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)ts.tv_sec * 1000000000U) + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief  Parses thermocouple type letters, one per channel.
+ *
+ * @param[in]  pText   Type letters, e.g. "K" or "KKJ".
+ * @param[out] pTypes  Receives up to @c TC_COLUMN_MAX_CHANNELS types.
+ *
+ * @return Number of types parsed, or 0 if a letter is invalid.
+ */
+static size_t Conv_ParseTypes(const char *pText, ThermocoupleType *pTypes)
+{
+    static const char letters[] = "RSBJTEKN";    /* ThermocoupleType order */
+    size_t count = 0U;
+    uint8_t ok   = 1U;
+
+    while ((ok != 0U) && (pText[count] != '\0'))
+    {
+        const char *pFound = strchr(letters, (int)pText[count] & ~0x20);
+
+        ok = ((pFound != NULL) && (*pFound != '\0') && (count < TC_COLUMN_MAX_CHANNELS)) ? 1U : 0U;
+        if (ok != 0U)
+        {
+            pTypes[count] = (ThermocoupleType)(pFound - letters);
+            count++;
+        }
+    }
+
+    return (ok != 0U) ? count : 0U;
+}
+
+/**
+ * @brief  Looks a name up in a table.
+ *
+ * @param[in]  pText   Name.
+ * @param[in]  pNames  Table of names.
+ * @param[in]  count   Number of names.
+ * @param[out] pIndex  Receives the index of the match.
+ *
+ * @return 1 on success, otherwise 0.
+ */
+static uint8_t Conv_ParseName(const char *pText, const char *const *pNames, size_t count, uint32_t *pIndex)
+{
+    uint8_t result = 0U;
+    size_t i;
+
+    for (i = 0U; i < count; ++i)
+    {
+        if (strcmp(pText, pNames[i]) == 0)
+        {
+            *pIndex = (uint32_t)i;
+            result  = 1U;
+        }
+    }
+
+    return result;
+}
+
+/**
+ * @brief  Thread body: converts one range of the input map into the output map.
+ *
+ * @param[in,out] pArg  @c ConvTask.
+ *
+ * @return NULL.
+ */
+static void *Conv_Worker(void *pArg)
+{
+    ConvTask *pTask = (ConvTask *)pArg;
+
+    if (pTask->pTopology != NULL)
+    {
+        (void)TCNUMA_PinThread(pTask->pTopology, pTask->node);
+    }
+
+    pTask->failed = TCIO_ConvertBlock(pTask->pSettings,
+                                      &pTask->pInput[pTask->first * TCIO_SampleSize(pTask->pSettings->format)],
+                                      &pTask->pOutput[pTask->first], pTask->count);
+
+    return NULL;
+}
+
+/**
+ * @brief  Creates the output file at its final size.
+ *
+ * @param[in] pPath  Output path.
+ * @param[in] bytes  Output size.
+ *
+ * @return Descriptor open for reading and writing, or -1.
+ */
+static int Conv_CreateOutput(const char *pPath, size_t bytes)
+{
+    int fd = open(pPath, O_RDWR | O_CREAT | O_TRUNC, 0644);
+
+    /* Reserve the blocks up front so writes never allocate; fall back to a sparse file */
+    if ((fd >= 0) && (posix_fallocate(fd, 0, (off_t)bytes) != 0) && (ftruncate(fd, (off_t)bytes) != 0))
+    {
+        (void)close(fd);
+        fd = -1;
+    }
+
+    return fd;
+}
+
+/**
+ * @brief  Converts with both files mapped, one range per thread.
+ *
+ * @param[in]  pSettings    Conversion settings.
+ * @param[in]  inputFd      Input file.
+ * @param[in]  outputFd     Preallocated output file.
+ * @param[in]  count        Number of samples.
+ * @param[in]  threadCount  Number of threads (1 .. @c CONV_MAX_THREADS).
+ * @param[in]  pTopology    Topology to spread the threads over, or NULL.
+ * @param[out] pFailed      Receives the number of failed samples.
+ *
+ * @return 1 on success, otherwise 0.
+ */
+static uint8_t Conv_RunMapped(const ConvSettings *pSettings, int inputFd, int outputFd, size_t count,
+                              size_t threadCount, const NumaTopology *pTopology, size_t *pFailed)
+{
+    static ConvTask tasks[CONV_MAX_THREADS];
+    static pthread_t threads[CONV_MAX_THREADS];
+    static NumaRange ranges[CONV_MAX_THREADS];
+    const size_t inBytes  = count * TCIO_SampleSize(pSettings->format);
+    const size_t outBytes = count * sizeof(double);
+    uint8_t *pInput  = (uint8_t *)mmap(NULL, inBytes, PROT_READ, MAP_SHARED, inputFd, 0);
+    double *pOutput  = (double *)mmap(NULL, outBytes, PROT_READ | PROT_WRITE, MAP_SHARED, outputFd, 0);
+    uint8_t result   = 0U;
+    size_t started   = 0U;
+    size_t align;
+    size_t t;
+
+    if (((void *)pInput != MAP_FAILED) && ((void *)pOutput != MAP_FAILED))
+    {
+        (void)madvise(pInput, inBytes, MADV_SEQUENTIAL);
+        (void)madvise(pOutput, outBytes, MADV_SEQUENTIAL);
+
+        /* Whole batch blocks per thread keep every range but the last on the vector path;
+           with -N, whole pages of the input keep each page of both files to one thread */
+        align = (pTopology != NULL) ? ((size_t)sysconf(_SC_PAGESIZE) / TCIO_SampleSize(pSettings->format))
+                                    : (size_t)TC_BATCH_BLOCK_SIZE;
+        align = (align < TC_BATCH_BLOCK_SIZE) ? TC_BATCH_BLOCK_SIZE : align;
+        TCNUMA_Partition(pTopology, count, threadCount, align, ranges);
+
+        result = 1U;
+        for (t = 0U; (result != 0U) && (t < threadCount) && (ranges[t].count != 0U); ++t)
+        {
+            tasks[t].pSettings = pSettings;
+            tasks[t].pInput    = pInput;
+            tasks[t].pOutput   = pOutput;
+            tasks[t].first     = ranges[t].first;
+            tasks[t].count     = ranges[t].count;
+            tasks[t].failed    = 0U;
+            tasks[t].pTopology = pTopology;
+            tasks[t].node      = ranges[t].node;
+            if (pthread_create(&threads[t], NULL, Conv_Worker, &tasks[t]) == 0)
+            {
+                started++;
+            }
+            else
+            {
+                result = 0U;
+            }
+        }
+
+        *pFailed = 0U;
+        for (t = 0U; t < started; ++t)
+        {
+            (void)pthread_join(threads[t], NULL);
+            *pFailed += tasks[t].failed;
+        }
+    }
+
+    if ((void *)pOutput != MAP_FAILED)
+    {
+        (void)munmap(pOutput, outBytes);
+    }
+    if ((void *)pInput != MAP_FAILED)
+    {
+        (void)munmap(pInput, inBytes);
+    }
+
+    return result;
+}
+
+/**
+ * @brief  Writes a columnar file from frames of interleaved mV channels.
+ *
+ * @param[in] format        Input format, @c CONV_FORMAT_F64 or @c CONV_FORMAT_F32.
+ * @param[in] pTypes        Type of each channel.
+ * @param[in] channelCount  Number of channels.
+ * @param[in] inputFd       Input file.
+ * @param[in] pPath         Output path.
+ * @param[in] frameCount    Number of frames.
+ *
+ * @return 1 on success, otherwise 0.
+ */
+static uint8_t Conv_RunColumnar(SampleFormat format, const ThermocoupleType *pTypes, size_t channelCount,
+                                int inputFd, const char *pPath, size_t frameCount)
+{
+    static double widened[CONV_COLUMN_FRAMES * TC_COLUMN_MAX_CHANNELS];
+    const size_t inBytes = frameCount * channelCount * TCIO_SampleSize(format);
+    const void *pInput   = mmap(NULL, inBytes, PROT_READ, MAP_SHARED, inputFd, 0);
+    ColumnWriter writer;
+    uint8_t ok = 0U;
+    size_t done;
+    size_t i;
+
+    if ((pInput != MAP_FAILED) && (TC_ColumnWriter_Open(&writer, pPath, channelCount, pTypes, 0U) != 0U))
+    {
+        (void)madvise((void *)pInput, inBytes, MADV_SEQUENTIAL);
+
+        if (format == CONV_FORMAT_F64)
+        {
+            ok = TC_ColumnWriter_Append(&writer, (const double *)pInput, frameCount);
+        }
+        else
+        {
+            const float *pVoltage = (const float *)pInput;
+
+            ok = 1U;
+            for (done = 0U; (ok != 0U) && (done < frameCount); done += CONV_COLUMN_FRAMES)
+            {
+                const size_t n = ((frameCount - done) < CONV_COLUMN_FRAMES) ? (frameCount - done) : CONV_COLUMN_FRAMES;
+
+                for (i = 0U; i < (n * channelCount); ++i)
+                {
+                    widened[i] = (double)pVoltage[(done * channelCount) + i];
+                }
+                ok = TC_ColumnWriter_Append(&writer, widened, n);
+            }
+        }
+
+        ok = (uint8_t)(TC_ColumnWriter_Close(&writer) & ok);
+    }
+
+    if (pInput != MAP_FAILED)
+    {
+        (void)munmap((void *)pInput, inBytes);
+    }
+
+    return ok;
+}
+
+int main(int argc, char **argv)
+{
+    static const char *const formats[]     = { "f64", "f32", "i16", "i32" };
+    static const char *const engines[]     = { "pread", "uring", "mmap" };
+    static const char *const engineNames[] = { "pread", "io_uring", "mmap" };
+    static const char *const outputs[]     = { "celsius", "columnar" };
+    ThermocoupleType types[TC_COLUMN_MAX_CHANNELS] = { TC_TYPE_K };
+    ConvSettings settings = { TC_TYPE_K, TC_MODE_FAST, CONV_FORMAT_F64, { 0.001, 0.0, 0.0 } };
+    size_t threadCount    = (size_t)sysconf(_SC_NPROCESSORS_ONLN);
+    size_t depth          = 8U;
+    uint32_t format       = (uint32_t)CONV_FORMAT_F64;
+    uint32_t engine       = CONV_ENGINE_MMAP;
+    uint8_t valid         = 1U;
+    size_t typeCount      = 0U;
+    size_t channelCount   = 1U;
+    uint32_t output       = 0U;
+    size_t failed         = 0U;
+    uint8_t ok            = 0U;
+    uint8_t spread        = 0U;
+    static NumaTopology topology;
+    struct stat info;
+    size_t count;
+    uint64_t start;
+    double seconds;
+    int option;
+    int inputFd;
+    int outputFd;
+
+    while ((option = getopt(argc, argv, "t:f:ej:Nm:q:g:z:c:o:n:")) != -1)
+    {
+        if (option == 't')
+        {
+            typeCount = Conv_ParseTypes(optarg, types);
+        }
+        else if (option == 'f')
+        {
+            valid = (uint8_t)(valid & Conv_ParseName(optarg, formats, 4U, &format));
+        }
+        else if (option == 'e')
+        {
+            settings.mode = TC_MODE_EXACT;
+        }
+        else if (option == 'j')
+        {
+            threadCount = (size_t)strtoul(optarg, NULL, 10);
+        }
+        else if (option == 'N')
+        {
+            spread = 1U;
+        }
+        else if (option == 'm')
+        {
+            valid = (uint8_t)(valid & Conv_ParseName(optarg, engines, 3U, &engine));
+        }
+        else if (option == 'q')
+        {
+            depth = (size_t)strtoul(optarg, NULL, 10);
+        }
+        else if (option == 'g')
+        {
+            settings.scaling.gain = strtod(optarg, NULL);
+        }
+        else if (option == 'z')
+        {
+            settings.scaling.offset = strtod(optarg, NULL);
+        }
+        else if (option == 'c')
+        {
+            settings.scaling.coldJunction = strtod(optarg, NULL);
+        }
+        else if (option == 'o')
+        {
+            valid = (uint8_t)(valid & Conv_ParseName(optarg, outputs, 2U, &output));
+        }
+        else if (option == 'n')
+        {
+            channelCount = (size_t)strtoul(optarg, NULL, 10);
+        }
+        else
+        {
+            valid = 0U;
+        }
+    }
+    settings.format = (SampleFormat)format;
+    settings.type   = types[0];
+
+    /* Several channels need the columnar output; it stores voltages, so it takes mV input */
+    if ((typeCount == 1U) && (channelCount <= TC_COLUMN_MAX_CHANNELS))
+    {
+        for (typeCount = 1U; typeCount < channelCount; ++typeCount)
+        {
+            types[typeCount] = types[0];
+        }
+    }
+    if ((typeCount != channelCount) || (channelCount == 0U) ||
+        ((output == 0U) && (channelCount != 1U)) || ((output != 0U) && (format > (uint32_t)CONV_FORMAT_F32)))
+    {
+        valid = 0U;
+    }
+
+    if ((valid == 0U) || ((argc - optind) != 2))
+    {
+        (void)fprintf(stderr, "usage: %s -t type(s) [-f f64|f32|i16|i32] [-e] [-j threads] [-N] [-m mmap|pread|uring] "
+                              "[-q depth] [-g gain] [-z offset] [-c cold] [-o celsius|columnar] [-n channels] "
+                              "input output\n", argv[0]);
+        return 2;
+    }
+    if (threadCount == 0U)
+    {
+        threadCount = 1U;
+    }
+    if (threadCount > CONV_MAX_THREADS)
+    {
+        threadCount = CONV_MAX_THREADS;
+    }
+
+    inputFd = open(argv[optind], O_RDONLY);
+    if ((inputFd < 0) || (fstat(inputFd, &info) != 0))
+    {
+        perror("tcconv: input");
+        return 1;
+    }
+    count = (size_t)info.st_size / (TCIO_SampleSize(settings.format) * channelCount);
+    if (count == 0U)
+    {
+        (void)fprintf(stderr, "tcconv: input holds no samples\n");
+        return 1;
+    }
+
+    if (output != 0U)
+    {
+        start   = Conv_Now();
+        ok      = Conv_RunColumnar(settings.format, types, channelCount, inputFd, argv[optind + 1], count);
+        seconds = (double)(Conv_Now() - start) * 1e-9;
+        (void)close(inputFd);
+        if (ok == 0U)
+        {
+            perror("tcconv");
+            return 1;
+        }
+
+        printf("%zu frames of %zu channels, columnar: %.3f s, %.2f GB/s in\n", count, channelCount, seconds,
+               ((double)info.st_size / seconds) * 1e-9);
+        return 0;
+    }
+
+    outputFd = Conv_CreateOutput(argv[optind + 1], count * sizeof(double));
+    if (outputFd < 0)
+    {
+        perror("tcconv: output");
+        return 1;
+    }
+
+    start = Conv_Now();
+    if (engine == CONV_ENGINE_MMAP)
+    {
+        if (spread != 0U)
+        {
+            TCNUMA_Discover(&topology);
+        }
+        ok = Conv_RunMapped(&settings, inputFd, outputFd, count, threadCount, (spread != 0U) ? &topology : NULL,
+                            &failed);
+    }
+    else
+    {
+        IoEngine ioEngine = (IoEngine)engine;
+        ok     = TCIO_ConvertFile(&ioEngine, &settings, inputFd, outputFd, count, depth, &failed);
+        engine = (uint32_t)ioEngine;
+    }
+    seconds = (double)(Conv_Now() - start) * 1e-9;
+
+    (void)close(outputFd);
+    (void)close(inputFd);
+    if (ok == 0U)
+    {
+        perror("tcconv");
+        return 1;
+    }
+
+    printf("%zu samples, %s, %zu threads: %.3f s, %.2f GB/s in, %.2f GB/s out, %.1f Msamples/s, %zu failed\n",
+           count, engineNames[engine], (engine == CONV_ENGINE_MMAP) ? threadCount : (size_t)1U, seconds,
+           ((double)info.st_size / seconds) * 1e-9, ((double)(count * sizeof(double)) / seconds) * 1e-9,
+           ((double)count / seconds) * 1e-6, failed);
+
+    return 0;
+}
+
+
+/* tcconv.c */
@@ -0,0 +1,556 @@
+/**
+ * @file    tcconv_io.c
+ * @author  Amirhossein Askari
+ * @version v1.0.0
+ * @date    2026-10-16
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Source file for the chunked file conversion engines of tcconv.
+ *
+ * @details
+ * The io_uring engine keeps a pool of @c depth chunk buffers, registered with the ring
+ * so the kernel does not map them on every request. Each buffer cycles through
+ * free -> reading -> ready -> writing -> free. Every loop iteration queues reads into
+ * free buffers, submits them together with the writes queued so far, reaps completions
+ * and converts at most one ready buffer before going back to the ring, so conversion
+ * always overlaps the I/O of the other buffers. Chunks complete in any order; each
+ * buffer carries its own file offset. Short transfers are resubmitted for the rest.
+ */
+
+
+/* ------------------------------------- Includes -------------------------------------- */
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE                  ///< syscall
+#endif
+#include "tcconv_io.h"              ///< Header file for the engines
+#include <errno.h>                  ///< EINTR
+#include <linux/io_uring.h>         ///< io_uring ABI
+#include <stdatomic.h>              ///< Ring index ordering
+#include <stdlib.h>                 ///< aligned_alloc, free
+#include <string.h>                 ///< memset
+#include <sys/mman.h>               ///< Ring mappings
+#include <sys/syscall.h>            ///< __NR_io_uring_*
+#include <sys/uio.h>                ///< iovec
+#include <unistd.h>                 ///< pread, pwrite, syscall
+
+
+
+/* -------------------------------------- Defines -------------------------------------- */
+
+#define  IO_BUFFER_ALIGN     4096U         ///< Page-aligned buffers, also valid for O_DIRECT
+#define  IO_WIDEN_BLOCK      (16U * TC_BATCH_BLOCK_SIZE)    ///< f32 samples widened per step
+
+
+
+/* --------------------------------------- Types --------------------------------------- */
+
+/** @brief Mapped io_uring instance */
+typedef struct
+{
+    int fd;                              /**< Ring descriptor */
+    uint32_t *pSqTail;                   /**< Submission tail, advanced by us */
+    uint32_t sqMask;                     /**< Submission index mask */
+    uint32_t *pSqArray;                  /**< Submission index array */
+    struct io_uring_sqe *pSqes;          /**< Submission entries */
+    uint32_t *pCqHead;                   /**< Completion head, advanced by us */
+    uint32_t *pCqTail;                   /**< Completion tail, advanced by the kernel */
+    uint32_t cqMask;                     /**< Completion index mask */
+    struct io_uring_cqe *pCqes;          /**< Completion entries */
+    void *pSqMap;                        /**< Submission ring mapping */
+    size_t sqMapSize;                    /**< Its size */
+    void *pCqMap;                        /**< Completion ring mapping, or NULL if shared with @c pSqMap */
+    size_t cqMapSize;                    /**< Its size */
+    size_t sqesSize;                     /**< Size of the @c pSqes mapping */
+    uint32_t queued;                     /**< Entries queued since the last submit */
+    size_t inflight;                     /**< Entries submitted or queued and not yet completed */
+} IoRing;
+
+/** @brief States of a chunk buffer */
+typedef enum
+{
+    IO_SLOT_FREE = 0U,    /**< Available for the next chunk */
+    IO_SLOT_READING,      /**< Read in flight */
+    IO_SLOT_READY,        /**< Read complete, waiting for conversion */
+    IO_SLOT_WRITING,      /**< Write in flight */
+} IoSlotState;
+
+/** @brief One chunk buffer */
+typedef struct
+{
+    IoSlotState state;      /**< Position in the cycle */
+    uint8_t *pInput;        /**< Input samples; equals @c pOutput for in-place formats */
+    double *pOutput;        /**< Converted samples */
+    size_t first;           /**< First sample of the chunk */
+    size_t count;           /**< Samples in the chunk */
+    size_t done;            /**< Bytes transferred by the current operation */
+} IoSlot;
+
+
+
+/* ------------------------------------- Functions ------------------------------------- */
+
+/**
+ * @brief  Returns the size of one input sample in bytes.
+ *
+ * @param[in] format  Input format.
+ *
+ * @return Sample size.
+ */
+size_t TCIO_SampleSize(SampleFormat format)
+{
+    static const size_t sizes[] = { sizeof(double), sizeof(float), sizeof(int16_t), sizeof(int32_t) };
+    return sizes[format];
+}
+
+/**
+ * @brief  Converts a block of input samples of any format.
+ *
+ * @param[in]  pSettings  Conversion settings.
+ * @param[in]  pInput     @p count samples in @c pSettings->format.
+ * @param[out] pOutput    Receives the temperatures; may alias @p pInput for @c CONV_FORMAT_F64.
+ * @param[in]  count      Number of samples.
+ *
+ * @return Number of samples set to @c TC_CONVERSION_FAILED.
+ */
+size_t TCIO_ConvertBlock(const ConvSettings *pSettings, const void *pInput, double *pOutput, size_t count)
+{
+    size_t failed = 0U;
+    size_t done;
+    size_t i;
+
+    if (pSettings->format == CONV_FORMAT_F64)
+    {
+        failed = TC_CalculateTemperatureArray(pSettings->type, (const double *)pInput, pOutput, count, pSettings->mode);
+    }
+    else if (pSettings->format == CONV_FORMAT_F32)
+    {
+        const float *pVoltage = (const float *)pInput;
+
+        for (done = 0U; done < count; done += IO_WIDEN_BLOCK)
+        {
+            const size_t n = ((count - done) < IO_WIDEN_BLOCK) ? (count - done) : IO_WIDEN_BLOCK;
+
+            /* Widen into the output block while it is in L1, then convert it in place */
+            for (i = 0U; i < n; ++i)
+            {
+                pOutput[done + i] = (double)pVoltage[done + i];
+            }
+            failed += TC_CalculateTemperatureArray(pSettings->type, &pOutput[done], &pOutput[done], n, pSettings->mode);
+        }
+    }
+    else if (pSettings->format == CONV_FORMAT_I16)
+    {
+        failed = TC_CalculateTemperatureInt16(pSettings->type, (const int16_t *)pInput, pOutput, count,
+                                              &pSettings->scaling, pSettings->mode);
+    }
+    else
+    {
+        failed = TC_CalculateTemperatureInt32(pSettings->type, (const int32_t *)pInput, pOutput, count,
+                                              &pSettings->scaling, pSettings->mode);
+    }
+
+    return failed;
+}
+
+/**
+ * @brief  Transfers a whole range with pread or pwrite, resuming after short transfers.
+ *
+ * @param[in] fd       File.
+ * @param[in] pBuffer  Buffer.
+ * @param[in] bytes    Number of bytes.
+ * @param[in] offset   File offset.
+ * @param[in] isWrite  1 to write, 0 to read.
+ *
+ * @return 1 on success, otherwise 0.
+ */
+static uint8_t IO_TransferAll(int fd, uint8_t *pBuffer, size_t bytes, size_t offset, uint8_t isWrite)
+{
+    size_t done = 0U;
+    ssize_t n   = 1;
+
+    while ((done < bytes) && (n > 0))
+    {
+        n = (isWrite != 0U) ? pwrite(fd, &pBuffer[done], bytes - done, (off_t)(offset + done))
+                          : pread(fd, &pBuffer[done], bytes - done, (off_t)(offset + done));
+        if (n > 0)
+        {
+            done += (size_t)n;
+        }
+    }
+
+    return (done == bytes) ? 1U : 0U;
+}
+
+/**
+ * @brief  Converts a file one chunk at a time with pread/pwrite.
+ *
+ * @return 1 on success, otherwise 0.
+ */
+static uint8_t IO_ConvertPread(const ConvSettings *pSettings, int inputFd, int outputFd, size_t count, size_t *pFailed)
+{
+    const size_t sampleSize = TCIO_SampleSize(pSettings->format);
+    const size_t inBytes    = (sampleSize == sizeof(double)) ? 0U : (TCIO_CHUNK_SAMPLES * sampleSize);
+    uint8_t *pBuffer        = (uint8_t *)aligned_alloc(IO_BUFFER_ALIGN, inBytes + (TCIO_CHUNK_SAMPLES * sizeof(double)));
+    double *pOutput         = (double *)&pBuffer[inBytes];
+    uint8_t ok              = (pBuffer != NULL) ? 1U : 0U;
+    size_t first;
+
+    *pFailed = 0U;
+    for (first = 0U; (ok != 0U) && (first < count); first += TCIO_CHUNK_SAMPLES)
+    {
+        const size_t n = ((count - first) < TCIO_CHUNK_SAMPLES) ? (count - first) : TCIO_CHUNK_SAMPLES;
+
+        ok = IO_TransferAll(inputFd, pBuffer, n * sampleSize, first * sampleSize, 0U);
+        if (ok != 0U)
+        {
+            *pFailed += TCIO_ConvertBlock(pSettings, pBuffer, pOutput, n);
+            ok = IO_TransferAll(outputFd, (uint8_t *)pOutput, n * sizeof(double), first * sizeof(double), 1U);
+        }
+    }
+
+    free(pBuffer);
+
+    return ok;
+}
+
+/**
+ * @brief  Unmaps and closes a ring.
+ *
+ * @param[in] pRing  Ring.
+ */
+static void IO_RingClose(IoRing *pRing)
+{
+    if (pRing->pSqes != NULL)
+    {
+        (void)munmap(pRing->pSqes, pRing->sqesSize);
+    }
+    if (pRing->pCqMap != NULL)
+    {
+        (void)munmap(pRing->pCqMap, pRing->cqMapSize);
+    }
+    if (pRing->pSqMap != NULL)
+    {
+        (void)munmap(pRing->pSqMap, pRing->sqMapSize);
+    }
+    if (pRing->fd >= 0)
+    {
+        (void)close(pRing->fd);
+    }
+}
+
+/**
+ * @brief  Creates and maps a ring.
+ *
+ * @param[out] pRing    Ring.
+ * @param[in]  entries  Submission queue entries.
+ *
+ * @return 1 on success, or 0 if io_uring is unavailable.
+ */
+static uint8_t IO_RingOpen(IoRing *pRing, uint32_t entries)
+{
+    struct io_uring_params params;
+    uint8_t result = 0U;
+    void *pMap;
+
+    (void)memset(pRing, 0, sizeof(*pRing));
+    (void)memset(&params, 0, sizeof(params));
+    pRing->fd = (int)syscall(__NR_io_uring_setup, entries, &params);
+
+    if (pRing->fd >= 0)
+    {
+        pRing->sqMapSize = params.sq_off.array + (params.sq_entries * sizeof(uint32_t));
+        pRing->cqMapSize = params.cq_off.cqes + (params.cq_entries * sizeof(struct io_uring_cqe));
+        pRing->sqesSize  = params.sq_entries * sizeof(struct io_uring_sqe);
+        if ((params.features & IORING_FEAT_SINGLE_MMAP) != 0U)
+        {
+            pRing->sqMapSize = (pRing->sqMapSize > pRing->cqMapSize) ? pRing->sqMapSize : pRing->cqMapSize;
+        }
+
+        pMap = mmap(NULL, pRing->sqMapSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, pRing->fd,
+                    IORING_OFF_SQ_RING);
+        pRing->pSqMap = (pMap != MAP_FAILED) ? pMap : NULL;
+
+        if ((pRing->pSqMap != NULL) && ((params.features & IORING_FEAT_SINGLE_MMAP) == 0U))
+        {
+            pMap = mmap(NULL, pRing->cqMapSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, pRing->fd,
+                        IORING_OFF_CQ_RING);
+            pRing->pCqMap = (pMap != MAP_FAILED) ? pMap : NULL;
+        }
+
+        pMap = mmap(NULL, pRing->sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, pRing->fd,
+                    IORING_OFF_SQES);
+        pRing->pSqes = (pMap != MAP_FAILED) ? (struct io_uring_sqe *)pMap : NULL;
+    }
+
+    if ((pRing->pSqMap != NULL) && (pRing->pSqes != NULL) &&
+        ((pRing->pCqMap != NULL) || ((params.features & IORING_FEAT_SINGLE_MMAP) != 0U)))
+    {
+        uint8_t *pSq = (uint8_t *)pRing->pSqMap;
+        uint8_t *pCq = (pRing->pCqMap != NULL) ? (uint8_t *)pRing->pCqMap : pSq;
+
+        pRing->pSqTail  = (uint32_t *)&pSq[params.sq_off.tail];
+        pRing->sqMask   = *(uint32_t *)&pSq[params.sq_off.ring_mask];
+        pRing->pSqArray = (uint32_t *)&pSq[params.sq_off.array];
+        pRing->pCqHead  = (uint32_t *)&pCq[params.cq_off.head];
+        pRing->pCqTail  = (uint32_t *)&pCq[params.cq_off.tail];
+        pRing->cqMask   = *(uint32_t *)&pCq[params.cq_off.ring_mask];
+        pRing->pCqes    = (struct io_uring_cqe *)&pCq[params.cq_off.cqes];
+        result = 1U;
+    }
+    else
+    {
+        IO_RingClose(pRing);
+    }
+
+    return result;
+}
+
+/**
+ * @brief  Queues a read or write of the remainder of a slot's current transfer.
+ *
+ * @param[in] pRing       Ring.
+ * @param[in] pSlot       Slot; @c state selects read or write.
+ * @param[in] index       Slot index, used as user data and registered buffer index.
+ * @param[in] fd          File.
+ * @param[in] fixed       1 if the buffers are registered.
+ * @param[in] sampleSize  Input sample size.
+ */
+static void IO_RingQueue(IoRing *pRing, const IoSlot *pSlot, size_t index, int fd, uint8_t fixed, size_t sampleSize)
+{
+    const uint32_t tail       = *pRing->pSqTail;
+    struct io_uring_sqe *pSqe = &pRing->pSqes[tail & pRing->sqMask];
+    const uint8_t reading     = (pSlot->state == IO_SLOT_READING) ? 1U : 0U;
+    const size_t unit         = (reading != 0U) ? sampleSize : sizeof(double);
+    uint8_t *pBuffer          = (reading != 0U) ? pSlot->pInput : (uint8_t *)pSlot->pOutput;
+
+    (void)memset(pSqe, 0, sizeof(*pSqe));
+    if (reading != 0U)
+    {
+        pSqe->opcode = (uint8_t)((fixed != 0U) ? IORING_OP_READ_FIXED : IORING_OP_READ);
+    }
+    else
+    {
+        pSqe->opcode = (uint8_t)((fixed != 0U) ? IORING_OP_WRITE_FIXED : IORING_OP_WRITE);
+    }
+    pSqe->fd        = fd;
+    pSqe->off       = (uint64_t)((pSlot->first * unit) + pSlot->done);
+    pSqe->addr      = (uint64_t)(uintptr_t)&pBuffer[pSlot->done];
+    pSqe->len       = (uint32_t)((pSlot->count * unit) - pSlot->done);
+    pSqe->buf_index = (uint16_t)((fixed != 0U) ? index : 0U);
+    pSqe->user_data = (uint64_t)index;
+
+    pRing->pSqArray[tail & pRing->sqMask] = tail & pRing->sqMask;
+    atomic_store_explicit((_Atomic uint32_t *)pRing->pSqTail, tail + 1U, memory_order_release);
+    pRing->queued++;
+    pRing->inflight++;
+}
+
+/**
+ * @brief  Submits the queued entries and optionally waits for completions.
+ *
+ * @details
+ * Calls interrupted by a signal are retried. Entries the kernel did not take stay
+ * queued for the next call.
+ *
+ * @param[in,out] pRing        Ring.
+ * @param[in]     minComplete  Completions to wait for.
+ * @param[in]     flags        @c io_uring_enter flags.
+ *
+ * @return Entries submitted, or -1 on an error other than @c EINTR.
+ */
+static long IO_RingEnter(IoRing *pRing, uint32_t minComplete, uint32_t flags)
+{
+    long submitted;
+
+    do
+    {
+        submitted = syscall(__NR_io_uring_enter, pRing->fd, pRing->queued, minComplete, flags, NULL, 0);
+    } while ((submitted < 0) && (errno == EINTR));
+
+    if (submitted > 0)
+    {
+        pRing->queued -= ((size_t)submitted < pRing->queued) ? (uint32_t)submitted : pRing->queued;
+    }
+
+    return submitted;
+}
+
+/**
+ * @brief  Converts a file through io_uring with several chunks in flight.
+ *
+ * @return 1 on success, 0 on an I/O error, or 2 if io_uring is unavailable.
+ */
+static uint8_t IO_ConvertUring(const ConvSettings *pSettings, int inputFd, int outputFd, size_t count, size_t depth,
+                               size_t *pFailed)
+{
+    const size_t sampleSize = TCIO_SampleSize(pSettings->format);
+    const size_t inBytes    = (sampleSize == sizeof(double)) ? 0U : (TCIO_CHUNK_SAMPLES * sampleSize);
+    const size_t slotBytes  = inBytes + (TCIO_CHUNK_SAMPLES * sizeof(double));
+    IoSlot slots[TCIO_MAX_DEPTH];
+    struct iovec iov[TCIO_MAX_DEPTH];
+    uint8_t *pPool = NULL;
+    uint8_t result = 2U;
+    uint8_t fixed  = 0U;
+    size_t next    = 0U;
+    size_t written = 0U;
+    IoRing ring;
+    size_t s;
+
+    if (IO_RingOpen(&ring, (uint32_t)(2U * depth)) != 0U)
+    {
+        pPool  = (uint8_t *)aligned_alloc(IO_BUFFER_ALIGN, depth * slotBytes);
+        result = (pPool != NULL) ? 1U : 0U;
+    }
+
+    if (pPool != NULL)
+    {
+        for (s = 0U; s < depth; ++s)
+        {
+            slots[s].state   = IO_SLOT_FREE;
+            slots[s].pInput  = &pPool[s * slotBytes];
+            slots[s].pOutput = (double *)&pPool[(s * slotBytes) + inBytes];
+            iov[s].iov_base  = slots[s].pInput;
+            iov[s].iov_len   = slotBytes;
+        }
+
+        /* Registration pins the pages once; without it (e.g. RLIMIT_MEMLOCK) use plain reads/writes */
+        fixed = (syscall(__NR_io_uring_register, ring.fd, IORING_REGISTER_BUFFERS, iov, (unsigned)depth) == 0) ? 1U : 0U;
+
+        *pFailed = 0U;
+        while ((result == 1U) && (written < count))
+        {
+            IoSlot *pReady = NULL;
+            uint32_t head;
+            uint32_t tail;
+
+            for (s = 0U; s < depth; ++s)
+            {
+                if ((slots[s].state == IO_SLOT_FREE) && (next < count))
+                {
+                    slots[s].state = IO_SLOT_READING;
+                    slots[s].first = next;
+                    slots[s].count = ((count - next) < TCIO_CHUNK_SAMPLES) ? (count - next) : TCIO_CHUNK_SAMPLES;
+                    slots[s].done  = 0U;
+                    next += slots[s].count;
+                    IO_RingQueue(&ring, &slots[s], s, inputFd, fixed, sampleSize);
+                }
+                if ((pReady == NULL) && (slots[s].state == IO_SLOT_READY))
+                {
+                    pReady = &slots[s];
+                }
+            }
+
+            /* Block only when there is nothing to convert in the meantime */
+            if (IO_RingEnter(&ring, (pReady == NULL) ? 1U : 0U, (pReady == NULL) ? IORING_ENTER_GETEVENTS : 0U) < 0)
+            {
+                result = 0U;
+            }
+
+            head = *ring.pCqHead;
+            tail = atomic_load_explicit((_Atomic uint32_t *)ring.pCqTail, memory_order_acquire);
+            while (head != tail)
+            {
+                const struct io_uring_cqe *pCqe = &ring.pCqes[head & ring.cqMask];
+                IoSlot *pSlot     = &slots[pCqe->user_data];
+                const size_t unit = (pSlot->state == IO_SLOT_READING) ? sampleSize : sizeof(double);
+
+                ring.inflight--;
+                if (pCqe->res <= 0)
+                {
+                    result = 0U;    /* I/O error, or end of file before the expected size */
+                }
+                else
+                {
+                    pSlot->done += (size_t)pCqe->res;
+                    if (pSlot->done < (pSlot->count * unit))
+                    {
+                        IO_RingQueue(&ring, pSlot, (size_t)(pSlot - slots),
+                                     (pSlot->state == IO_SLOT_READING) ? inputFd : outputFd, fixed, sampleSize);
+                    }
+                    else if (pSlot->state == IO_SLOT_READING)
+                    {
+                        pSlot->state = IO_SLOT_READY;
+                    }
+                    else
+                    {
+                        pSlot->state = IO_SLOT_FREE;
+                        written += pSlot->count;
+                    }
+                }
+                head++;
+            }
+            atomic_store_explicit((_Atomic uint32_t *)ring.pCqHead, head, memory_order_release);
+
+            if ((result == 1U) && (pReady != NULL))
+            {
+                *pFailed += TCIO_ConvertBlock(pSettings, pReady->pInput, pReady->pOutput, pReady->count);
+                pReady->state = IO_SLOT_WRITING;
+                pReady->done  = 0U;
+                IO_RingQueue(&ring, pReady, (size_t)(pReady - slots), outputFd, fixed, sampleSize);
+            }
+        }
+
+        /* After an error, let the requests still in flight finish before their buffers are freed */
+        while ((ring.inflight != 0U) && (IO_RingEnter(&ring, 1U, IORING_ENTER_GETEVENTS) >= 0))
+        {
+            const uint32_t tail = atomic_load_explicit((_Atomic uint32_t *)ring.pCqTail, memory_order_acquire);
+
+            ring.inflight -= (size_t)(tail - *ring.pCqHead);
+            atomic_store_explicit((_Atomic uint32_t *)ring.pCqHead, tail, memory_order_release);
+        }
+    }
+
+    /* Requests still in flight after a hard error are cancelled and waited for by
+       closing the ring, which therefore has to happen before the pool is freed */
+    if (result != 2U)
+    {
+        IO_RingClose(&ring);
+        free(pPool);
+    }
+
+    return result;
+}
+
+/**
+ * @brief  Converts a whole file through a chunk pipeline.
+ *
+ * @param[in,out] pEngine    Engine to use; set to @c TCIO_ENGINE_PREAD if io_uring is unavailable.
+ * @param[in]     pSettings  Conversion settings.
+ * @param[in]     inputFd    Input file, read from offset 0.
+ * @param[in]     outputFd   Output file, written from offset 0; should be preallocated.
+ * @param[in]     count      Number of samples.
+ * @param[in]     depth      Chunks in flight for @c TCIO_ENGINE_URING (1 .. @c TCIO_MAX_DEPTH).
+ * @param[out]    pFailed    Receives the number of samples set to @c TC_CONVERSION_FAILED.
+ *
+ * @return 1 on success, or 0 on an I/O or allocation error.
+ */
+uint8_t TCIO_ConvertFile(IoEngine *pEngine, const ConvSettings *pSettings, int inputFd, int outputFd, size_t count,
+                         size_t depth, size_t *pFailed)
+{
+    uint8_t result = 2U;
+
+    if (depth < 1U)
+    {
+        depth = 1U;
+    }
+    if (depth > TCIO_MAX_DEPTH)
+    {
+        depth = TCIO_MAX_DEPTH;
+    }
+
+    if (*pEngine == TCIO_ENGINE_URING)
+    {
+        result = IO_ConvertUring(pSettings, inputFd, outputFd, count, depth, pFailed);
+    }
+    if (result == 2U)
+    {
+        *pEngine = TCIO_ENGINE_PREAD;
+        result   = IO_ConvertPread(pSettings, inputFd, outputFd, count, pFailed);
+    }
+
+    return result;
+}
+
+
+/* tcconv_io.c */
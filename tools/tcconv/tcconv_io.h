@@ -0,0 +1,104 @@
+/**
+ * @file    tcconv_io.h
+ * @author  Amirhossein Askari
+ * @version v1.0.0
+ * @date    2026-10-16
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Header file for the chunked file conversion engines of tcconv.
+ *
+ * @details
+ * Converts a raw recording into a file of doubles (°C) chunk by chunk through a pool of
+ * buffers, as an alternative to memory-mapping both files:
+ *  - @c TCIO_ENGINE_PREAD: one chunk at a time with @c pread, convert, @c pwrite.
+ *  - @c TCIO_ENGINE_URING: io_uring (raw system calls, no liburing) with @c depth chunks
+ *    in flight in registered buffers. While one chunk is converted, the reads and writes
+ *    of the others proceed, so storage latency is hidden behind the conversion.
+ *
+ * @note Linux only. Kernels or sandboxes without io_uring fall back to @c TCIO_ENGINE_PREAD.
+ */
+
+
+#ifndef _TCCONV_IO_H
+#define _TCCONV_IO_H
+
+/* ------------------------------------- Includes ------------------------------------- */
+
+#include "thermocouple_sensor.h"    ///< Thermocouple types and batch conversions
+
+
+/* -------------------------------------- Defines ------------------------------------- */
+
+#define  TCIO_CHUNK_SAMPLES    (1024U * 1024U)    ///< Samples per chunk (8 MiB of output)
+#define  TCIO_MAX_DEPTH        64U                ///< Upper bound on chunks in flight
+
+
+/* --------------------------------------- Types -------------------------------------- */
+
+/** @brief Sample formats of the input file */
+typedef enum
+{
+    CONV_FORMAT_F64 = 0U,    /**< double, mV */
+    CONV_FORMAT_F32,         /**< float, mV */
+    CONV_FORMAT_I16,         /**< int16_t ADC codes */
+    CONV_FORMAT_I32,         /**< int32_t ADC codes */
+} SampleFormat;
+
+/** @brief What to convert and how */
+typedef struct
+{
+    ThermocoupleType type;    /**< Thermocouple type */
+    ConversionMode mode;      /**< Conversion mode */
+    SampleFormat format;      /**< Input format */
+    AdcScaling scaling;       /**< Scaling of integer formats */
+} ConvSettings;
+
+/** @brief File I/O engines */
+typedef enum
+{
+    TCIO_ENGINE_PREAD = 0U,    /**< Synchronous pread/pwrite */
+    TCIO_ENGINE_URING,         /**< io_uring with several chunks in flight */
+} IoEngine;
+
+
+/* ------------------------------------- Prototype ------------------------------------- */
+
+/**
+ * @brief  Returns the size of one input sample in bytes.
+ *
+ * @param[in] format  Input format.
+ *
+ * @return Sample size.
+ */
+size_t TCIO_SampleSize(SampleFormat format);
+
+/**
+ * @brief  Converts a block of input samples of any format.
+ *
+ * @param[in]  pSettings  Conversion settings.
+ * @param[in]  pInput     @p count samples in @c pSettings->format.
+ * @param[out] pOutput    Receives the temperatures; may alias @p pInput for @c CONV_FORMAT_F64.
+ * @param[in]  count      Number of samples.
+ *
+ * @return Number of samples set to @c TC_CONVERSION_FAILED.
+ */
+size_t TCIO_ConvertBlock(const ConvSettings *pSettings, const void *pInput, double *pOutput, size_t count);
+
+/**
+ * @brief  Converts a whole file through a chunk pipeline.
+ *
+ * @param[in,out] pEngine    Engine to use; set to @c TCIO_ENGINE_PREAD if io_uring is unavailable.
+ * @param[in]     pSettings  Conversion settings.
+ * @param[in]     inputFd    Input file, read from offset 0.
+ * @param[in]     outputFd   Output file, written from offset 0; should be preallocated.
+ * @param[in]     count      Number of samples.
+ * @param[in]     depth      Chunks in flight for @c TCIO_ENGINE_URING (1 .. @c TCIO_MAX_DEPTH).
+ * @param[out]    pFailed    Receives the number of samples set to @c TC_CONVERSION_FAILED.
+ *
+ * @return 1 on success, or 0 on an I/O or allocation error.
+ */
+uint8_t TCIO_ConvertFile(IoEngine *pEngine, const ConvSettings *pSettings, int inputFd, int outputFd, size_t count,
+                         size_t depth, size_t *pFailed);
+
+
+#endif /* tcconv_io.h */
@@ -0,0 +1,343 @@
+/**
+ * @file    tcconv_numa.c
+ * @author  Amirhossein Askari
+ * @version v1.0.0
+ * @date    2026-10-16
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Source file for NUMA-aware buffers and work partitioning of tcconv.
+ *
+ * @details
+ * Nodes come from @c /sys/devices/system/node/nodeN/cpulist, restricted to the CPUs the
+ * process may run on; memory-only nodes are left out. Policies are set with the @c mbind
+ * system call, which applies to pages faulted in afterwards, and @c MPOL_MF_MOVE also
+ * migrates pages that are already present.
+ */
+
+
+/* ------------------------------------- Includes -------------------------------------- */
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE                  ///< cpu_set_t, pthread_setaffinity_np, syscall
+#endif
+#include "tcconv_numa.h"            ///< Header file for the NUMA helpers
+#include <pthread.h>                ///< pthread_setaffinity_np
+#include <stdio.h>                  ///< fopen, fgets
+#include <stdlib.h>                 ///< strtoul
+#include <string.h>                 ///< memset
+#include <sys/mman.h>               ///< mmap, madvise
+#include <sys/syscall.h>            ///< SYS_mbind, SYS_move_pages
+#include <unistd.h>                 ///< syscall, sysconf
+
+
+
+/* -------------------------------------- Defines -------------------------------------- */
+
+#define  NUMA_MPOL_BIND          2     ///< MPOL_BIND of <linux/mempolicy.h>
+#define  NUMA_MPOL_INTERLEAVE    3     ///< MPOL_INTERLEAVE
+#define  NUMA_MPOL_MF_MOVE       2U    ///< MPOL_MF_MOVE: migrate pages already present
+#define  NUMA_MAX_SAMPLES        4096U ///< Pages queried by @ref TCNUMA_LocalFraction
+#define  NUMA_MASK_WORDS         ((TCNUMA_MAX_NODES + 63U) / 64U)    ///< Words of a node mask
+
+
+
+/* ------------------------------------- Functions ------------------------------------- */
+
+/**
+ * @brief  Parses a sysfs CPU list such as "0-3,8-11".
+ *
+ * @param[in]  pPath  File to read.
+ * @param[out] pCpus  Receives the CPUs.
+ *
+ * @return 1 if the file was read, otherwise 0.
+ */
+static uint8_t Numa_ReadCpuList(const char *pPath, cpu_set_t *pCpus)
+{
+    char text[4096];
+    FILE *pFile    = fopen(pPath, "r");
+    uint8_t result = 0U;
+    char *pCursor  = text;
+
+    CPU_ZERO(pCpus);
+    if (pFile != NULL)
+    {
+        if (fgets(text, (int)sizeof(text), pFile) != NULL)
+        {
+            result = 1U;
+            while ((*pCursor >= '0') && (*pCursor <= '9'))
+            {
+                unsigned long low  = strtoul(pCursor, &pCursor, 10);
+                unsigned long high = low;
+
+                if (*pCursor == '-')
+                {
+                    high = strtoul(pCursor + 1, &pCursor, 10);
+                }
+                for (; (low <= high) && (low < (unsigned long)CPU_SETSIZE); ++low)
+                {
+                    CPU_SET((int)low, pCpus);
+                }
+                pCursor += (*pCursor == ',') ? 1 : 0;
+            }
+        }
+        (void)fclose(pFile);
+    }
+
+    return result;
+}
+
+/**
+ * @brief  Reads the node topology.
+ *
+ * @param[out] pTopology  Receives the nodes.
+ */
+void TCNUMA_Discover(NumaTopology *pTopology)
+{
+    char path[128];
+    cpu_set_t allowed;
+    uint32_t n;
+
+    (void)memset(pTopology, 0, sizeof(*pTopology));
+    CPU_ZERO(&allowed);
+    (void)sched_getaffinity(0, sizeof(allowed), &allowed);
+
+    for (n = 0U; n < TCNUMA_MAX_NODES; ++n)
+    {
+        cpu_set_t *pCpus = &pTopology->cpus[pTopology->nodeCount];
+
+        (void)snprintf(path, sizeof(path), "/sys/devices/system/node/node%u/cpulist", (unsigned)n);
+        if (Numa_ReadCpuList(path, pCpus) != 0U)
+        {
+            CPU_AND(pCpus, pCpus, &allowed);
+            if (CPU_COUNT(pCpus) != 0)
+            {
+                pTopology->node[pTopology->nodeCount] = n;
+                pTopology->nodeCount++;
+            }
+        }
+    }
+
+    if (pTopology->nodeCount == 0U)
+    {
+        pTopology->nodeCount = 1U;
+        pTopology->node[0]   = 0U;
+        pTopology->cpus[0]   = allowed;
+    }
+}
+
+/**
+ * @brief  Splits a conversion into one range per worker.
+ *
+ * @param[in]  pTopology  Topology, or NULL to give every range node 0.
+ * @param[in]  count      Samples to convert.
+ * @param[in]  workers    Number of workers.
+ * @param[in]  align      Alignment of range boundaries in samples.
+ * @param[out] pRanges    Receives @p workers ranges.
+ */
+void TCNUMA_Partition(const NumaTopology *pTopology, size_t count, size_t workers, size_t align,
+                      NumaRange *pRanges)
+{
+    const size_t per = ((((count + workers) - 1U) / workers) + align - 1U) & ~(align - 1U);
+    size_t w;
+
+    for (w = 0U; w < workers; ++w)
+    {
+        const size_t first = ((w * per) < count) ? (w * per) : count;
+
+        pRanges[w].first = first;
+        pRanges[w].count = ((count - first) < per) ? (count - first) : per;
+        pRanges[w].node  = (pTopology != NULL) ? ((w * pTopology->nodeCount) / workers) : 0U;
+    }
+}
+
+/**
+ * @brief  Pins the calling thread to the CPUs of a node.
+ *
+ * @param[in] pTopology  Topology.
+ * @param[in] node       Node index in @p pTopology.
+ *
+ * @return 1 on success, otherwise 0.
+ */
+uint8_t TCNUMA_PinThread(const NumaTopology *pTopology, size_t node)
+{
+    return (pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &pTopology->cpus[node]) == 0) ? 1U : 0U;
+}
+
+/**
+ * @brief  Maps an anonymous buffer. No page is touched.
+ *
+ * @details
+ * Transparent huge pages need 2 MiB aligned extents, so that mapping is over-allocated
+ * by one huge page and trimmed to an aligned start.
+ *
+ * @param[out] pBuffer  Buffer.
+ * @param[in]  bytes    Size wanted.
+ * @param[in]  pages    Page size wanted.
+ *
+ * @return 1 on success, otherwise 0.
+ */
+uint8_t TCNUMA_Alloc(NumaBuffer *pBuffer, size_t bytes, NumaPages pages)
+{
+    const size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    const size_t huge = ((bytes + TCNUMA_HUGE_BYTES) - 1U) & ~((size_t)TCNUMA_HUGE_BYTES - 1U);
+    void *pMap        = MAP_FAILED;
+
+    (void)memset(pBuffer, 0, sizeof(*pBuffer));
+
+    if (pages == TCNUMA_PAGES_HUGETLB)
+    {
+        pMap = mmap(NULL, huge, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (pMap != MAP_FAILED)
+        {
+            pBuffer->pData = pMap;
+            pBuffer->bytes = huge;
+            pBuffer->pages = TCNUMA_PAGES_HUGETLB;
+        }
+        else
+        {
+            pages = TCNUMA_PAGES_THP;
+        }
+    }
+
+    if (pages == TCNUMA_PAGES_THP)
+    {
+        pMap = mmap(NULL, huge + TCNUMA_HUGE_BYTES, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (pMap != MAP_FAILED)
+        {
+            const uintptr_t start   = (uintptr_t)pMap;
+            const uintptr_t aligned = (start + TCNUMA_HUGE_BYTES - 1U) & ~((uintptr_t)TCNUMA_HUGE_BYTES - 1U);
+
+            if (aligned != start)
+            {
+                (void)munmap(pMap, (size_t)(aligned - start));
+            }
+            (void)munmap((void *)(aligned + huge), (size_t)((start + huge + TCNUMA_HUGE_BYTES) - (aligned + huge)));
+            (void)madvise((void *)aligned, huge, MADV_HUGEPAGE);
+
+            pBuffer->pData = (void *)aligned;
+            pBuffer->bytes = huge;
+            pBuffer->pages = TCNUMA_PAGES_THP;
+        }
+    }
+    else if (pages == TCNUMA_PAGES_NORMAL)
+    {
+        const size_t rounded = ((bytes + page) - 1U) & ~(page - 1U);
+
+        pMap = mmap(NULL, rounded, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (pMap != MAP_FAILED)
+        {
+            (void)madvise(pMap, rounded, MADV_NOHUGEPAGE);
+            pBuffer->pData = pMap;
+            pBuffer->bytes = rounded;
+            pBuffer->pages = TCNUMA_PAGES_NORMAL;
+        }
+    }
+    else
+    {
+        /* Explicit huge pages, already mapped */
+    }
+
+    return (pBuffer->pData != NULL) ? 1U : 0U;
+}
+
+/**
+ * @brief  Unmaps a buffer.
+ *
+ * @param[in] pBuffer  Buffer.
+ */
+void TCNUMA_Free(NumaBuffer *pBuffer)
+{
+    if ((pBuffer != NULL) && (pBuffer->pData != NULL))
+    {
+        (void)munmap(pBuffer->pData, pBuffer->bytes);
+        pBuffer->pData = NULL;
+    }
+}
+
+/**
+ * @brief  Sets the memory policy of a byte range before its pages are touched.
+ *
+ * @param[in] pTopology  Topology.
+ * @param[in] pAddress   Start of the range, page aligned.
+ * @param[in] bytes      Size of the range.
+ * @param[in] placement  Placement.
+ * @param[in] node       Node index for @c TCNUMA_PLACE_BIND.
+ *
+ * @return 1 on success, or 0 if the kernel refused the policy.
+ */
+uint8_t TCNUMA_Place(const NumaTopology *pTopology, void *pAddress, size_t bytes, NumaPlacement placement,
+                     size_t node)
+{
+    unsigned long mask[NUMA_MASK_WORDS];
+    uint8_t result = 1U;
+    size_t n;
+
+    (void)memset(mask, 0, sizeof(mask));
+
+    if ((placement == TCNUMA_PLACE_BIND) || (placement == TCNUMA_PLACE_INTERLEAVE))
+    {
+        for (n = 0U; n < pTopology->nodeCount; ++n)
+        {
+            if ((placement == TCNUMA_PLACE_INTERLEAVE) || (n == node))
+            {
+                mask[pTopology->node[n] / 64U] |= 1UL << (pTopology->node[n] % 64U);
+            }
+        }
+
+        /* maxnode counts one bit more than the mask holds, as libnuma passes it */
+        if (syscall(SYS_mbind, pAddress, bytes,
+                    (placement == TCNUMA_PLACE_BIND) ? NUMA_MPOL_BIND : NUMA_MPOL_INTERLEAVE, mask,
+                    (unsigned long)(NUMA_MASK_WORDS * 64U) + 1UL, NUMA_MPOL_MF_MOVE) != 0)
+        {
+            result = 0U;
+        }
+    }
+
+    return result;
+}
+
+/**
+ * @brief  Measures where the pages of a byte range live.
+ *
+ * @param[in] pTopology  Topology.
+ * @param[in] pAddress   Start of the range.
+ * @param[in] bytes      Size of the range.
+ * @param[in] node       Node index.
+ *
+ * @return Fraction of the sampled pages on @p node, or -1.
+ */
+double TCNUMA_LocalFraction(const NumaTopology *pTopology, const void *pAddress, size_t bytes, size_t node)
+{
+    void *pages[NUMA_MAX_SAMPLES];
+    int status[NUMA_MAX_SAMPLES];
+    size_t step = TCNUMA_HUGE_BYTES;
+    double result = -1.0;
+    size_t local  = 0U;
+    size_t count  = 0U;
+    size_t i;
+
+    while ((bytes / step) >= NUMA_MAX_SAMPLES)
+    {
+        step *= 2U;
+    }
+    for (i = 0U; (i < bytes) && (count < NUMA_MAX_SAMPLES); i += step)
+    {
+        pages[count] = (void *)&((const uint8_t *)pAddress)[i];
+        count++;
+    }
+
+    /* With no target nodes, move_pages only reports the node of each page */
+    if ((count != 0U) && (syscall(SYS_move_pages, 0, (unsigned long)count, pages, NULL, status, 0) == 0))
+    {
+        for (i = 0U; i < count; ++i)
+        {
+            local += (status[i] == (int)pTopology->node[node]) ? 1U : 0U;
+        }
+        result = (double)local / (double)count;
+    }
+
+    return result;
+}
+
+
+/* tcconv_numa.c */
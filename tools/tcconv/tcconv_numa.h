@@ -0,0 +1,169 @@
+/**
+ * @file    tcconv_numa.h
+ * @author  Amirhossein Askari
+ * @version v1.0.0
+ * @date    2026-10-16
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Header file for NUMA-aware buffers and work partitioning of tcconv.
+ *
+ * @details
+ * On multi-socket hosts a worker that converts memory of another node pays the
+ * interconnect on every load and store. This module reads the node topology from sysfs,
+ * splits a conversion into one contiguous range per worker with whole pages per range,
+ * gives each worker a home node, and places the pages of each range on the node of the
+ * worker that processes it, either with @c mbind before the first access or by letting
+ * the pinned worker touch its range first. Buffers may be backed by transparent or
+ * explicit (hugetlbfs) 2 MiB pages.
+ *
+ * @note Linux only. The memory policy system calls are issued directly, so no libnuma is
+ *       needed; on kernels or sandboxes without them the buffers keep the default policy.
+ */
+
+
+#ifndef _TCCONV_NUMA_H
+#define _TCCONV_NUMA_H
+
+/* ------------------------------------- Includes ------------------------------------- */
+
+#include <sched.h>                  ///< cpu_set_t; the includer defines _GNU_SOURCE
+#include "thermocouple_sensor.h"    ///< Fixed-width types
+
+
+/* -------------------------------------- Defines ------------------------------------- */
+
+#define  TCNUMA_MAX_NODES     64U                   ///< Nodes handled
+#define  TCNUMA_HUGE_BYTES    (2U * 1024U * 1024U)  ///< Huge page size
+
+
+/* --------------------------------------- Types -------------------------------------- */
+
+/** @brief Page sizes backing a buffer */
+typedef enum
+{
+    TCNUMA_PAGES_NORMAL = 0U,    /**< Base pages */
+    TCNUMA_PAGES_THP,            /**< Transparent huge pages (@c MADV_HUGEPAGE) */
+    TCNUMA_PAGES_HUGETLB,        /**< Explicit huge pages (@c MAP_HUGETLB), from the reserved pool */
+} NumaPages;
+
+/** @brief Placement of the pages of a buffer */
+typedef enum
+{
+    TCNUMA_PLACE_BIND = 0U,      /**< Each range bound to its worker's node with @c mbind */
+    TCNUMA_PLACE_FIRST_TOUCH,    /**< Default policy; the pinned worker touches its range first */
+    TCNUMA_PLACE_INTERLEAVE,     /**< Pages spread round-robin over all nodes */
+} NumaPlacement;
+
+/** @brief Nodes and their CPUs */
+typedef struct
+{
+    size_t nodeCount;                      /**< Nodes with CPUs */
+    uint32_t node[TCNUMA_MAX_NODES];       /**< Kernel node number of each entry */
+    cpu_set_t cpus[TCNUMA_MAX_NODES];      /**< CPUs of each node */
+} NumaTopology;
+
+/** @brief Anonymous buffer */
+typedef struct
+{
+    void *pData;        /**< First byte, aligned to the page size in use */
+    size_t bytes;       /**< Mapped size, whole pages */
+    NumaPages pages;    /**< Pages actually in use */
+} NumaBuffer;
+
+/** @brief Share of a conversion given to one worker */
+typedef struct
+{
+    size_t first;     /**< First sample */
+    size_t count;     /**< Number of samples */
+    size_t node;      /**< Index of the home node in @c NumaTopology */
+} NumaRange;
+
+
+/* ------------------------------------- Prototype ------------------------------------- */
+
+/**
+ * @brief  Reads the node topology.
+ *
+ * @param[out] pTopology  Receives the nodes; a single node with the allowed CPUs where
+ *                        sysfs has no node information.
+ */
+void TCNUMA_Discover(NumaTopology *pTopology);
+
+/**
+ * @brief  Splits a conversion into one range per worker.
+ *
+ * @details
+ * Workers are spread evenly over the nodes, consecutive workers sharing a node, so the
+ * ranges of a node are adjacent. Range boundaries are multiples of @p align samples.
+ *
+ * @param[in]  pTopology  Topology, or NULL to give every range node 0.
+ * @param[in]  count      Samples to convert.
+ * @param[in]  workers    Number of workers (at least 1).
+ * @param[in]  align      Alignment of range boundaries in samples (a power of two).
+ * @param[out] pRanges    Receives @p workers ranges; trailing ones may be empty.
+ */
+void TCNUMA_Partition(const NumaTopology *pTopology, size_t count, size_t workers, size_t align,
+                      NumaRange *pRanges);
+
+/**
+ * @brief  Pins the calling thread to the CPUs of a node.
+ *
+ * @param[in] pTopology  Topology.
+ * @param[in] node       Node index in @p pTopology.
+ *
+ * @return 1 on success, otherwise 0.
+ */
+uint8_t TCNUMA_PinThread(const NumaTopology *pTopology, size_t node);
+
+/**
+ * @brief  Maps an anonymous buffer. No page is touched.
+ *
+ * @param[out] pBuffer  Buffer.
+ * @param[in]  bytes    Size wanted.
+ * @param[in]  pages    Page size wanted; @c TCNUMA_PAGES_HUGETLB falls back to
+ *                      @c TCNUMA_PAGES_THP when the pool is empty.
+ *
+ * @return 1 on success, otherwise 0.
+ */
+uint8_t TCNUMA_Alloc(NumaBuffer *pBuffer, size_t bytes, NumaPages pages);
+
+/**
+ * @brief  Unmaps a buffer.
+ *
+ * @param[in] pBuffer  Buffer.
+ */
+void TCNUMA_Free(NumaBuffer *pBuffer);
+
+/**
+ * @brief  Sets the memory policy of a byte range before its pages are touched.
+ *
+ * @param[in] pTopology  Topology.
+ * @param[in] pAddress   Start of the range, page aligned.
+ * @param[in] bytes      Size of the range.
+ * @param[in] placement  @c TCNUMA_PLACE_BIND or @c TCNUMA_PLACE_INTERLEAVE; other
+ *                       placements leave the default policy.
+ * @param[in] node       Node index in @p pTopology for @c TCNUMA_PLACE_BIND.
+ *
+ * @return 1 on success, or 0 if the kernel refused the policy.
+ */
+uint8_t TCNUMA_Place(const NumaTopology *pTopology, void *pAddress, size_t bytes, NumaPlacement placement,
+                     size_t node);
+
+/**
+ * @brief  Measures where the pages of a byte range live.
+ *
+ * @details
+ * Queries the node of up to 4096 pages spread over the range, at least
+ * @c TCNUMA_HUGE_BYTES apart, with @c move_pages.
+ *
+ * @param[in] pTopology  Topology.
+ * @param[in] pAddress   Start of the range.
+ * @param[in] bytes      Size of the range.
+ * @param[in] node       Node index in @p pTopology.
+ *
+ * @return Fraction of the sampled pages on @p node, or -1 if it cannot be queried.
+ */
+double TCNUMA_LocalFraction(const NumaTopology *pTopology, const void *pAddress, size_t bytes, size_t node);
+
+
+#endif /* tcconv_numa.h */
@@ -0,0 +1,212 @@
+/**
+ * @file    tcio_bench.c
+ * @author  Amirhossein Askari
+ * @version v1.0.0
+ * @date    2026-10-16
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Benchmark of the pread/pwrite and io_uring conversion engines.
+ *
+ * @details
+ * Writes a recording of @c -s MiB of f64 voltages into directory @c -d, then converts it
+ * with each engine: pread/pwrite, and io_uring at depths 1, 4 and 16. Before every run
+ * the input pages are dropped from the page cache with @c posix_fadvise so the reads
+ * reach the device (where the file system honours it). Each run is timed up to a
+ * completed @c fdatasync of the output, and the best of @c -r runs is reported.
+ *
+ * Usage: tcio_bench [-d directory] [-s MiB] [-r runs]
+ */
+
+
+/* ------------------------------------- Includes -------------------------------------- */
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE                  ///< posix_fadvise, fdatasync
+#endif
+#include <fcntl.h>                  ///< open, posix_fadvise
+#include <stdio.h>                  ///< printf, snprintf
+#include <stdlib.h>                 ///< strtoul, malloc
+#include <time.h>                   ///< clock_gettime
+#include <unistd.h>                 ///< getopt, unlink
+#include "tcconv_io.h"              ///< Engines
+
+
+
+/* -------------------------------------- Defines -------------------------------------- */
+
+#define  BENCH_WRITE_SAMPLES    (1024U * 1024U)    ///< Samples written per call when creating the input
+
+
+
+/* ------------------------------------- Functions ------------------------------------- */
+
+/** @brief Monotonic time in ns */
+static uint64_t Bench_Now(void)
+{
+    struct timespec ts;
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)ts.tv_sec * 1000000000U) + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief  Writes the input recording.
+ *
+ * @param[in] pPath  Path.
+ * @param[in] count  Number of samples.
+ *
+ * @return 1 on success, otherwise 0.
+ */
+static uint8_t Bench_CreateInput(const char *pPath, size_t count)
+{
+    double *pBlock = (double *)malloc(BENCH_WRITE_SAMPLES * sizeof(double));
+    const int fd   = open(pPath, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    uint8_t ok     = ((pBlock != NULL) && (fd >= 0)) ? 1U : 0U;
+    size_t done;
+    size_t i;
+
+    for (done = 0U; (ok != 0U) && (done < count); done += BENCH_WRITE_SAMPLES)
+    {
+        const size_t n = ((count - done) < BENCH_WRITE_SAMPLES) ? (count - done) : BENCH_WRITE_SAMPLES;
+
+        for (i = 0U; i < n; ++i)
+        {
+            pBlock[i] = 0.001 * (double)((done + i) % 50000U);
+        }
+        ok = (write(fd, pBlock, n * sizeof(double)) == (ssize_t)(n * sizeof(double))) ? 1U : 0U;
+    }
+
+    if ((ok != 0U) && (fsync(fd) != 0))
+    {
+        ok = 0U;
+    }
+    if (fd >= 0)
+    {
+        (void)close(fd);
+    }
+    free(pBlock);
+
+    return ok;
+}
+
+/**
+ * @brief  Converts the recording once with cold input pages.
+ *
+ * @param[in] pInput   Input path.
+ * @param[in] pOutput  Output path.
+ * @param[in] engine   Engine.
+ * @param[in] depth    Chunks in flight.
+ * @param[in] count    Number of samples.
+ *
+ * @return Seconds, or a negative value on error or if the engine fell back.
+ */
+static double Bench_Run(const char *pInput, const char *pOutput, IoEngine engine, size_t depth, size_t count)
+{
+    const ConvSettings settings = { TC_TYPE_K, TC_MODE_FAST, CONV_FORMAT_F64, { 0.001, 0.0, 0.0 } };
+    const int inputFd  = open(pInput, O_RDONLY);
+    const int outputFd = open(pOutput, O_RDWR | O_CREAT, 0644);
+    double seconds     = -1.0;
+    IoEngine used      = engine;
+    size_t failed;
+    uint64_t start;
+
+    if ((inputFd >= 0) && (outputFd >= 0) && (posix_fallocate(outputFd, 0, (off_t)(count * sizeof(double))) == 0))
+    {
+        (void)posix_fadvise(inputFd, 0, 0, POSIX_FADV_DONTNEED);
+
+        start = Bench_Now();
+        if ((TCIO_ConvertFile(&used, &settings, inputFd, outputFd, count, depth, &failed) != 0U) &&
+            (fdatasync(outputFd) == 0) && (used == engine))
+        {
+            seconds = (double)(Bench_Now() - start) * 1e-9;
+        }
+    }
+
+    if (outputFd >= 0)
+    {
+        (void)close(outputFd);
+    }
+    if (inputFd >= 0)
+    {
+        (void)close(inputFd);
+    }
+
+    return seconds;
+}
+
+int main(int argc, char **argv)
+{
+    static const IoEngine engines[] = { TCIO_ENGINE_PREAD, TCIO_ENGINE_URING, TCIO_ENGINE_URING, TCIO_ENGINE_URING };
+    static const size_t depths[]    = { 1U, 1U, 4U, 16U };
+    const char *pDirectory = "/tmp";
+    size_t megabytes = 512U;
+    size_t runs      = 3U;
+    char input[512];
+    char output[512];
+    size_t count;
+    size_t e;
+    size_t r;
+    int option;
+
+    while ((option = getopt(argc, argv, "d:s:r:")) != -1)
+    {
+        if (option == 'd')
+        {
+            pDirectory = optarg;
+        }
+        else if (option == 's')
+        {
+            megabytes = (size_t)strtoul(optarg, NULL, 10);
+        }
+        else if (option == 'r')
+        {
+            runs = (size_t)strtoul(optarg, NULL, 10);
+        }
+        else
+        {
+            (void)fprintf(stderr, "usage: %s [-d directory] [-s MiB] [-r runs]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    count = (megabytes * 1024U * 1024U) / sizeof(double);
+    (void)snprintf(input, sizeof(input), "%s/tcio_bench.in", pDirectory);
+    (void)snprintf(output, sizeof(output), "%s/tcio_bench.out", pDirectory);
+    if ((count == 0U) || (runs == 0U) || (Bench_CreateInput(input, count) == 0U))
+    {
+        perror("tcio_bench");
+        return 1;
+    }
+
+    printf("%zu MiB of f64 in %s, best of %zu\n", megabytes, pDirectory, runs);
+    for (e = 0U; e < (sizeof(engines) / sizeof(engines[0])); ++e)
+    {
+        double best = -1.0;
+
+        for (r = 0U; r < runs; ++r)
+        {
+            const double seconds = Bench_Run(input, output, engines[e], depths[e], count);
+            if ((seconds > 0.0) && ((best < 0.0) || (seconds < best)))
+            {
+                best = seconds;
+            }
+        }
+
+        if (best > 0.0)
+        {
+            printf("%-8s depth %2zu: %.3f s, %.2f GB/s\n", (engines[e] == TCIO_ENGINE_URING) ? "io_uring" : "pread",
+                   depths[e], best, ((double)(count * sizeof(double)) / best) * 1e-9);
+        }
+        else
+        {
+            printf("%-8s depth %2zu: unavailable\n", (engines[e] == TCIO_ENGINE_URING) ? "io_uring" : "pread", depths[e]);
+        }
+    }
+
+    (void)unlink(output);
+    (void)unlink(input);
+
+    return 0;
+}
+
+
+/* tcio_bench.c */
@@ -0,0 +1,348 @@
+/**
+ * @file    tcnt_bench.c
+ * @author  Amirhossein Askari
+ * @version v1.0.0
+ * @date    2026-10-16
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Benchmark of the large-array mode of the batch conversions against memory bandwidth.
+ *
+ * @details
+ * Converts @c -s MiB of f64 voltages with @c -j workers, each on a contiguous share, and
+ * sets the rate against two ceilings: the copy bandwidth of the same buffers (@c memcpy,
+ * and a copy with streaming stores on SSE2 targets) and the compute rate of the
+ * conversion on a block that stays in L1. Each share is converted once in calls just
+ * below @c TC_STREAM_THRESHOLD, which keep ordinary stores, and once in a single call,
+ * which streams its output when the share reaches the threshold; the same is done for
+ * one channel of a @c -c channel interleaved buffer through the strided conversion.
+ * Rates count 16 bytes per element (one voltage read, one temperature written); the best
+ * of @c -r runs is reported.
+ *
+ * A conversion is memory bound when its large-buffer rate is near the copy bandwidth and
+ * well below its in-cache rate. One core rarely gets there; raise @c -j until it does.
+ *
+ * Usage: tcnt_bench [-s MiB] [-j workers] [-r runs] [-c channels] [-m fast|exact]
+ */
+
+
+/* ------------------------------------- Includes -------------------------------------- */
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE                  ///< clock_gettime, getopt
+#endif
+#include <pthread.h>                ///< Workers
+#include <stdio.h>                  ///< printf
+#include <stdlib.h>                 ///< malloc, strtoul
+#include <string.h>                 ///< memcpy, memset, strcmp
+#include <time.h>                   ///< clock_gettime
+#include <unistd.h>                 ///< getopt
+#if defined(__SSE2__)
+#include <emmintrin.h>              ///< Streaming-store copy
+#endif
+#include "thermocouple_sensor.h"    ///< Batch conversions
+
+
+/* -------------------------------------- Defines -------------------------------------- */
+
+#define  BENCH_MAX_WORKERS    256U                         ///< Upper bound on @c -j
+#define  BENCH_HOT_COUNT      2048U                        ///< Elements of the in-cache case (32 KiB in + out)
+#define  BENCH_CHUNK          (TC_STREAM_THRESHOLD - 1U)   ///< Largest call that keeps ordinary stores
+
+
+/* --------------------------------------- Types --------------------------------------- */
+
+/** @brief Buffers and parameters shared by the cases */
+typedef struct
+{
+    double *pInput;            /**< Contiguous voltages in mV */
+    double *pOutput;           /**< Temperatures in °C */
+    double *pFrames;           /**< Interleaved voltages, @c channels per frame */
+    size_t count;              /**< Elements */
+    size_t channels;           /**< Channels per frame */
+    ConversionMode mode;       /**< Conversion mode */
+} BenchData;
+
+/** @brief One measured case, run on the elements [@c first, @c first + @c count) */
+typedef void (*BenchCase)(const BenchData *pData, size_t first, size_t count);
+
+/** @brief One worker of a run */
+typedef struct
+{
+    const BenchData *pData;    /**< Buffers */
+    BenchCase run;             /**< Case */
+    size_t first;              /**< First element of the share */
+    size_t count;              /**< Elements of the share */
+} BenchWorker;
+
+
+/* ------------------------------------- Functions ------------------------------------- */
+
+/** @brief Monotonic time in ns */
+static uint64_t Bench_Now(void)
+{
+    struct timespec ts;
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)ts.tv_sec * 1000000000U) + (uint64_t)ts.tv_nsec;
+}
+
+/** @brief Copy with ordinary stores */
+static void Bench_Memcpy(const BenchData *pData, size_t first, size_t count)
+{
+    (void)memcpy(&pData->pOutput[first], &pData->pInput[first], count * sizeof(double));
+}
+
+/** @brief Copy with streaming stores, or ordinary ones without SSE2 */
+static void Bench_StreamCopy(const BenchData *pData, size_t first, size_t count)
+{
+#if defined(__SSE2__)
+    size_t i;
+
+    /* Shares start at even elements of 64-byte aligned buffers */
+    for (i = first; (i + 1U) < (first + count); i += 2U)
+    {
+        _mm_stream_pd(&pData->pOutput[i], _mm_load_pd(&pData->pInput[i]));
+    }
+    for (; i < (first + count); ++i)
+    {
+        pData->pOutput[i] = pData->pInput[i];
+    }
+    _mm_sfence();
+#else
+    Bench_Memcpy(pData, first, count);
+#endif
+}
+
+/** @brief Conversion of one block over and over, for as many elements as the large cases */
+static void Bench_Hot(const BenchData *pData, size_t first, size_t count)
+{
+    /* The last share may be shorter than the block; the buffer never is */
+    const size_t base = ((first + BENCH_HOT_COUNT) <= pData->count) ? first : (pData->count - BENCH_HOT_COUNT);
+    size_t offset;
+
+    for (offset = 0U; offset < count; offset += BENCH_HOT_COUNT)
+    {
+        (void)TC_CalculateTemperatureArray(TC_TYPE_K, &pData->pInput[base], &pData->pOutput[base],
+                                           BENCH_HOT_COUNT, pData->mode);
+    }
+}
+
+/** @brief Conversion in calls below the threshold, with ordinary stores */
+static void Bench_Cached(const BenchData *pData, size_t first, size_t count)
+{
+    size_t offset;
+    size_t run;
+
+    for (offset = first; offset < (first + count); offset += run)
+    {
+        run = (((first + count) - offset) < BENCH_CHUNK) ? ((first + count) - offset) : BENCH_CHUNK;
+        (void)TC_CalculateTemperatureArray(TC_TYPE_K, &pData->pInput[offset], &pData->pOutput[offset], run,
+                                           pData->mode);
+    }
+}
+
+/** @brief Conversion in one call, in the large-array mode */
+static void Bench_Streamed(const BenchData *pData, size_t first, size_t count)
+{
+    (void)TC_CalculateTemperatureArray(TC_TYPE_K, &pData->pInput[first], &pData->pOutput[first], count,
+                                       pData->mode);
+}
+
+/** @brief Strided conversion of channel 0 in calls below the threshold */
+static void Bench_StridedCached(const BenchData *pData, size_t first, size_t count)
+{
+    const size_t stride = pData->channels * sizeof(double);
+    size_t offset;
+    size_t run;
+
+    for (offset = first; offset < (first + count); offset += run)
+    {
+        run = (((first + count) - offset) < BENCH_CHUNK) ? ((first + count) - offset) : BENCH_CHUNK;
+        (void)TC_CalculateTemperatureStrided(TC_TYPE_K, &pData->pFrames[offset * pData->channels], stride,
+                                             &pData->pOutput[offset], sizeof(double), run, pData->mode);
+    }
+}
+
+/** @brief Strided conversion of channel 0 in one call */
+static void Bench_StridedStreamed(const BenchData *pData, size_t first, size_t count)
+{
+    (void)TC_CalculateTemperatureStrided(TC_TYPE_K, &pData->pFrames[first * pData->channels],
+                                         pData->channels * sizeof(double), &pData->pOutput[first], sizeof(double),
+                                         count, pData->mode);
+}
+
+/**
+ * @brief  Thread body: runs the case on one share.
+ *
+ * @param[in] pArg  @c BenchWorker.
+ *
+ * @return NULL.
+ */
+static void *Bench_Worker(void *pArg)
+{
+    const BenchWorker *pWorker = (const BenchWorker *)pArg;
+
+    pWorker->run(pWorker->pData, pWorker->first, pWorker->count);
+
+    return NULL;
+}
+
+/**
+ * @brief  Times one case.
+ *
+ * @param[in] pData    Buffers.
+ * @param[in] run      Case.
+ * @param[in] workers  Number of workers; the first one is the calling thread.
+ * @param[in] runs     Repetitions.
+ *
+ * @return Best time in ns.
+ */
+static uint64_t Bench_Time(const BenchData *pData, BenchCase run, size_t workers, size_t runs)
+{
+    static BenchWorker state[BENCH_MAX_WORKERS];
+    static pthread_t threads[BENCH_MAX_WORKERS];
+    const size_t share = ((pData->count / workers) + 1U) & ~(size_t)1U;
+    uint64_t best = 0U;
+    size_t r;
+    size_t w;
+
+    for (w = 0U; w < workers; ++w)
+    {
+        state[w].pData = pData;
+        state[w].run   = run;
+        state[w].first = ((w * share) < pData->count) ? (w * share) : pData->count;
+        state[w].count = ((pData->count - state[w].first) < share) ? (pData->count - state[w].first) : share;
+    }
+
+    for (r = 0U; r < runs; ++r)
+    {
+        const uint64_t start   = Bench_Now();
+        uint64_t elapsed;
+
+        for (w = 1U; w < workers; ++w)
+        {
+            (void)pthread_create(&threads[w], NULL, Bench_Worker, &state[w]);
+        }
+        (void)Bench_Worker(&state[0]);
+        for (w = 1U; w < workers; ++w)
+        {
+            (void)pthread_join(threads[w], NULL);
+        }
+        elapsed = Bench_Now() - start;
+        best    = ((best == 0U) || (elapsed < best)) ? elapsed : best;
+    }
+
+    return (best == 0U) ? 1U : best;
+}
+
+int main(int argc, char **argv)
+{
+    static const char *const names[] = {
+        "memcpy", "stream copy", "convert, in L1", "convert, cached stores", "convert, streamed",
+        "strided, cached stores", "strided, streamed"
+    };
+    static const BenchCase cases[] = {
+        Bench_Memcpy, Bench_StreamCopy, Bench_Hot, Bench_Cached, Bench_Streamed,
+        Bench_StridedCached, Bench_StridedStreamed
+    };
+    const size_t caseCount = sizeof(cases) / sizeof(cases[0]);
+    BenchData data;
+    size_t megabytes = 256U;
+    size_t workers   = 1U;
+    size_t runs      = 5U;
+    double ceiling   = 0.0;
+    size_t c;
+    size_t i;
+    int option;
+
+    (void)memset(&data, 0, sizeof(data));
+    data.channels = 4U;
+    data.mode     = TC_MODE_FAST;
+
+    while ((option = getopt(argc, argv, "s:j:r:c:m:")) != -1)
+    {
+        if (option == 's')
+        {
+            megabytes = (size_t)strtoul(optarg, NULL, 10);
+        }
+        else if (option == 'j')
+        {
+            workers = (size_t)strtoul(optarg, NULL, 10);
+        }
+        else if (option == 'r')
+        {
+            runs = (size_t)strtoul(optarg, NULL, 10);
+        }
+        else if (option == 'c')
+        {
+            data.channels = (size_t)strtoul(optarg, NULL, 10);
+        }
+        else if (option == 'm')
+        {
+            data.mode = (strcmp(optarg, "exact") == 0) ? TC_MODE_EXACT : TC_MODE_FAST;
+        }
+        else
+        {
+            (void)fprintf(stderr, "usage: %s [-s MiB] [-j workers] [-r runs] [-c channels] [-m fast|exact]\n", argv[0]);
+            return 2;
+        }
+    }
+    workers       = (workers == 0U) ? 1U : ((workers > BENCH_MAX_WORKERS) ? BENCH_MAX_WORKERS : workers);
+    runs          = (runs == 0U) ? 1U : runs;
+    data.channels = (data.channels == 0U) ? 1U : data.channels;
+    data.count    = (megabytes * 1024U * 1024U) / sizeof(double);
+    data.count    = (data.count < (workers * BENCH_HOT_COUNT)) ? (workers * BENCH_HOT_COUNT) : data.count;
+
+    data.pInput  = (double *)aligned_alloc(64U, data.count * sizeof(double));
+    data.pOutput = (double *)aligned_alloc(64U, data.count * sizeof(double));
+    data.pFrames = (double *)aligned_alloc(64U, data.count * data.channels * sizeof(double));
+    if ((data.pInput == NULL) || (data.pOutput == NULL) || (data.pFrames == NULL))
+    {
+        (void)fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+
+    /* Touch every page before the clock runs */
+    for (i = 0U; i < data.count; ++i)
+    {
+        data.pInput[i] = (double)(i % 50000U) * 1e-3;
+    }
+    for (i = 0U; i < (data.count * data.channels); ++i)
+    {
+        data.pFrames[i] = data.pInput[i / data.channels];
+    }
+    (void)memset(data.pOutput, 0, data.count * sizeof(double));
+
+    printf("%zu MiB in + %zu MiB out, %zu workers, %s mode, threshold %u elements, prefetch %u elements, "
+           "best of %zu\n", megabytes, megabytes, workers, (data.mode == TC_MODE_EXACT) ? "exact" : "fast",
+           (unsigned)TC_STREAM_THRESHOLD, (unsigned)TC_PREFETCH_DISTANCE, runs);
+    if ((data.count / workers) < TC_STREAM_THRESHOLD)
+    {
+        printf("shares are below the threshold: the \"streamed\" cases keep ordinary stores\n");
+    }
+
+    for (c = 0U; c < caseCount; ++c)
+    {
+        const uint64_t best = Bench_Time(&data, cases[c], workers, runs);
+        const double rate   = (double)(2U * data.count * sizeof(double)) / (double)best;
+
+        ceiling = ((c < 2U) && (rate > ceiling)) ? rate : ceiling;
+        if (c < 2U)
+        {
+            printf("%-24s: %8.3f s, %7.2f GB/s\n", names[c], (double)best * 1e-9, rate);
+        }
+        else
+        {
+            printf("%-24s: %8.3f s, %7.2f GB/s, %7.1f M/s, %4.0f%% of copy bandwidth\n", names[c],
+                   (double)best * 1e-9, rate, ((double)data.count * 1e3) / (double)best, (rate / ceiling) * 100.0);
+        }
+    }
+
+    free(data.pFrames);
+    free(data.pOutput);
+    free(data.pInput);
+
+    return 0;
+}
+
+
+/* tcnt_bench.c */
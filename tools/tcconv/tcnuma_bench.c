@@ -0,0 +1,304 @@
+/**
+ * @file    tcnuma_bench.c
+ * @author  Amirhossein Askari
+ * @version v1.0.0
+ * @date    2026-10-16
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Benchmark of node-local versus interleaved buffer placement.
+ *
+ * @details
+ * Converts @c -s MiB of f64 voltages into a buffer of the same size with @c -j workers
+ * spread over the NUMA nodes, once for each placement: ranges bound to the worker's node
+ * with @c mbind, ranges first touched by the pinned worker, and pages interleaved over
+ * all nodes. Each worker fills its own input range and touches its output range before
+ * the clock starts. The best of @c -r runs is reported in GB/s (input plus output bytes),
+ * together with the share of pages found on the worker's node. @c -p selects base pages,
+ * transparent huge pages or explicit huge pages.
+ *
+ * Usage: tcnuma_bench [-s MiB] [-j workers] [-r runs] [-p normal|thp|hugetlb]
+ */
+
+
+/* ------------------------------------- Includes -------------------------------------- */
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE                  ///< cpu_set_t, pthread_barrier_t
+#endif
+#include <pthread.h>                ///< Workers and barriers
+#include <stdio.h>                  ///< printf
+#include <stdlib.h>                 ///< strtoul
+#include <string.h>                 ///< strcmp, memset
+#include <time.h>                   ///< clock_gettime
+#include <unistd.h>                 ///< getopt, sysconf
+#include "tcconv_numa.h"            ///< Topology, buffers and placement
+
+
+
+/* -------------------------------------- Defines -------------------------------------- */
+
+#define  BENCH_MAX_WORKERS    256U                                        ///< Upper bound on @c -j
+#define  BENCH_ALIGN          (TCNUMA_HUGE_BYTES / sizeof(double))       ///< Samples per huge page
+
+
+
+/* --------------------------------------- Types --------------------------------------- */
+
+/** @brief State shared by the workers of one run */
+typedef struct
+{
+    const NumaTopology *pTopology;    /**< Topology */
+    double *pInput;                   /**< Voltages in mV */
+    double *pOutput;                  /**< Temperatures in °C */
+    pthread_barrier_t ready;          /**< Passed once every range is filled */
+    pthread_barrier_t done;           /**< Passed once every range is converted */
+} BenchRun;
+
+/** @brief One worker */
+typedef struct
+{
+    BenchRun *pRun;      /**< Shared state */
+    NumaRange range;     /**< Samples and node */
+    double local;        /**< Share of the range's pages on its node */
+} BenchWorker;
+
+
+
+/* ------------------------------------- Functions ------------------------------------- */
+
+/** @brief Monotonic time in ns */
+static uint64_t Bench_Now(void)
+{
+    struct timespec ts;
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)ts.tv_sec * 1000000000U) + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief  Thread body: fills, then converts one range from its home node.
+ *
+ * @param[in,out] pArg  @c BenchWorker.
+ *
+ * @return NULL.
+ */
+static void *Bench_Worker(void *pArg)
+{
+    BenchWorker *pWorker = (BenchWorker *)pArg;
+    BenchRun *pRun       = pWorker->pRun;
+    double *pIn          = &pRun->pInput[pWorker->range.first];
+    double *pOut         = &pRun->pOutput[pWorker->range.first];
+    const size_t count   = pWorker->range.count;
+    double inLocal;
+    double outLocal;
+    size_t i;
+
+    (void)TCNUMA_PinThread(pRun->pTopology, pWorker->range.node);
+
+    /* The first touch happens here, on the home node, whatever the policy */
+    for (i = 0U; i < count; ++i)
+    {
+        pIn[i] = (double)((pWorker->range.first + i) % 50000U) * 1e-3;
+    }
+    (void)memset(pOut, 0, count * sizeof(double));
+
+    (void)pthread_barrier_wait(&pRun->ready);
+    (void)TC_CalculateTemperatureArray(TC_TYPE_K, pIn, pOut, count, TC_MODE_FAST);
+    (void)pthread_barrier_wait(&pRun->done);
+
+    inLocal  = TCNUMA_LocalFraction(pRun->pTopology, pIn, count * sizeof(double), pWorker->range.node);
+    outLocal = TCNUMA_LocalFraction(pRun->pTopology, pOut, count * sizeof(double), pWorker->range.node);
+    pWorker->local = ((inLocal < 0.0) || (outLocal < 0.0)) ? -1.0 : ((inLocal + outLocal) * 0.5);
+
+    return NULL;
+}
+
+/**
+ * @brief  Runs one conversion with a given placement.
+ *
+ * @param[in]  pTopology  Topology.
+ * @param[in]  count      Samples.
+ * @param[in]  workers    Number of workers.
+ * @param[in]  pages      Page size wanted.
+ * @param[in]  placement  Placement.
+ * @param[out] pLocal     Receives the average share of local pages, or -1.
+ * @param[out] pPages     Receives the page size in use.
+ *
+ * @return Conversion time in ns, or 0 on failure.
+ */
+static uint64_t Bench_Run(const NumaTopology *pTopology, size_t count, size_t workers, NumaPages pages,
+                          NumaPlacement placement, double *pLocal, NumaPages *pPages)
+{
+    static BenchWorker state[BENCH_MAX_WORKERS];
+    static pthread_t threads[BENCH_MAX_WORKERS];
+    NumaRange ranges[BENCH_MAX_WORKERS];
+    const size_t bytes = count * sizeof(double);
+    NumaBuffer input;
+    NumaBuffer output;
+    BenchRun run;
+    uint64_t elapsed = 0U;
+    uint64_t start;
+    size_t started   = 0U;
+    size_t counted   = 0U;
+    size_t w;
+
+    *pLocal = 0.0;
+    if ((TCNUMA_Alloc(&input, bytes, pages) & TCNUMA_Alloc(&output, bytes, pages)) != 0U)
+    {
+        *pPages = input.pages;
+        TCNUMA_Partition(pTopology, count, workers, BENCH_ALIGN, ranges);
+
+        run.pTopology = pTopology;
+        run.pInput    = (double *)input.pData;
+        run.pOutput   = (double *)output.pData;
+
+        if (placement == TCNUMA_PLACE_INTERLEAVE)
+        {
+            (void)TCNUMA_Place(pTopology, input.pData, input.bytes, placement, 0U);
+            (void)TCNUMA_Place(pTopology, output.pData, output.bytes, placement, 0U);
+        }
+        else if (placement == TCNUMA_PLACE_BIND)
+        {
+            for (w = 0U; (w < workers) && (ranges[w].count != 0U); ++w)
+            {
+                const size_t first = ranges[w].first * sizeof(double);
+                const size_t size  = ((((ranges[w].count * sizeof(double)) + TCNUMA_HUGE_BYTES) - 1U) &
+                                      ~((size_t)TCNUMA_HUGE_BYTES - 1U));
+                const size_t span  = ((first + size) <= input.bytes) ? size : (input.bytes - first);
+
+                (void)TCNUMA_Place(pTopology, &((uint8_t *)input.pData)[first], span, placement, ranges[w].node);
+                (void)TCNUMA_Place(pTopology, &((uint8_t *)output.pData)[first], span, placement, ranges[w].node);
+            }
+        }
+        else
+        {
+            /* First touch: the default policy places each page where the worker faults it */
+        }
+
+        for (w = 0U; (w < workers) && (ranges[w].count != 0U); ++w)
+        {
+            started++;
+        }
+        (void)pthread_barrier_init(&run.ready, NULL, (unsigned)(started + 1U));
+        (void)pthread_barrier_init(&run.done, NULL, (unsigned)(started + 1U));
+
+        for (w = 0U; w < started; ++w)
+        {
+            state[w].pRun  = &run;
+            state[w].range = ranges[w];
+            state[w].local = -1.0;
+            (void)pthread_create(&threads[w], NULL, Bench_Worker, &state[w]);
+        }
+
+        (void)pthread_barrier_wait(&run.ready);
+        start = Bench_Now();
+        (void)pthread_barrier_wait(&run.done);
+        elapsed = Bench_Now() - start;
+
+        for (w = 0U; w < started; ++w)
+        {
+            (void)pthread_join(threads[w], NULL);
+            if (state[w].local >= 0.0)
+            {
+                *pLocal += state[w].local;
+                counted++;
+            }
+        }
+        *pLocal = (counted != 0U) ? (*pLocal / (double)counted) : -1.0;
+
+        (void)pthread_barrier_destroy(&run.done);
+        (void)pthread_barrier_destroy(&run.ready);
+    }
+
+    TCNUMA_Free(&output);
+    TCNUMA_Free(&input);
+
+    return elapsed;
+}
+
+int main(int argc, char **argv)
+{
+    static const char *const placements[] = { "bind", "first-touch", "interleave" };
+    static const char *const pageNames[]  = { "normal", "thp", "hugetlb" };
+    NumaTopology topology;
+    NumaPages pages   = TCNUMA_PAGES_NORMAL;
+    NumaPages inUse   = TCNUMA_PAGES_NORMAL;
+    size_t megabytes  = 512U;
+    size_t runs       = 5U;
+    long online       = sysconf(_SC_NPROCESSORS_ONLN);
+    size_t workers    = (online > 0) ? (size_t)online : 1U;
+    size_t count;
+    size_t p;
+    size_t r;
+    int option;
+
+    while ((option = getopt(argc, argv, "s:j:r:p:")) != -1)
+    {
+        if (option == 's')
+        {
+            megabytes = (size_t)strtoul(optarg, NULL, 10);
+        }
+        else if (option == 'j')
+        {
+            workers = (size_t)strtoul(optarg, NULL, 10);
+        }
+        else if (option == 'r')
+        {
+            runs = (size_t)strtoul(optarg, NULL, 10);
+        }
+        else if (option == 'p')
+        {
+            pages = (strcmp(optarg, "hugetlb") == 0) ? TCNUMA_PAGES_HUGETLB
+                  : ((strcmp(optarg, "thp") == 0) ? TCNUMA_PAGES_THP : TCNUMA_PAGES_NORMAL);
+        }
+        else
+        {
+            (void)fprintf(stderr, "usage: %s [-s MiB] [-j workers] [-r runs] [-p normal|thp|hugetlb]\n", argv[0]);
+            return 2;
+        }
+    }
+    workers = (workers == 0U) ? 1U : ((workers > BENCH_MAX_WORKERS) ? BENCH_MAX_WORKERS : workers);
+    runs    = (runs == 0U) ? 1U : runs;
+    count   = (megabytes * 1024U * 1024U) / sizeof(double);
+
+    TCNUMA_Discover(&topology);
+    printf("%zu MiB in + %zu MiB out, %zu workers on %zu nodes, best of %zu\n", megabytes, megabytes, workers,
+           topology.nodeCount, runs);
+
+    for (p = 0U; p < 3U; ++p)
+    {
+        uint64_t best = 0U;
+        double local  = -1.0;
+
+        for (r = 0U; r < runs; ++r)
+        {
+            double runLocal;
+            const uint64_t elapsed = Bench_Run(&topology, count, workers, pages, (NumaPlacement)p, &runLocal, &inUse);
+
+            if ((elapsed != 0U) && ((best == 0U) || (elapsed < best)))
+            {
+                best  = elapsed;
+                local = runLocal;
+            }
+        }
+
+        if (best == 0U)
+        {
+            printf("%-11s: allocation failed\n", placements[p]);
+        }
+        else if (local < 0.0)
+        {
+            printf("%-11s %-7s: %.3f s, %.2f GB/s, local pages unknown\n", placements[p], pageNames[inUse],
+                   (double)best * 1e-9, ((double)(2U * count * sizeof(double)) / (double)best));
+        }
+        else
+        {
+            printf("%-11s %-7s: %.3f s, %.2f GB/s, %.0f%% local pages\n", placements[p], pageNames[inUse],
+                   (double)best * 1e-9, ((double)(2U * count * sizeof(double)) / (double)best), local * 100.0);
+        }
+    }
+
+    return 0;
+}
+
+
+/* tcnuma_bench.c */
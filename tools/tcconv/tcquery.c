@@ -0,0 +1,295 @@
+/**
+ * @file    tcquery.c
+ * @author  Amirhossein Askari
+ * @version v1.0.0
+ * @date    2026-10-16
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Temperature range query over a columnar block file.
+ *
+ * @details
+ * Prints the rows where channel @c -c lies within [@c -a, @c -b] °C (the first @c -l of
+ * them) and how many blocks had to be converted to find them. Blocks whose statistics
+ * exclude the range are never read. With @c -s, prints the statistics of every block
+ * instead. With @c -i, loads the channel into a voltage-domain index first and answers
+ * the query from it, in ascending temperature order. With @c -p, builds the channel's
+ * min/max pyramid block by block and prints the °C extrema of that many pixel columns
+ * spanning the whole file.
+ *
+ * Usage: tcquery [-c channel] [-a min] [-b max] [-l limit] [-s | -i | -p pixels] file
+ */
+
+
+/* ------------------------------------- Includes -------------------------------------- */
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE                  ///< getopt, clock_gettime
+#endif
+#include <stdio.h>                  ///< printf
+#include <stdlib.h>                 ///< strtoul, strtod, malloc
+#include <string.h>                 ///< memcpy
+#include <time.h>                   ///< clock_gettime
+#include <unistd.h>                 ///< getopt
+#include "thermocouple_column.h"    ///< Columnar reader
+#include "thermocouple_index.h"     ///< Voltage-domain index
+#include "thermocouple_pyramid.h"   ///< Min/max pyramid
+
+
+
+/* --------------------------------------- Types --------------------------------------- */
+
+/** @brief Printing state of the match callback */
+typedef struct
+{
+    size_t printed;    /**< Rows printed so far */
+    size_t limit;      /**< Rows to print */
+} QueryOutput;
+
+
+
+/* ------------------------------------- Functions ------------------------------------- */
+
+/** @brief Monotonic time in ns */
+static uint64_t Query_Now(void)
+{
+    struct timespec ts;
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)ts.tv_sec * 1000000000U) + (uint64_t)ts.tv_nsec;
+}
+
+/** @brief Match callback: prints the first matches */
+static void Query_Print(void *pContext, uint64_t row, double temperature)
+{
+    QueryOutput *pOutput = (QueryOutput *)pContext;
+
+    if (pOutput->printed < pOutput->limit)
+    {
+        printf("%llu %.17g\n", (unsigned long long)row, temperature);
+        pOutput->printed++;
+    }
+}
+
+/** @brief Match callback of the index: prints the first matches */
+static void Query_PrintIndexed(void *pContext, uint64_t row, double voltage, double temperature)
+{
+    (void)voltage;
+    Query_Print(pContext, row, temperature);
+}
+
+/**
+ * @brief  Indexes one channel of the file and runs the query on the index.
+ *
+ * @param[in] pReader   Reader.
+ * @param[in] channel   Channel index.
+ * @param[in] minimum   Lower bound in °C.
+ * @param[in] maximum   Upper bound in °C.
+ * @param[in] pOutput   Printing state.
+ *
+ * @return 1 on success, or 0 if the channel does not fit in memory or in an index.
+ */
+static uint8_t Query_Indexed(const ColumnReader *pReader, size_t channel, double minimum, double maximum,
+                             QueryOutput *pOutput)
+{
+    const size_t count = (size_t)pReader->pHeader->rowCount;
+    double *pVoltage   = (count != 0U) ? (double *)malloc(count * sizeof(double)) : NULL;
+    uint8_t result     = 0U;
+    VoltageIndex index;
+    size_t converted;
+    size_t matches;
+    size_t filled = 0U;
+    uint64_t start;
+    uint64_t built;
+    size_t b;
+
+    if (pVoltage != NULL)
+    {
+        for (b = 0U; b < pReader->blockCount; ++b)
+        {
+            size_t rows;
+            const double *pColumn = TC_ColumnReader_Voltages(pReader, b, channel, &rows);
+
+            (void)memcpy(&pVoltage[filled], pColumn, rows * sizeof(double));
+            filled += rows;
+        }
+
+        start = Query_Now();
+        if (TC_Index_Build(&index, (ThermocoupleType)pReader->pHeader->types[channel], pVoltage, count, 0U) != 0U)
+        {
+            built   = Query_Now();
+            matches = TC_Index_Query(&index, minimum, maximum, Query_PrintIndexed, pOutput, &converted);
+            (void)fprintf(stderr, "%zu matches; %zu of %zu samples converted; index %.3f ms, query %.3f ms\n", matches,
+                          converted, count, (double)(built - start) * 1e-6, (double)(Query_Now() - built) * 1e-6);
+            TC_Index_Destroy(&index);
+            result = 1U;
+        }
+        free(pVoltage);
+    }
+
+    return result;
+}
+
+/**
+ * @brief  Builds the pyramid of one channel and prints a trend of the whole file.
+ *
+ * @param[in] pReader  Reader.
+ * @param[in] channel  Channel index.
+ * @param[in] pixels   Columns of the trend.
+ *
+ * @return 1 on success, or 0 on allocation failure.
+ */
+static uint8_t Query_Trend(const ColumnReader *pReader, size_t channel, size_t pixels)
+{
+    double *pMinimum = (double *)malloc(pixels * sizeof(double));
+    double *pMaximum = (double *)malloc(pixels * sizeof(double));
+    uint8_t result   = ((pMinimum != NULL) && (pMaximum != NULL)) ? 1U : 0U;
+    TemperaturePyramid pyramid;
+    size_t columns;
+    uint64_t start;
+    uint64_t built;
+    size_t b;
+    size_t c;
+
+    TC_Pyramid_Init(&pyramid, (ThermocoupleType)pReader->pHeader->types[channel]);
+
+    start = Query_Now();
+    for (b = 0U; (result != 0U) && (b < pReader->blockCount); ++b)
+    {
+        size_t rows;
+        const double *pColumn = TC_ColumnReader_Voltages(pReader, b, channel, &rows);
+
+        result = TC_Pyramid_Append(&pyramid, pColumn, rows);
+    }
+
+    if (result != 0U)
+    {
+        built   = Query_Now();
+        columns = TC_Pyramid_Render(&pyramid, 0U, pyramid.samples, pixels, pMinimum, pMaximum);
+        (void)fprintf(stderr, "%zu columns; pyramid %.3f ms, render %.3f ms\n", columns,
+                      (double)(built - start) * 1e-6, (double)(Query_Now() - built) * 1e-6);
+        for (c = 0U; c < columns; ++c)
+        {
+            printf("%zu %.17g %.17g\n", c, pMinimum[c], pMaximum[c]);
+        }
+    }
+
+    TC_Pyramid_Destroy(&pyramid);
+    free(pMaximum);
+    free(pMinimum);
+
+    return result;
+}
+
+int main(int argc, char **argv)
+{
+    QueryOutput output   = { 0U, 10U };
+    size_t channel       = 0U;
+    double minimum       = -1.0e300;
+    double maximum       = 1.0e300;
+    uint8_t listStats    = 0U;
+    uint8_t useIndex     = 0U;
+    size_t pixels        = 0U;
+    int status           = 0;
+    ColumnReader reader;
+    size_t converted;
+    size_t matches;
+    uint64_t start;
+    size_t b;
+    int option;
+
+    while ((option = getopt(argc, argv, "c:a:b:l:sip:")) != -1)
+    {
+        if (option == 'c')
+        {
+            channel = (size_t)strtoul(optarg, NULL, 10);
+        }
+        else if (option == 'a')
+        {
+            minimum = strtod(optarg, NULL);
+        }
+        else if (option == 'b')
+        {
+            maximum = strtod(optarg, NULL);
+        }
+        else if (option == 'l')
+        {
+            output.limit = (size_t)strtoul(optarg, NULL, 10);
+        }
+        else if (option == 's')
+        {
+            listStats = 1U;
+        }
+        else if (option == 'i')
+        {
+            useIndex = 1U;
+        }
+        else if (option == 'p')
+        {
+            pixels = (size_t)strtoul(optarg, NULL, 10);
+        }
+        else
+        {
+            optind = argc + 1;
+        }
+    }
+
+    if ((argc - optind) != 1)
+    {
+        (void)fprintf(stderr, "usage: %s [-c channel] [-a min] [-b max] [-l limit] [-s | -i | -p pixels] file\n", argv[0]);
+        return 2;
+    }
+    if (TC_ColumnReader_Open(&reader, argv[optind]) == 0U)
+    {
+        (void)fprintf(stderr, "tcquery: %s is not a readable columnar file\n", argv[optind]);
+        return 1;
+    }
+    if (channel >= reader.pHeader->channelCount)
+    {
+        (void)fprintf(stderr, "tcquery: the file has %u channels\n", (unsigned)reader.pHeader->channelCount);
+        TC_ColumnReader_Close(&reader);
+        return 1;
+    }
+
+    if (listStats != 0U)
+    {
+        for (b = 0U; b < reader.blockCount; ++b)
+        {
+            uint64_t firstRow;
+            size_t rows;
+            const ColumnStats *pStats = TC_ColumnReader_Stats(&reader, b, channel, &firstRow, &rows);
+
+            printf("block %zu rows %llu..%llu  mV [%g, %g]  C [%g, %g]  valid %u\n", b, (unsigned long long)firstRow,
+                   (unsigned long long)(firstRow + rows - 1U), pStats->minVoltage, pStats->maxVoltage,
+                   pStats->minTemperature, pStats->maxTemperature, (unsigned)pStats->valid);
+        }
+    }
+    else if (pixels != 0U)
+    {
+        if (Query_Trend(&reader, channel, pixels) == 0U)
+        {
+            (void)fprintf(stderr, "tcquery: out of memory\n");
+            status = 1;
+        }
+    }
+    else if (useIndex != 0U)
+    {
+        if (Query_Indexed(&reader, channel, minimum, maximum, &output) == 0U)
+        {
+            (void)fprintf(stderr, "tcquery: cannot index channel %zu\n", channel);
+            status = 1;
+        }
+    }
+    else
+    {
+        start   = Query_Now();
+        matches = TC_ColumnReader_Query(&reader, channel, minimum, maximum, Query_Print, &output, &converted);
+        (void)fprintf(stderr, "%zu matches; %zu of %zu blocks converted; %.3f ms\n", matches, converted,
+                      reader.blockCount, (double)(Query_Now() - start) * 1e-6);
+    }
+
+    TC_ColumnReader_Close(&reader);
+
+    return status;
+}
+
+
+/* tcquery.c */
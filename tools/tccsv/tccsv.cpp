@@ -0,0 +1,421 @@
+/**
+ * @file    tccsv.cpp
+ * @author  Amirhossein Askari
+ * @version v1.0.0
+ * @date    2026-10-16
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Streaming CSV conversion of millivolt columns to degrees Celsius.
+ *
+ * @details
+ * Reads the input in fixed chunks and splits it into rows without copying. Fields are
+ * parsed with @c std::from_chars into a row-major block of @c batch_rows rows. Each
+ * column of the block is converted in one @c TC_CalculateTemperatureStrided call, and
+ * the results are written with the shortest round-trip @c std::to_chars into a chunked
+ * output buffer. The buffers are allocated once; nothing is allocated per line. A
+ * field that fails to convert is written empty.
+ *
+ * The first @c -k fields of every row (e.g. timestamps) are copied verbatim, and the
+ * header line is copied with @c -H. All other fields are voltages in mV. @c -t gives
+ * one thermocouple type letter for every column, or one letter per column.
+ *
+ * Usage: tccsv -t types [-e] [-k keep] [-H] [-d delimiter] [input [output]]
+ *
+ * @note Requires C++17 with floating-point @c from_chars / @c to_chars (GCC 11, MSVC 2019).
+ */
+
+
+/* ------------------------------------- Includes ------------------------------------- */
+
+#include <algorithm>                ///< std::count, std::max
+#include <charconv>                 ///< std::from_chars, std::to_chars
+#include <cstdio>                   ///< std::fread, std::fwrite
+#include <cstdlib>                  ///< std::strtoul
+#include <cstring>                  ///< std::memcpy, std::memmove
+#include <string_view>              ///< Fields
+#include <unistd.h>                 ///< getopt
+#include <vector>                   ///< Chunk buffers
+#include "thermocouple_sensor.h"    ///< Batch conversions
+
+
+namespace
+{
+
+/* ------------------------------------- Constants ------------------------------------ */
+
+constexpr std::size_t chunk_size  = std::size_t{1} << 20;    ///< Bytes read and written per I/O call
+constexpr std::size_t batch_rows  = 1024;                     ///< Rows parsed before each conversion
+constexpr std::size_t field_chars = 32;                       ///< Upper bound of one formatted double
+
+
+/* --------------------------------------- Types -------------------------------------- */
+
+/** @brief Conversion settings from the command line */
+struct options
+{
+    std::string_view types;          ///< One type letter, or one per converted column
+    ConversionMode mode = TC_MODE_FAST;
+    std::size_t keep    = 0;         ///< Leading fields copied verbatim
+    bool header         = false;     ///< Copy the first line verbatim
+    char delimiter      = ',';
+};
+
+/** @brief Buffered writer that flushes whole chunks */
+class chunk_writer
+{
+public:
+    explicit chunk_writer(std::FILE *file) : file_(file), buffer_(chunk_size + (std::size_t{64} * 1024))
+    {
+    }
+
+    /** @brief Makes room for @p bytes more and returns the write position */
+    char *reserve(std::size_t bytes)
+    {
+        if ((used_ + bytes) > buffer_.size())
+        {
+            flush();
+            if (bytes > buffer_.size())
+            {
+                buffer_.resize(bytes);
+            }
+        }
+        return buffer_.data() + used_;
+    }
+
+    /** @brief Commits bytes written after @ref reserve and flushes full chunks */
+    void commit(char *end)
+    {
+        used_ = static_cast<std::size_t>(end - buffer_.data());
+        if (used_ >= chunk_size)
+        {
+            flush();
+        }
+    }
+
+    /** @brief Writes the buffered bytes; returns false on an I/O error */
+    bool flush()
+    {
+        ok_   = ok_ && (std::fwrite(buffer_.data(), 1, used_, file_) == used_);
+        used_ = 0;
+        return ok_;
+    }
+
+private:
+    std::FILE *file_;
+    std::vector<char> buffer_;
+    std::size_t used_ = 0;
+    bool ok_          = true;
+};
+
+/** @brief Parses, converts and formats blocks of rows */
+class csv_converter
+{
+public:
+    csv_converter(const options &opts, chunk_writer &out) : opts_(opts), out_(out)
+    {
+    }
+
+    /**
+     * @brief  Processes complete lines.
+     *
+     * @param[in] text  Whole lines, each ending with '\n'.
+     *
+     * @return false on a malformed row.
+     */
+    bool process(std::string_view text)
+    {
+        bool ok = true;
+
+        while (ok && !text.empty())
+        {
+            const std::size_t end = text.find('\n');
+            std::string_view line = text.substr(0, end);
+            text.remove_prefix(end + 1);
+            line_number_++;
+
+            if (!line.empty() && (line.back() == '\r'))
+            {
+                line.remove_suffix(1);
+            }
+
+            if (opts_.header && (line_number_ == 1))
+            {
+                char *p = out_.reserve(line.size() + 1);
+                std::memcpy(p, line.data(), line.size());
+                p[line.size()] = '\n';
+                out_.commit(p + line.size() + 1);
+            }
+            else if (!line.empty())
+            {
+                ok = parse_row(line);
+                if (ok && (rows_ == batch_rows))
+                {
+                    emit();
+                }
+            }
+        }
+
+        return ok;
+    }
+
+    /** @brief Converts and writes the rows parsed so far; call before the chunk is reused */
+    void emit()
+    {
+        if (rows_ != 0)
+        {
+            for (std::size_t c = 0; c < columns_; ++c)
+            {
+                (void)TC_CalculateTemperatureStrided(types_[c], &values_[c], columns_ * sizeof(double), &values_[c],
+                                                     columns_ * sizeof(double), rows_, opts_.mode);
+            }
+            format_rows();
+            rows_ = 0;
+        }
+    }
+
+    /** @brief Line of the last error */
+    std::size_t line_number() const
+    {
+        return line_number_;
+    }
+
+private:
+    /** @brief Splits one data row into kept fields and voltages */
+    bool parse_row(std::string_view line)
+    {
+        std::size_t field = 0;
+        bool ok = true;
+
+        if (columns_ == 0)
+        {
+            ok = set_columns(line);
+        }
+
+        while (ok && (field < (opts_.keep + columns_)))
+        {
+            const std::size_t end = line.find(opts_.delimiter);
+            const std::string_view text = line.substr(0, end);
+
+            if (field < opts_.keep)
+            {
+                kept_[(rows_ * opts_.keep) + field] = text;
+            }
+            else
+            {
+                ok = parse_double(text, values_[(rows_ * columns_) + (field - opts_.keep)]);
+            }
+
+            field++;
+            if (end == std::string_view::npos)
+            {
+                line = std::string_view{};
+                ok   = ok && (field == (opts_.keep + columns_));
+            }
+            else
+            {
+                line.remove_prefix(end + 1);
+                ok = ok && (field < (opts_.keep + columns_));
+            }
+        }
+
+        if (ok)
+        {
+            rows_++;
+        }
+        return ok;
+    }
+
+    /** @brief Sizes the batch from the first data row */
+    bool set_columns(std::string_view line)
+    {
+        const std::size_t fields =
+            static_cast<std::size_t>(std::count(line.begin(), line.end(), opts_.delimiter)) + 1;
+        bool ok = fields > opts_.keep;
+
+        if (ok)
+        {
+            columns_ = fields - opts_.keep;
+            ok       = (opts_.types.size() == 1) || (opts_.types.size() == columns_);
+        }
+        for (std::size_t c = 0; ok && (c < columns_); ++c)
+        {
+            ok = parse_type(opts_.types[(opts_.types.size() == 1) ? 0 : c], types_.emplace_back());
+        }
+        if (ok)
+        {
+            values_.resize(batch_rows * columns_);
+            kept_.resize(batch_rows * opts_.keep);
+        }
+        return ok;
+    }
+
+    /** @brief Formats the converted batch */
+    void format_rows()
+    {
+        std::size_t keptBytes = 0;
+        for (const std::string_view text : kept_)
+        {
+            keptBytes = std::max(keptBytes, text.size());
+        }
+
+        for (std::size_t r = 0; r < rows_; ++r)
+        {
+            const std::size_t bytes = ((opts_.keep * (keptBytes + 1)) + (columns_ * (field_chars + 1)));
+            char *p   = out_.reserve(bytes);
+            char *end = p + bytes;
+
+            for (std::size_t k = 0; k < opts_.keep; ++k)
+            {
+                const std::string_view text = kept_[(r * opts_.keep) + k];
+                std::memcpy(p, text.data(), text.size());
+                p += text.size();
+                *p++ = opts_.delimiter;
+            }
+            for (std::size_t c = 0; c < columns_; ++c)
+            {
+                const double value = values_[(r * columns_) + c];
+                if (value != TC_CONVERSION_FAILED)
+                {
+                    p = std::to_chars(p, end, value).ptr;
+                }
+                *p++ = opts_.delimiter;
+            }
+            p[-1] = '\n';
+            out_.commit(p);
+        }
+    }
+
+    /** @brief Parses one voltage, allowing surrounding spaces */
+    static bool parse_double(std::string_view text, double &value)
+    {
+        while (!text.empty() && (text.front() == ' '))
+        {
+            text.remove_prefix(1);
+        }
+        while (!text.empty() && (text.back() == ' '))
+        {
+            text.remove_suffix(1);
+        }
+        const std::from_chars_result result = std::from_chars(text.data(), text.data() + text.size(), value);
+        return (result.ec == std::errc{}) && (result.ptr == (text.data() + text.size()));
+    }
+
+    /** @brief Parses a thermocouple type letter */
+    static bool parse_type(char letter, ThermocoupleType &type)
+    {
+        static constexpr std::string_view letters = "RSBJTEKN";    // ThermocoupleType order
+        const std::size_t index = letters.find(static_cast<char>(letter & ~0x20));
+        if (index != std::string_view::npos)
+        {
+            type = static_cast<ThermocoupleType>(index);
+        }
+        return index != std::string_view::npos;
+    }
+
+    const options &opts_;
+    chunk_writer &out_;
+    std::vector<ThermocoupleType> types_;
+    std::vector<double> values_;              ///< Row-major batch of voltages, converted in place
+    std::vector<std::string_view> kept_;      ///< Verbatim fields; point into the current input chunk
+    std::size_t columns_     = 0;
+    std::size_t rows_        = 0;
+    std::size_t line_number_ = 0;
+};
+
+} // namespace
+
+
+int main(int argc, char **argv)
+{
+    options opts;
+    int option;
+    bool usage = false;
+
+    while ((option = getopt(argc, argv, "t:ek:Hd:")) != -1)
+    {
+        if (option == 't')
+        {
+            opts.types = optarg;
+        }
+        else if (option == 'e')
+        {
+            opts.mode = TC_MODE_EXACT;
+        }
+        else if (option == 'k')
+        {
+            opts.keep = static_cast<std::size_t>(std::strtoul(optarg, nullptr, 10));
+        }
+        else if (option == 'H')
+        {
+            opts.header = true;
+        }
+        else if (option == 'd')
+        {
+            opts.delimiter = optarg[0];
+        }
+        else
+        {
+            usage = true;
+        }
+    }
+
+    if (usage || opts.types.empty() || ((argc - optind) > 2))
+    {
+        std::fprintf(stderr, "usage: %s -t types [-e] [-k keep] [-H] [-d delimiter] [input [output]]\n", argv[0]);
+        return 2;
+    }
+
+    std::FILE *in  = (optind < argc) ? std::fopen(argv[optind], "rb") : stdin;
+    std::FILE *out = ((optind + 1) < argc) ? std::fopen(argv[optind + 1], "wb") : stdout;
+    if ((in == nullptr) || (out == nullptr))
+    {
+        std::perror("tccsv");
+        return 1;
+    }
+
+    chunk_writer writer(out);
+    csv_converter converter(opts, writer);
+    std::vector<char> chunk(chunk_size);
+    std::size_t carry = 0;
+    bool ok  = true;
+    bool eof = false;
+
+    while (ok && !eof)
+    {
+        if (carry == chunk.size())
+        {
+            chunk.resize(chunk.size() * 2);    // A single line longer than the chunk
+        }
+        const std::size_t got = std::fread(chunk.data() + carry, 1, chunk.size() - carry, in);
+        std::size_t filled    = carry + got;
+        eof = (got == 0);
+
+        if (eof && (filled != 0) && (chunk[filled - 1] != '\n'))
+        {
+            if (filled == chunk.size())
+            {
+                chunk.resize(chunk.size() + 1);
+            }
+            chunk[filled++] = '\n';
+        }
+
+        const std::size_t last  = std::string_view(chunk.data(), filled).rfind('\n');
+        const std::size_t whole = (last == std::string_view::npos) ? 0 : (last + 1);
+
+        ok = converter.process(std::string_view(chunk.data(), whole));
+        converter.emit();
+        carry = filled - whole;
+        std::memmove(chunk.data(), chunk.data() + whole, carry);
+    }
+
+    ok = writer.flush() && ok;
+    if (!ok)
+    {
+        std::fprintf(stderr, "tccsv: line %zu: malformed row or write error\n", converter.line_number());
+    }
+
+    return ok ? 0 : 1;
+}
+
+
+/* tccsv.cpp */
@@ -0,0 +1,577 @@
+/**
+ * @file    tcd.c
+ * @author  Amirhossein Askari
+ * @version v1.0.0
+ * @date    2026-10-16
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Local conversion daemon.
+ *
+ * @details
+ * Serves conversion requests from local processes over a Unix domain socket (see
+ * @c tcd_protocol.h). Each poll round collects the requests of every client, optionally
+ * waits a short coalescing window for more, then groups them by type and mode. Large
+ * ranges are converted in place in the clients' shared buffers; small ones are gathered
+ * into one contiguous batch per type, converted with @c TC_CalculateTemperatureArray and
+ * scattered back. One process therefore keeps the tables hot for every client.
+ *
+ * A new connection waits in the poll set until its hello arrives, so a slow client never
+ * delays the others; it is dropped after @c TCD_HELLO_TIMEOUT ms without one. Its buffer
+ * is mapped only once @c fstat and @c F_GET_SEALS show that it covers the claimed
+ * capacity and cannot shrink.
+ *
+ * Usage: tcd [-s socket] [-w window_us]
+ */
+
+
+/* ------------------------------------- Includes -------------------------------------- */
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE                  ///< MSG_CMSG_CLOEXEC, ppoll, accept4, F_GET_SEALS
+#endif
+#include <errno.h>                  ///< errno
+#include <fcntl.h>                  ///< F_GET_SEALS
+#include <poll.h>                   ///< ppoll
+#include <signal.h>                 ///< sigaction
+#include <stdio.h>                  ///< fprintf
+#include <stdlib.h>                 ///< strtoul
+#include <string.h>                 ///< memset, memcpy
+#include <sys/mman.h>               ///< mmap
+#include <sys/socket.h>             ///< socket, recvmsg
+#include <sys/stat.h>               ///< fstat
+#include <sys/un.h>                 ///< sockaddr_un
+#include <time.h>                   ///< timespec, clock_gettime
+#include <unistd.h>                 ///< close, getopt
+#include "tcd_protocol.h"           ///< Wire protocol
+#include "thermocouple_sensor.h"    ///< Batch conversions
+
+
+
+/* -------------------------------------- Defines -------------------------------------- */
+
+#define  TCD_MAX_CLIENTS     64U          ///< Simultaneous connections
+#define  TCD_MAX_PENDING     1024U        ///< Requests handled per round
+#define  TCD_GATHER_SIZE     4096U        ///< Samples per gathered batch; larger requests convert in place
+#define  TCD_KEY_COUNT       16U          ///< Type/mode combinations (8 types x 2 modes)
+#define  TCD_HELLO_TIMEOUT   1000U        ///< Time a new connection has to send its hello, in ms
+
+
+
+/* --------------------------------------- Types --------------------------------------- */
+
+/** @brief Connected client */
+typedef struct
+{
+    int socket;            /**< Connection, or -1 if the slot is free */
+    double *pBuffer;       /**< Client's shared buffer, or NULL while the hello is awaited */
+    size_t capacity;       /**< Length of @c pBuffer in samples */
+    uint64_t deadline;     /**< Monotonic time in ms by which the hello must arrive */
+} Client;
+
+/** @brief Request waiting for the current round */
+typedef struct
+{
+    Client *pClient;            /**< Requesting client */
+    DaemonRequest request;      /**< Request as received */
+    DaemonReply reply;          /**< Reply being built */
+} Pending;
+
+
+
+/* ------------------------------------- Variables ------------------------------------- */
+
+static Client clients[TCD_MAX_CLIENTS];
+static Pending pending[TCD_MAX_PENDING];
+static size_t order[TCD_MAX_PENDING];
+static double gather[TCD_GATHER_SIZE];
+static volatile sig_atomic_t stopRequested = 0;
+
+
+
+/* ------------------------------------- Functions ------------------------------------- */
+
+/**
+ * @brief  SIGINT/SIGTERM handler: stops the daemon after the current round.
+ *
+ * @param[in] signal  Signal number.
+ */
+static void Daemon_OnSignal(int signal)
+{
+    (void)signal;
+    stopRequested = 1;
+}
+
+/** @brief Monotonic time in ms */
+static uint64_t Daemon_Now(void)
+{
+    struct timespec ts;
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)ts.tv_sec * 1000U) + ((uint64_t)ts.tv_nsec / 1000000U);
+}
+
+/**
+ * @brief  Accepts a connection into a free slot, to wait there for its hello.
+ *
+ * @param[in] listenFd  Listening socket.
+ */
+static void Daemon_Accept(int listenFd)
+{
+    Client *pClient = NULL;
+    size_t i;
+    const int socketFd = accept4(listenFd, NULL, NULL, SOCK_CLOEXEC);
+
+    for (i = 0U; (i < TCD_MAX_CLIENTS) && (pClient == NULL); ++i)
+    {
+        if (clients[i].socket < 0)
+        {
+            pClient = &clients[i];
+        }
+    }
+
+    if ((socketFd >= 0) && (pClient != NULL))
+    {
+        pClient->socket   = socketFd;
+        pClient->pBuffer  = NULL;
+        pClient->capacity = 0U;
+        pClient->deadline = Daemon_Now() + TCD_HELLO_TIMEOUT;
+    }
+    else if (socketFd >= 0)
+    {
+        (void)close(socketFd);
+    }
+    else
+    {
+        /* The connection went away before it was accepted */
+    }
+}
+
+/**
+ * @brief  Closes a client and unmaps its buffer.
+ *
+ * @param[in] pClient  Client.
+ */
+static void Daemon_Close(Client *pClient)
+{
+    if (pClient->pBuffer != NULL)
+    {
+        (void)munmap(pClient->pBuffer, pClient->capacity * sizeof(double));
+    }
+    (void)close(pClient->socket);
+    pClient->socket  = -1;
+    pClient->pBuffer = NULL;
+}
+
+/**
+ * @brief  Checks that a received buffer descriptor can back @p capacity samples.
+ *
+ * @details
+ * The memfd must already hold every sample and be sealed against shrinking, and the
+ * seals themselves must be sealed; otherwise the client could truncate it later and
+ * make the daemon fault on its mapping.
+ *
+ * @param[in] bufferFd  Received descriptor.
+ * @param[in] capacity  Samples claimed by the hello.
+ *
+ * @return 1 if the buffer may be mapped, otherwise 0.
+ */
+static uint8_t Daemon_CheckBuffer(int bufferFd, uint64_t capacity)
+{
+    struct stat status;
+    const int seals = fcntl(bufferFd, F_GET_SEALS);
+
+    return ((capacity != 0U) && (capacity <= (uint64_t)(SIZE_MAX / sizeof(double))) &&
+            (seals >= 0) && ((seals & (F_SEAL_SHRINK | F_SEAL_SEAL)) == (F_SEAL_SHRINK | F_SEAL_SEAL)) &&
+            (fstat(bufferFd, &status) == 0) && (status.st_size >= 0) &&
+            ((uint64_t)status.st_size >= (capacity * sizeof(double)))) ? 1U : 0U;
+}
+
+/**
+ * @brief  Reads the hello of a waiting client and maps the buffer it carries.
+ *
+ * @details
+ * Called when the socket is readable, so the read never waits. A malformed hello, a
+ * buffer that fails @ref Daemon_CheckBuffer or a peer that hung up closes the client.
+ *
+ * @param[in] pClient  Client waiting for its hello.
+ */
+static void Daemon_Hello(Client *pClient)
+{
+    DaemonHello hello;
+    struct iovec iov = { &hello, sizeof(hello) };
+    struct msghdr msg;
+    union
+    {
+        char buffer[CMSG_SPACE(sizeof(int))];
+        struct cmsghdr align;
+    } control;
+    struct cmsghdr *pHeader;
+    int bufferFd   = -1;
+    void *pMap     = MAP_FAILED;
+    ssize_t received;
+
+    (void)memset(&msg, 0, sizeof(msg));
+    msg.msg_iov        = &iov;
+    msg.msg_iovlen     = 1;
+    msg.msg_control    = control.buffer;
+    msg.msg_controllen = sizeof(control.buffer);
+
+    received = recvmsg(pClient->socket, &msg, MSG_DONTWAIT | MSG_CMSG_CLOEXEC);
+    pHeader  = (received >= 0) ? CMSG_FIRSTHDR(&msg) : NULL;
+    if ((pHeader != NULL) && (pHeader->cmsg_level == SOL_SOCKET) && (pHeader->cmsg_type == SCM_RIGHTS) &&
+        (pHeader->cmsg_len == CMSG_LEN(sizeof(int))))
+    {
+        (void)memcpy(&bufferFd, CMSG_DATA(pHeader), sizeof(int));
+    }
+
+    if ((received == (ssize_t)sizeof(hello)) && ((msg.msg_flags & (MSG_TRUNC | MSG_CTRUNC)) == 0) &&
+        (hello.magic == TCD_MAGIC) && (bufferFd >= 0) && (Daemon_CheckBuffer(bufferFd, hello.capacity) != 0U))
+    {
+        pMap = mmap(NULL, (size_t)hello.capacity * sizeof(double), PROT_READ | PROT_WRITE, MAP_SHARED, bufferFd, 0);
+    }
+    if (bufferFd >= 0)
+    {
+        (void)close(bufferFd);
+    }
+
+    if (pMap != MAP_FAILED)
+    {
+        pClient->pBuffer  = (double *)pMap;
+        pClient->capacity = (size_t)hello.capacity;
+    }
+    else if ((received < 0) && ((errno == EAGAIN) || (errno == EWOULDBLOCK) || (errno == EINTR)))
+    {
+        /* Spurious wake-up; keep waiting until the deadline */
+    }
+    else
+    {
+        Daemon_Close(pClient);
+    }
+}
+
+/**
+ * @brief  Reads every request a client has queued, without blocking.
+ *
+ * @param[in]     pClient  Client.
+ * @param[in,out] pCount   Number of pending requests.
+ */
+static void Daemon_Read(Client *pClient, size_t *pCount)
+{
+    DaemonRequest request;
+    ssize_t received = 1;
+
+    while ((received > 0) && (*pCount < TCD_MAX_PENDING))
+    {
+        received = recv(pClient->socket, &request, sizeof(request), MSG_DONTWAIT);
+        if (received == (ssize_t)sizeof(request))
+        {
+            pending[*pCount].pClient = pClient;
+            pending[*pCount].request = request;
+            (*pCount)++;
+        }
+        else if ((received == 0) || ((received < 0) && (errno != EAGAIN) && (errno != EWOULDBLOCK)))
+        {
+            Daemon_Close(pClient);
+        }
+        else
+        {
+            /* Nothing left, or a malformed datagram which is dropped */
+        }
+    }
+}
+
+/**
+ * @brief  Converts a gathered batch and scatters it back to its requests.
+ *
+ * @param[in] key    Type/mode combination of the batch.
+ * @param[in] first  Index in @c order of the first gathered request.
+ * @param[in] last   Index in @c order one past the last gathered request.
+ * @param[in] count  Number of gathered samples.
+ */
+static void Daemon_Flush(size_t key, size_t first, size_t last, size_t count)
+{
+    size_t n = 0U;
+    size_t k;
+    size_t i;
+
+    (void)TC_CalculateTemperatureArray((ThermocoupleType)(key >> 1U), gather, gather, count, (ConversionMode)(key & 1U));
+
+    for (k = first; k < last; ++k)
+    {
+        Pending *pPending   = &pending[order[k]];
+        double *pOut        = &pPending->pClient->pBuffer[pPending->request.offset];
+        const size_t length = (size_t)pPending->request.count;
+
+        if (length < TCD_GATHER_SIZE)
+        {
+            for (i = 0U; i < length; ++i)
+            {
+                pOut[i] = gather[n + i];
+                if (gather[n + i] == TC_CONVERSION_FAILED)
+                {
+                    pPending->reply.failed++;
+                }
+            }
+            n += length;
+        }
+    }
+}
+
+/**
+ * @brief  Validates, groups and converts the pending requests, then sends the replies.
+ *
+ * @param[in] count  Number of pending requests.
+ */
+static void Daemon_Process(size_t count)
+{
+    size_t start[TCD_KEY_COUNT + 1U];
+    size_t next[TCD_KEY_COUNT];
+    size_t key;
+    size_t k;
+
+    (void)memset(start, 0, sizeof(start));
+
+    /* Validate and count requests per type/mode */
+    for (k = 0U; k < count; ++k)
+    {
+        Pending *pPending = &pending[k];
+        const DaemonRequest *pRequest = &pPending->request;
+
+        pPending->reply.id     = pRequest->id;
+        pPending->reply.failed = 0U;
+        pPending->reply.status = TCD_STATUS_OK;
+
+        if ((pPending->pClient->socket < 0) || (pRequest->type > (uint8_t)TC_TYPE_N) ||
+            (pRequest->mode > (uint8_t)TC_MODE_EXACT) || (pRequest->offset > pPending->pClient->capacity) ||
+            (pRequest->count > (pPending->pClient->capacity - pRequest->offset)))
+        {
+            pPending->reply.status = TCD_STATUS_INVALID;
+        }
+        else
+        {
+            start[(((size_t)pRequest->type << 1U) | pRequest->mode) + 1U]++;
+        }
+    }
+
+    /* Counting sort of the valid requests by type/mode */
+    for (key = 0U; key < TCD_KEY_COUNT; ++key)
+    {
+        start[key + 1U] += start[key];
+        next[key] = start[key];
+    }
+    for (k = 0U; k < count; ++k)
+    {
+        if (pending[k].reply.status == TCD_STATUS_OK)
+        {
+            key = ((size_t)pending[k].request.type << 1U) | pending[k].request.mode;
+            order[next[key]] = k;
+            next[key]++;
+        }
+    }
+
+    /* Convert each group: large ranges in place, small ones gathered */
+    for (key = 0U; key < TCD_KEY_COUNT; ++key)
+    {
+        size_t first = start[key];
+        size_t used  = 0U;
+
+        for (k = start[key]; k < start[key + 1U]; ++k)
+        {
+            Pending *pPending   = &pending[order[k]];
+            double *pData       = &pPending->pClient->pBuffer[pPending->request.offset];
+            const size_t length = (size_t)pPending->request.count;
+
+            if (length >= TCD_GATHER_SIZE)
+            {
+                pPending->reply.failed = TC_CalculateTemperatureArray((ThermocoupleType)(key >> 1U), pData, pData, length,
+                                                                      (ConversionMode)(key & 1U));
+            }
+            else
+            {
+                if ((used + length) > TCD_GATHER_SIZE)
+                {
+                    Daemon_Flush(key, first, k, used);
+                    first = k;
+                    used  = 0U;
+                }
+                (void)memcpy(&gather[used], pData, length * sizeof(double));
+                used += length;
+            }
+        }
+        if (used != 0U)
+        {
+            Daemon_Flush(key, first, start[key + 1U], used);
+        }
+    }
+
+    for (k = 0U; k < count; ++k)
+    {
+        if (pending[k].pClient->socket >= 0)
+        {
+            (void)send(pending[k].pClient->socket, &pending[k].reply, sizeof(pending[k].reply), MSG_NOSIGNAL);
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    const char *pPath = TCD_DEFAULT_SOCKET;
+    unsigned long window = 0UL;
+    struct timespec windowTime;
+    struct timespec helloTime;
+    struct sockaddr_un address;
+    struct pollfd fds[TCD_MAX_CLIENTS + 1U];
+    Client *pPolled[TCD_MAX_CLIENTS + 1U];
+    struct sigaction action;
+    int listenFd;
+    int option;
+    size_t i;
+
+    while ((option = getopt(argc, argv, "s:w:")) != -1)
+    {
+        if (option == 's')
+        {
+            pPath = optarg;
+        }
+        else if (option == 'w')
+        {
+            window = strtoul(optarg, NULL, 10);
+        }
+        else
+        {
+            (void)fprintf(stderr, "usage: %s [-s socket] [-w window_us]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    (void)memset(&action, 0, sizeof(action));
+    action.sa_handler = Daemon_OnSignal;
+    (void)sigaction(SIGINT, &action, NULL);
+    (void)sigaction(SIGTERM, &action, NULL);
+
+    (void)memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    if (strlen(pPath) >= sizeof(address.sun_path))
+    {
+        (void)fprintf(stderr, "tcd: socket path too long\n");
+        return 1;
+    }
+    (void)memcpy(address.sun_path, pPath, strlen(pPath));
+
+    listenFd = socket(AF_UNIX, SOCK_SEQPACKET, 0);
+    (void)unlink(pPath);
+    if ((listenFd < 0) || (bind(listenFd, (const struct sockaddr *)&address, sizeof(address)) != 0) ||
+        (listen(listenFd, (int)TCD_MAX_CLIENTS) != 0))
+    {
+        perror("tcd");
+        return 1;
+    }
+
+    for (i = 0U; i < TCD_MAX_CLIENTS; ++i)
+    {
+        clients[i].socket = -1;
+    }
+
+    while (stopRequested == 0)
+    {
+        const struct timespec *pTimeout = NULL;
+        const uint64_t now = Daemon_Now();
+        uint64_t wake      = UINT64_MAX;
+        size_t polled = 1U;
+        size_t count  = 0U;
+        uint8_t accepting = 0U;
+        int round;
+
+        fds[0].fd     = listenFd;
+        fds[0].events = POLLIN;
+        for (i = 0U; i < TCD_MAX_CLIENTS; ++i)
+        {
+            if (clients[i].socket >= 0)
+            {
+                fds[polled].fd      = clients[i].socket;
+                fds[polled].events  = POLLIN;
+                pPolled[polled]     = &clients[i];
+                polled++;
+                wake = ((clients[i].pBuffer == NULL) && (clients[i].deadline < wake)) ? clients[i].deadline : wake;
+            }
+        }
+
+        /* Wake up for the earliest hello deadline, so silent connections are dropped */
+        if (wake != UINT64_MAX)
+        {
+            wake = (wake > now) ? (wake - now) : 0U;
+            helloTime.tv_sec  = (time_t)(wake / 1000U);
+            helloTime.tv_nsec = (long)(wake % 1000U) * 1000000L;
+            pTimeout = &helloTime;
+        }
+
+        /* First round waits for work; with -w, a second round collects late arrivals */
+        for (round = 0; (round < 2) && (count < TCD_MAX_PENDING); ++round)
+        {
+            if ((ppoll(fds, (nfds_t)polled, pTimeout, NULL) <= 0) || (stopRequested != 0))
+            {
+                break;
+            }
+            for (i = 1U; i < polled; ++i)
+            {
+                if (((fds[i].revents & (POLLIN | POLLHUP | POLLERR)) != 0) && (pPolled[i]->socket >= 0))
+                {
+                    if (pPolled[i]->pBuffer != NULL)
+                    {
+                        Daemon_Read(pPolled[i], &count);
+                    }
+                    else
+                    {
+                        Daemon_Hello(pPolled[i]);
+                    }
+                }
+                fds[i].revents = 0;
+            }
+            if ((fds[0].revents & POLLIN) != 0)
+            {
+                accepting = 1U;
+                fds[0].revents = 0;
+            }
+            if ((window == 0UL) || (count == 0U))
+            {
+                break;
+            }
+            windowTime.tv_sec  = (time_t)(window / 1000000UL);
+            windowTime.tv_nsec = (long)(window % 1000000UL) * 1000L;
+            pTimeout = &windowTime;
+        }
+
+        if (count != 0U)
+        {
+            Daemon_Process(count);
+        }
+
+        for (i = 0U; i < TCD_MAX_CLIENTS; ++i)
+        {
+            if ((clients[i].socket >= 0) && (clients[i].pBuffer == NULL) && (clients[i].deadline <= Daemon_Now()))
+            {
+                Daemon_Close(&clients[i]);
+            }
+        }
+
+        /* Accept only between rounds, so a reused client slot never receives stale requests */
+        if (accepting != 0U)
+        {
+            Daemon_Accept(listenFd);
+        }
+    }
+
+    for (i = 0U; i < TCD_MAX_CLIENTS; ++i)
+    {
+        if (clients[i].socket >= 0)
+        {
+            Daemon_Close(&clients[i]);
+        }
+    }
+    (void)close(listenFd);
+    (void)unlink(pPath);
+
+    return 0;
+}
+
+
+/* tcd.c */
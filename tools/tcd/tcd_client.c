@@ -0,0 +1,250 @@
+/**
+ * @file    tcd_client.c
+ * @author  Amirhossein Askari
+ * @version v1.0.0
+ * @date    2026-10-16
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Client library of the local conversion daemon.
+ *
+ * @details
+ * The shared buffer is an anonymous @c memfd mapped by both processes; its descriptor is
+ * passed to the daemon in the hello message. The buffer is sealed against shrinking
+ * before it is sent, since the daemon refuses buffers it could fault on.
+ */
+
+
+/* ------------------------------------- Includes -------------------------------------- */
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE             ///< memfd_create
+#endif
+#include "tcd_client.h"        ///< Header file for the client
+#include <fcntl.h>             ///< F_ADD_SEALS
+#include <string.h>            ///< memset, memcpy, strlen
+#include <sys/mman.h>          ///< memfd_create, mmap
+#include <sys/socket.h>        ///< socket, sendmsg
+#include <sys/un.h>            ///< sockaddr_un
+#include <unistd.h>            ///< close, ftruncate
+
+
+
+/* ------------------------------------- Functions ------------------------------------- */
+
+/**
+ * @brief  Sends the hello message with the buffer descriptor attached.
+ *
+ * @param[in] socketFd  Connected socket.
+ * @param[in] bufferFd  Shared buffer descriptor.
+ * @param[in] capacity  Length of the shared buffer in samples.
+ *
+ * @return 1 on success, otherwise 0.
+ */
+static uint8_t Client_SendHello(int socketFd, int bufferFd, size_t capacity)
+{
+    DaemonHello hello;
+    struct iovec iov;
+    struct msghdr msg;
+    union
+    {
+        char buffer[CMSG_SPACE(sizeof(int))];
+        struct cmsghdr align;
+    } control;
+    struct cmsghdr *pHeader;
+
+    hello.magic    = TCD_MAGIC;
+    hello.reserved = 0U;
+    hello.capacity = (uint64_t)capacity;
+
+    iov.iov_base = &hello;
+    iov.iov_len  = sizeof(hello);
+
+    (void)memset(&msg, 0, sizeof(msg));
+    (void)memset(&control, 0, sizeof(control));
+    msg.msg_iov        = &iov;
+    msg.msg_iovlen     = 1;
+    msg.msg_control    = control.buffer;
+    msg.msg_controllen = sizeof(control.buffer);
+
+    pHeader             = CMSG_FIRSTHDR(&msg);
+    pHeader->cmsg_level = SOL_SOCKET;
+    pHeader->cmsg_type  = SCM_RIGHTS;
+    pHeader->cmsg_len   = CMSG_LEN(sizeof(int));
+    (void)memcpy(CMSG_DATA(pHeader), &bufferFd, sizeof(int));
+
+    return (sendmsg(socketFd, &msg, 0) == (ssize_t)sizeof(hello)) ? 1U : 0U;
+}
+
+/**
+ * @brief  Connects to the daemon and shares a new sample buffer with it.
+ *
+ * @param[out] pClient   Client to initialize.
+ * @param[in]  pPath     Socket path, or NULL for @c TCD_DEFAULT_SOCKET.
+ * @param[in]  capacity  Length of the shared buffer in samples.
+ *
+ * @return 1 on success, otherwise 0.
+ */
+uint8_t TCD_Connect(DaemonClient *pClient, const char *pPath, size_t capacity)
+{
+    struct sockaddr_un address;
+    const size_t bytes = capacity * sizeof(double);
+    uint8_t result     = 0U;
+    int bufferFd       = -1;
+    void *pMap         = MAP_FAILED;
+
+    if (pPath == NULL)
+    {
+        pPath = TCD_DEFAULT_SOCKET;
+    }
+
+    if ((pClient != NULL) && (capacity != 0U) && (capacity <= (SIZE_MAX / sizeof(double))) &&
+        (strlen(pPath) < sizeof(address.sun_path)))
+    {
+        pClient->socket  = socket(AF_UNIX, SOCK_SEQPACKET, 0);
+        pClient->pBuffer = NULL;
+
+        (void)memset(&address, 0, sizeof(address));
+        address.sun_family = AF_UNIX;
+        (void)memcpy(address.sun_path, pPath, strlen(pPath));
+
+        /* The daemon only maps a buffer that can no longer shrink under it */
+        bufferFd = memfd_create("tcd-buffer", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+        if ((bufferFd >= 0) && (ftruncate(bufferFd, (off_t)bytes) == 0) &&
+            (fcntl(bufferFd, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_SEAL) == 0))
+        {
+            pMap = mmap(NULL, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, bufferFd, 0);
+        }
+
+        if ((pClient->socket >= 0) && (pMap != MAP_FAILED) &&
+            (connect(pClient->socket, (const struct sockaddr *)&address, sizeof(address)) == 0) &&
+            (Client_SendHello(pClient->socket, bufferFd, capacity) != 0U))
+        {
+            pClient->pBuffer  = (double *)pMap;
+            pClient->capacity = capacity;
+            pClient->nextId   = 0U;
+            result = 1U;
+        }
+        else
+        {
+            if (pMap != MAP_FAILED)
+            {
+                (void)munmap(pMap, bytes);
+            }
+            if (pClient->socket >= 0)
+            {
+                (void)close(pClient->socket);
+                pClient->socket = -1;
+            }
+        }
+
+        /* The daemon holds its own reference once the hello has been sent */
+        if (bufferFd >= 0)
+        {
+            (void)close(bufferFd);
+        }
+    }
+
+    return result;
+}
+
+/**
+ * @brief  Asks the daemon to convert a range of the shared buffer, without waiting.
+ *
+ * @param[in]  pClient  Connected client.
+ * @param[in]  type     Thermocouple type.
+ * @param[in]  mode     Conversion mode as defined in the @c ConversionMode enum.
+ * @param[in]  offset   First sample of the range.
+ * @param[in]  count    Number of samples.
+ * @param[out] pId      Optional; receives the request id.
+ *
+ * @return 1 if the request was sent, otherwise 0.
+ */
+uint8_t TCD_Submit(DaemonClient *pClient, ThermocoupleType type, ConversionMode mode, size_t offset, size_t count,
+                   uint32_t *pId)
+{
+    DaemonRequest request;
+
+    request.id       = pClient->nextId;
+    request.type     = (uint8_t)type;
+    request.mode     = (uint8_t)mode;
+    request.reserved = 0U;
+    request.offset   = (uint64_t)offset;
+    request.count    = (uint64_t)count;
+    pClient->nextId++;
+
+    if (pId != NULL)
+    {
+        *pId = request.id;
+    }
+
+    return (send(pClient->socket, &request, sizeof(request), MSG_NOSIGNAL) == (ssize_t)sizeof(request)) ? 1U : 0U;
+}
+
+/**
+ * @brief  Waits for the next reply.
+ *
+ * @param[in]  pClient  Connected client.
+ * @param[out] pReply   Receives the reply.
+ *
+ * @return 1 on success, or 0 if the connection failed.
+ */
+uint8_t TCD_Receive(DaemonClient *pClient, DaemonReply *pReply)
+{
+    return (recv(pClient->socket, pReply, sizeof(*pReply), 0) == (ssize_t)sizeof(*pReply)) ? 1U : 0U;
+}
+
+/**
+ * @brief  Converts a range of the shared buffer in place and waits for the result.
+ *
+ * @param[in]  pClient  Connected client with no requests in flight.
+ * @param[in]  type     Thermocouple type.
+ * @param[in]  mode     Conversion mode as defined in the @c ConversionMode enum.
+ * @param[in]  offset   First sample of the range.
+ * @param[in]  count    Number of samples.
+ * @param[out] pFailed  Optional; receives the number of samples set to @c TC_CONVERSION_FAILED.
+ *
+ * @return 1 if the range was converted, otherwise 0.
+ */
+uint8_t TCD_Convert(DaemonClient *pClient, ThermocoupleType type, ConversionMode mode, size_t offset, size_t count,
+                    size_t *pFailed)
+{
+    DaemonReply reply;
+    uint8_t result = 0U;
+
+    if ((TCD_Submit(pClient, type, mode, offset, count, NULL) != 0U) && (TCD_Receive(pClient, &reply) != 0U) &&
+        (reply.status == TCD_STATUS_OK))
+    {
+        if (pFailed != NULL)
+        {
+            *pFailed = (size_t)reply.failed;
+        }
+        result = 1U;
+    }
+
+    return result;
+}
+
+/**
+ * @brief  Closes the connection and unmaps the shared buffer.
+ *
+ * @param[in] pClient  Client.
+ */
+void TCD_Disconnect(DaemonClient *pClient)
+{
+    if (pClient != NULL)
+    {
+        if (pClient->pBuffer != NULL)
+        {
+            (void)munmap(pClient->pBuffer, pClient->capacity * sizeof(double));
+            pClient->pBuffer = NULL;
+        }
+        if (pClient->socket >= 0)
+        {
+            (void)close(pClient->socket);
+            pClient->socket = -1;
+        }
+    }
+}
+
+
+/* tcd_client.c */
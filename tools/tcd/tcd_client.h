@@ -0,0 +1,113 @@
+/**
+ * @file    tcd_client.h
+ * @author  Amirhossein Askari
+ * @version v1.0.0
+ * @date    2026-10-16
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Client library of the local conversion daemon.
+ *
+ * @details
+ * Connects to @c tcd and shares a sample buffer with it. The caller writes voltages into
+ * @c DaemonClient::pBuffer and asks the daemon to convert ranges of it in place, either
+ * synchronously with @ref TCD_Convert or pipelined with @ref TCD_Submit and
+ * @ref TCD_Receive.
+ *
+ * @note
+ * Linux only (@c memfd_create and @c SCM_RIGHTS). A client must be used by one thread at a time.
+ */
+
+
+#ifndef _TCD_CLIENT_H
+#define _TCD_CLIENT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ------------------------------------- Includes ------------------------------------- */
+
+#include "tcd_protocol.h"            ///< Wire protocol
+#include "thermocouple_sensor.h"    ///< Thermocouple types
+
+
+/* --------------------------------------- Types -------------------------------------- */
+
+/** @brief Connection to the daemon */
+typedef struct
+{
+    int socket;            /**< Connected socket */
+    double *pBuffer;       /**< Shared sample buffer */
+    size_t capacity;       /**< Length of @c pBuffer in samples */
+    uint32_t nextId;       /**< Id of the next request */
+} DaemonClient;
+
+
+/* ------------------------------------- Prototype ------------------------------------- */
+
+/**
+ * @brief  Connects to the daemon and shares a new sample buffer with it.
+ *
+ * @param[out] pClient   Client to initialize.
+ * @param[in]  pPath     Socket path, or NULL for @c TCD_DEFAULT_SOCKET.
+ * @param[in]  capacity  Length of the shared buffer in samples.
+ *
+ * @return 1 on success, otherwise 0.
+ */
+uint8_t TCD_Connect(DaemonClient *pClient, const char *pPath, size_t capacity);
+
+/**
+ * @brief  Asks the daemon to convert a range of the shared buffer, without waiting.
+ *
+ * @param[in]  pClient  Connected client.
+ * @param[in]  type     Thermocouple type.
+ * @param[in]  mode     @c TC_MODE_FAST or @c TC_MODE_EXACT.
+ * @param[in]  offset   First sample of the range.
+ * @param[in]  count    Number of samples.
+ * @param[out] pId      Optional; receives the request id echoed by @ref TCD_Receive.
+ *
+ * @return 1 if the request was sent, otherwise 0. The range must not be touched until
+ *         its reply has been received.
+ */
+uint8_t TCD_Submit(DaemonClient *pClient, ThermocoupleType type, ConversionMode mode, size_t offset, size_t count,
+                   uint32_t *pId);
+
+/**
+ * @brief  Waits for the next reply.
+ *
+ * @param[in]  pClient  Connected client.
+ * @param[out] pReply   Receives the reply.
+ *
+ * @return 1 on success, or 0 if the connection failed.
+ */
+uint8_t TCD_Receive(DaemonClient *pClient, DaemonReply *pReply);
+
+/**
+ * @brief  Converts a range of the shared buffer in place and waits for the result.
+ *
+ * @param[in]  pClient  Connected client with no requests in flight.
+ * @param[in]  type     Thermocouple type.
+ * @param[in]  mode     @c TC_MODE_FAST or @c TC_MODE_EXACT.
+ * @param[in]  offset   First sample of the range.
+ * @param[in]  count    Number of samples.
+ * @param[out] pFailed  Optional; receives the number of samples set to @c TC_CONVERSION_FAILED.
+ *
+ * @return 1 if the range was converted, otherwise 0.
+ */
+uint8_t TCD_Convert(DaemonClient *pClient, ThermocoupleType type, ConversionMode mode, size_t offset, size_t count,
+                    size_t *pFailed);
+
+/**
+ * @brief  Closes the connection and unmaps the shared buffer.
+ *
+ * @param[in] pClient  Client.
+ */
+void TCD_Disconnect(DaemonClient *pClient);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* tcd_client.h */
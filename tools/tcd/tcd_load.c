@@ -0,0 +1,249 @@
+/**
+ * @file    tcd_load.c
+ * @author  Amirhossein Askari
+ * @version v1.0.0
+ * @date    2026-10-16
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Load generator for the local conversion daemon.
+ *
+ * @details
+ * Forks @c -c client processes that each send @c -n synchronous requests of @c -s samples
+ * with rotating thermocouple types, timing every round trip. Reports the aggregate
+ * throughput and the p50/p99/max latency of the completed requests, and checks every
+ * result against a local @c TC_CalculateTemperature. Requests of clients that could not
+ * be started or connected count as errors and have no latency.
+ *
+ * Usage: tcd_load [-p socket] [-c clients] [-n requests] [-s samples]
+ */
+
+
+/* ------------------------------------- Includes -------------------------------------- */
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE              ///< MAP_ANONYMOUS
+#endif
+#include <stdio.h>              ///< printf
+#include <stdlib.h>             ///< strtoul, qsort
+#include <string.h>             ///< memcmp
+#include <sys/mman.h>           ///< Shared result arrays
+#include <sys/wait.h>           ///< waitpid
+#include <time.h>               ///< clock_gettime
+#include <unistd.h>             ///< fork, getopt
+#include "tcd_client.h"         ///< Daemon client
+
+
+
+/* -------------------------------------- Defines -------------------------------------- */
+
+#define  LOAD_NO_LATENCY     UINT64_MAX   ///< Latency slot of a request that did not complete
+
+
+
+/* ------------------------------------- Functions ------------------------------------- */
+
+/** @brief Monotonic time in ns */
+static uint64_t Load_Now(void)
+{
+    struct timespec ts;
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)ts.tv_sec * 1000000000U) + (uint64_t)ts.tv_nsec;
+}
+
+/** @brief qsort comparator for latencies */
+static int Load_Compare(const void *pA, const void *pB)
+{
+    const uint64_t a = *(const uint64_t *)pA;
+    const uint64_t b = *(const uint64_t *)pB;
+    return (a > b) - (a < b);
+}
+
+/** @brief Deterministic test voltage in 0 .. 20 mV */
+static double Load_Sample(size_t client, size_t request, size_t index)
+{
+    return 0.001 * (double)(((client * 7919U) + (request * 104729U) + (index * 31U)) % 20000U);
+}
+
+/**
+ * @brief  Body of one client process.
+ *
+ * @param[in]  pPath     Socket path.
+ * @param[in]  client    Client index, used to vary the input.
+ * @param[in]  requests  Number of requests.
+ * @param[in]  samples   Samples per request.
+ * @param[out] pLatency  Receives the round-trip time of each completed request in ns;
+ *                       the slots of the others are left at @c LOAD_NO_LATENCY.
+ *
+ * @return Number of failed requests or mismatching results.
+ */
+static size_t Load_Client(const char *pPath, size_t client, size_t requests, size_t samples, uint64_t *pLatency)
+{
+    DaemonClient connection;
+    size_t errors = 0U;
+    size_t r;
+    size_t i;
+
+    if (TCD_Connect(&connection, pPath, samples) == 0U)
+    {
+        errors = requests;
+    }
+    else
+    {
+        for (r = 0U; r < requests; ++r)
+        {
+            const ThermocoupleType type = (ThermocoupleType)((client + r) % 8U);
+            uint64_t start;
+
+            for (i = 0U; i < samples; ++i)
+            {
+                connection.pBuffer[i] = Load_Sample(client, r, i);
+            }
+
+            start = Load_Now();
+            if (TCD_Convert(&connection, type, TC_MODE_FAST, 0U, samples, NULL) == 0U)
+            {
+                errors++;
+            }
+            else
+            {
+                pLatency[r] = Load_Now() - start;
+
+                for (i = 0U; i < samples; ++i)
+                {
+                    const double expected = TC_CalculateTemperature(type, Load_Sample(client, r, i));
+                    if (memcmp(&expected, &connection.pBuffer[i], sizeof(double)) != 0)
+                    {
+                        errors++;
+                        break;
+                    }
+                }
+            }
+        }
+
+        TCD_Disconnect(&connection);
+    }
+
+    return errors;
+}
+
+int main(int argc, char **argv)
+{
+    const char *pPath = TCD_DEFAULT_SOCKET;
+    size_t clients    = 4U;
+    size_t requests   = 10000U;
+    size_t samples    = 256U;
+    size_t errors     = 0U;
+    size_t completed  = 0U;
+    uint64_t *pLatency;
+    size_t *pErrors;
+    uint64_t start;
+    double seconds;
+    size_t total;
+    size_t c;
+    pid_t pid;
+    int option;
+
+    while ((option = getopt(argc, argv, "p:c:n:s:")) != -1)
+    {
+        if (option == 'p')
+        {
+            pPath = optarg;
+        }
+        else if (option == 'c')
+        {
+            clients = (size_t)strtoul(optarg, NULL, 10);
+        }
+        else if (option == 'n')
+        {
+            requests = (size_t)strtoul(optarg, NULL, 10);
+        }
+        else if (option == 's')
+        {
+            samples = (size_t)strtoul(optarg, NULL, 10);
+        }
+        else
+        {
+            (void)fprintf(stderr, "usage: %s [-p socket] [-c clients] [-n requests] [-s samples]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    if ((clients == 0U) || (requests == 0U) || (samples == 0U))
+    {
+        (void)fprintf(stderr, "tcd_load: counts must be positive\n");
+        return 2;
+    }
+
+    total    = clients * requests;
+    pLatency = (uint64_t *)mmap(NULL, total * sizeof(uint64_t), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    pErrors  = (size_t *)mmap(NULL, clients * sizeof(size_t), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if ((pLatency == MAP_FAILED) || (pErrors == MAP_FAILED))
+    {
+        perror("tcd_load");
+        return 1;
+    }
+
+    /* A client that is never started or dies early keeps all its requests failed */
+    for (c = 0U; c < total; ++c)
+    {
+        pLatency[c] = LOAD_NO_LATENCY;
+    }
+    for (c = 0U; c < clients; ++c)
+    {
+        pErrors[c] = requests;
+    }
+
+    start = Load_Now();
+    for (c = 0U; c < clients; ++c)
+    {
+        pid = fork();
+        if (pid == 0)
+        {
+            pErrors[c] = Load_Client(pPath, c, requests, samples, &pLatency[c * requests]);
+            _exit(0);
+        }
+        else if (pid < 0)
+        {
+            perror("tcd_load: fork");
+        }
+        else
+        {
+            /* Parent: the child fills in its own error count and latencies */
+        }
+    }
+    while (wait(NULL) > 0)
+    {
+    }
+    seconds = (double)(Load_Now() - start) * 1e-9;
+
+    for (c = 0U; c < clients; ++c)
+    {
+        errors += pErrors[c];
+    }
+
+    /* Failed requests sort last, after every measured latency */
+    qsort(pLatency, total, sizeof(uint64_t), Load_Compare);
+    while ((completed < total) && (pLatency[completed] != LOAD_NO_LATENCY))
+    {
+        completed++;
+    }
+
+    if (completed != 0U)
+    {
+        printf("%zu clients x %zu requests x %zu samples: %.1f Msamples/s, %.0f requests/s\n", clients, requests,
+               samples, ((double)completed * (double)samples) / seconds * 1e-6, (double)completed / seconds);
+        printf("latency p50 %.1f us  p99 %.1f us  max %.1f us  completed %zu  errors %zu\n",
+               (double)pLatency[completed / 2U] * 1e-3, (double)pLatency[(completed * 99U) / 100U] * 1e-3,
+               (double)pLatency[completed - 1U] * 1e-3, completed, errors);
+    }
+    else
+    {
+        printf("%zu clients x %zu requests x %zu samples: no request completed, errors %zu\n", clients, requests,
+               samples, errors);
+    }
+
+    return (errors == 0U) ? 0 : 1;
+}
+
+
+/* tcd_load.c */
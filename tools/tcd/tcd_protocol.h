@@ -0,0 +1,76 @@
+/**
+ * @file    tcd_protocol.h
+ * @author  Amirhossein Askari
+ * @version v1.0.0
+ * @date    2026-10-16
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Wire protocol of the local conversion daemon.
+ *
+ * @details
+ * Clients talk to @c tcd over a @c SOCK_SEQPACKET Unix domain socket, so every message
+ * below is one datagram:
+ *
+ * 1. After connecting, the client sends a @c DaemonHello carrying the file descriptor
+ *    of a shared sample buffer (@c SCM_RIGHTS); the daemon maps the same memory. The
+ *    buffer must be a @c memfd of at least @c capacity samples sealed with
+ *    @c F_SEAL_SHRINK and @c F_SEAL_SEAL, otherwise the connection is closed.
+ * 2. Each @c DaemonRequest names a range of that buffer holding voltages in mV; the
+ *    daemon converts it to temperatures in place and answers with a @c DaemonReply.
+ *
+ * Requests may be pipelined; replies carry the request id and come back in order.
+ */
+
+
+#ifndef _TCD_PROTOCOL_H
+#define _TCD_PROTOCOL_H
+
+/* ------------------------------------- Includes ------------------------------------- */
+
+#include <stdint.h>    ///< Fixed-width integer types
+
+
+/* -------------------------------------- Defines ------------------------------------- */
+
+/** @brief Socket path used when none is given */
+#define  TCD_DEFAULT_SOCKET    "/tmp/tcd.sock"    ///< Default daemon socket
+
+/** @brief Protocol magic and version, "TCD1" */
+#define  TCD_MAGIC             0x31444354U        ///< Hello magic
+
+/** @brief Reply status values */
+#define  TCD_STATUS_OK         0U                 ///< Range converted
+#define  TCD_STATUS_INVALID    1U                 ///< Bad type, mode or range; nothing converted
+
+
+/* --------------------------------------- Types -------------------------------------- */
+
+/** @brief First message of a connection; carries the shared buffer descriptor */
+typedef struct
+{
+    uint32_t magic;        /**< @c TCD_MAGIC */
+    uint32_t reserved;     /**< Zero */
+    uint64_t capacity;     /**< Length of the shared buffer in samples (@c double) */
+} DaemonHello;
+
+/** @brief Conversion request for a range of the shared buffer */
+typedef struct
+{
+    uint32_t id;           /**< Echoed in the reply */
+    uint8_t type;          /**< @c ThermocoupleType */
+    uint8_t mode;          /**< @c ConversionMode */
+    uint16_t reserved;     /**< Zero */
+    uint64_t offset;       /**< First sample */
+    uint64_t count;        /**< Number of samples */
+} DaemonRequest;
+
+/** @brief Answer to a @c DaemonRequest */
+typedef struct
+{
+    uint32_t id;           /**< Id of the request */
+    uint32_t status;       /**< @c TCD_STATUS_OK or @c TCD_STATUS_INVALID */
+    uint64_t failed;       /**< Samples set to @c TC_CONVERSION_FAILED */
+} DaemonReply;
+
+
+#endif /* tcd_protocol.h */